@@ -24,6 +24,7 @@ class AmountCallback;
 class BigIntListCallback;
 class BitcoinLikeOutputListCallback;
 class BitcoinLikeTransaction;
+class BitcoinLikeTransactionBatchCallback;
 class BitcoinLikeTransactionBuilder;
 class I32Callback;
 class StringCallback;
@@ -54,6 +55,15 @@ public:
 
     virtual std::shared_ptr<BitcoinLikeTransactionBuilder> buildTransaction(bool partial) = 0;
 
+    /**
+     * Build the transactions of builders obtained from buildTransaction at once, sharing one UTXO snapshot
+     * and never spending the same UTXO twice. Each transaction is built or fails on its own.
+     * @param builders, list of BitcoinLikeTransactionBuilder created by this account
+     * @param partial, bool, whether the transactions are built without fetching the current block
+     * @param callback, BitcoinLikeTransactionBatchCallback triggered once per builder
+     */
+    virtual void buildTransactions(const std::vector<std::shared_ptr<BitcoinLikeTransactionBuilder>> & builders, bool partial, const std::shared_ptr<BitcoinLikeTransactionBatchCallback> & callback) = 0;
+
     /**
      * Get fees from network, fees are ordered in descending order (i.e. fastest to slowest confirmation)
      * Note: it would have been better to have this method on BitcoinLikeWallet
@@ -0,0 +1,38 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from bitcoin_like_wallet.djinni
+
+#ifndef DJINNI_GENERATED_BITCOINLIKETRANSACTIONBATCHCALLBACK_HPP
+#define DJINNI_GENERATED_BITCOINLIKETRANSACTIONBATCHCALLBACK_HPP
+
+#include "../utils/optional.hpp"
+#include <cstdint>
+#include <memory>
+#ifndef LIBCORE_EXPORT
+    #if defined(_MSC_VER)
+       #include <libcore_export.h>
+    #else
+       #define LIBCORE_EXPORT
+    #endif
+#endif
+
+namespace ledger { namespace core { namespace api {
+
+class BitcoinLikeTransaction;
+struct Error;
+
+/** Callback triggered for every transaction of a batch built by a Bitcoin account. */
+class BitcoinLikeTransactionBatchCallback {
+public:
+    virtual ~BitcoinLikeTransactionBatchCallback() {}
+
+    /**
+     * Method triggered when the transaction of a builder is built or failed, in the order of the builders.
+     * @params index integer, position of the builder in the batch
+     * @params result optional of type BitcoinLikeTransaction, non null if the build succeeded
+     * @params error optional of type Error, non null if the build failed
+     */
+    virtual void onTransaction(int32_t index, const std::shared_ptr<BitcoinLikeTransaction> & result, const std::experimental::optional<Error> & error) = 0;
+};
+
+} } }  // namespace ledger::core::api
+#endif //DJINNI_GENERATED_BITCOINLIKETRANSACTIONBATCHCALLBACK_HPP
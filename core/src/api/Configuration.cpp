@@ -45,4 +45,18 @@ std::string const Configuration::ALLOW_P2TR = {"ALLOW_P2TR"};
 
 std::string const Configuration::CONFIRMED_UTXO_FIRST = {"CONFIRMED_UTXO_FIRST"};
 
+std::string const Configuration::SYNCHRONIZATION_PIPELINE_DEPTH = {"SYNCHRONIZATION_PIPELINE_DEPTH"};
+
+std::string const Configuration::BLOCKCHAIN_EXPLORER_MAX_PARALLEL_REQUESTS = {"BLOCKCHAIN_EXPLORER_MAX_PARALLEL_REQUESTS"};
+
+std::string const Configuration::BLOCKCHAIN_EXPLORER_PAGE_SIZE = {"BLOCKCHAIN_EXPLORER_PAGE_SIZE"};
+
+std::string const Configuration::BLOCKCHAIN_EXPLORER_RPC_BATCH_WINDOW_MS = {"BLOCKCHAIN_EXPLORER_RPC_BATCH_WINDOW_MS"};
+
+std::string const Configuration::BLOCKCHAIN_EXPLORER_RPC_BATCH_MAX_SIZE = {"BLOCKCHAIN_EXPLORER_RPC_BATCH_MAX_SIZE"};
+
+std::string const Configuration::SYNCHRONIZATION_BACKFILL_SEGMENT_SIZE = {"SYNCHRONIZATION_BACKFILL_SEGMENT_SIZE"};
+
+std::string const Configuration::SYNCHRONIZATION_BACKFILL_MAX_CONCURRENT_SEGMENTS = {"SYNCHRONIZATION_BACKFILL_MAX_CONCURRENT_SEGMENTS"};
+
 } } }  // namespace ledger::core::api
@@ -82,6 +82,27 @@ public:
 
     /** Use confirmed UTXOs first in utxo picking strategies */
     static std::string const CONFIRMED_UTXO_FIRST;
+
+    /** Sets the number of address batches whose explorer calls may be in flight at the same time (default: 8). */
+    static std::string const SYNCHRONIZATION_PIPELINE_DEPTH;
+
+    /** Maximum number of concurrent requests used to fetch a single page of transactions from the explorer */
+    static std::string const BLOCKCHAIN_EXPLORER_MAX_PARALLEL_REQUESTS;
+
+    /** Number of records requested per page on explorers with cursor based paging (Horizon), capped by the explorer limit */
+    static std::string const BLOCKCHAIN_EXPLORER_PAGE_SIZE;
+
+    /** Milliseconds during which node explorer JSON-RPC calls are gathered into a single batch request, 0 disables batching */
+    static std::string const BLOCKCHAIN_EXPLORER_RPC_BATCH_WINDOW_MS;
+
+    /** Maximum number of JSON-RPC calls sent in a single batch request */
+    static std::string const BLOCKCHAIN_EXPLORER_RPC_BATCH_MAX_SIZE;
+
+    /** Number of blocks covered by each segment when a history longer than a page is split into segments fetched concurrently (Algorand) */
+    static std::string const SYNCHRONIZATION_BACKFILL_SEGMENT_SIZE;
+
+    /** Maximum number of backfill segments fetched at the same time */
+    static std::string const SYNCHRONIZATION_BACKFILL_MAX_CONCURRENT_SEGMENTS;
 };
 
 } } }  // namespace ledger::core::api
@@ -23,4 +23,24 @@ int32_t const ConfigurationDefaults::DEFAULT_PG_CONNECTION_POOL_SIZE = 25;
 
 int32_t const ConfigurationDefaults::DEFAULT_BTC_LIKE_MEMPOOL_GRACE = 900;
 
+int32_t const ConfigurationDefaults::DEFAULT_SYNCHRONIZATION_PIPELINE_DEPTH = 8;
+
+int32_t const ConfigurationDefaults::DEFAULT_SYNCHRONIZATION_MAX_CONCURRENT_ACCOUNTS = 16;
+
+int32_t const ConfigurationDefaults::DEFAULT_SYNCHRONIZATION_MAX_CONCURRENT_ACCOUNTS_PER_EXPLORER = 4;
+
+int32_t const ConfigurationDefaults::DEFAULT_BLOCKCHAIN_EXPLORER_MAX_PARALLEL_REQUESTS = 4;
+
+int32_t const ConfigurationDefaults::DEFAULT_HTTP_CACHE_TTL = 300;
+
+int32_t const ConfigurationDefaults::DEFAULT_BLOCKCHAIN_EXPLORER_PAGE_SIZE = 200;
+
+int32_t const ConfigurationDefaults::DEFAULT_BLOCKCHAIN_EXPLORER_RPC_BATCH_WINDOW_MS = 10;
+
+int32_t const ConfigurationDefaults::DEFAULT_BLOCKCHAIN_EXPLORER_RPC_BATCH_MAX_SIZE = 32;
+
+int32_t const ConfigurationDefaults::DEFAULT_SYNCHRONIZATION_BACKFILL_SEGMENT_SIZE = 1000000;
+
+int32_t const ConfigurationDefaults::DEFAULT_SYNCHRONIZATION_BACKFILL_MAX_CONCURRENT_SEGMENTS = 4;
+
 } } }  // namespace ledger::core::api
@@ -51,6 +51,36 @@ public:
      * if its age is less than that many seconds
      */
     static int32_t const DEFAULT_BTC_LIKE_MEMPOOL_GRACE;
+
+    /** Default number of synchronization batches whose explorer calls may be in flight at the same time */
+    static int32_t const DEFAULT_SYNCHRONIZATION_PIPELINE_DEPTH;
+
+    /** Default number of accounts the pool synchronization scheduler synchronizes at the same time */
+    static int32_t const DEFAULT_SYNCHRONIZATION_MAX_CONCURRENT_ACCOUNTS;
+
+    /** Default number of accounts synchronized at the same time against a single explorer */
+    static int32_t const DEFAULT_SYNCHRONIZATION_MAX_CONCURRENT_ACCOUNTS_PER_EXPLORER;
+
+    /** Default maximum number of concurrent requests used to fetch a page of transactions */
+    static int32_t const DEFAULT_BLOCKCHAIN_EXPLORER_MAX_PARALLEL_REQUESTS;
+
+    /** Default number of seconds before a cached explorer response is revalidated */
+    static int32_t const DEFAULT_HTTP_CACHE_TTL;
+
+    /** Default number of records requested per explorer page */
+    static int32_t const DEFAULT_BLOCKCHAIN_EXPLORER_PAGE_SIZE;
+
+    /** Default window gathering node explorer JSON-RPC calls, in milliseconds */
+    static int32_t const DEFAULT_BLOCKCHAIN_EXPLORER_RPC_BATCH_WINDOW_MS;
+
+    /** Default maximum number of JSON-RPC calls in a batch request */
+    static int32_t const DEFAULT_BLOCKCHAIN_EXPLORER_RPC_BATCH_MAX_SIZE;
+
+    /** Default number of blocks covered by each segment of a parallel backfill */
+    static int32_t const DEFAULT_SYNCHRONIZATION_BACKFILL_SEGMENT_SIZE;
+
+    /** Default maximum number of backfill segments fetched at the same time */
+    static int32_t const DEFAULT_SYNCHRONIZATION_BACKFILL_MAX_CONCURRENT_SEGMENTS;
 };
 
 } } }  // namespace ledger::core::api
@@ -0,0 +1,52 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from erc20.djinni
+
+#ifndef DJINNI_GENERATED_ERC20BALANCE_HPP
+#define DJINNI_GENERATED_ERC20BALANCE_HPP
+
+#include <iostream>
+#include <string>
+#include <utility>
+
+namespace ledger { namespace core { namespace api {
+
+/** Balance of an ERC20 account. */
+struct ERC20Balance final {
+    /** Address of the smart contract of the token. */
+    std::string contractAddress;
+    /** Balance of the account, in base 10. */
+    std::string balance;
+
+    ERC20Balance(std::string contractAddress_,
+                 std::string balance_)
+    : contractAddress(std::move(contractAddress_))
+    , balance(std::move(balance_))
+    {}
+
+    ERC20Balance(const ERC20Balance& cpy) {
+       this->contractAddress = cpy.contractAddress;
+       this->balance = cpy.balance;
+    }
+
+    ERC20Balance() = default;
+
+
+    ERC20Balance& operator=(const ERC20Balance& cpy) {
+       this->contractAddress = cpy.contractAddress;
+       this->balance = cpy.balance;
+       return *this;
+    }
+
+    template <class Archive>
+    void load(Archive& archive) {
+        archive(contractAddress, balance);
+    }
+
+    template <class Archive>
+    void save(Archive& archive) const {
+        archive(contractAddress, balance);
+    }
+};
+
+} } }  // namespace ledger::core::api
+#endif //DJINNI_GENERATED_ERC20BALANCE_HPP
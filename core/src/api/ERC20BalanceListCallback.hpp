@@ -0,0 +1,36 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from callback.djinni
+
+#ifndef DJINNI_GENERATED_ERC20BALANCELISTCALLBACK_HPP
+#define DJINNI_GENERATED_ERC20BALANCELISTCALLBACK_HPP
+
+#include "../utils/optional.hpp"
+#include <vector>
+#ifndef LIBCORE_EXPORT
+    #if defined(_MSC_VER)
+       #include <libcore_export.h>
+    #else
+       #define LIBCORE_EXPORT
+    #endif
+#endif
+
+namespace ledger { namespace core { namespace api {
+
+struct ERC20Balance;
+struct Error;
+
+/** Callback triggered by main completed task, returning optional result as list of template type T. */
+class ERC20BalanceListCallback {
+public:
+    virtual ~ERC20BalanceListCallback() {}
+
+    /**
+     * Method triggered when main task complete.
+     * @params result optional of type list<T>, non null if main task failed
+     * @params error optional of type Error, non null if main task succeeded
+     */
+    virtual void onCallback(const std::experimental::optional<std::vector<ERC20Balance>> & result, const std::experimental::optional<Error> & error) = 0;
+};
+
+} } }  // namespace ledger::core::api
+#endif //DJINNI_GENERATED_ERC20BALANCELISTCALLBACK_HPP
@@ -20,6 +20,7 @@ namespace ledger { namespace core { namespace api {
 
 class BigIntCallback;
 class BigIntListCallback;
+class ERC20BalanceListCallback;
 class ERC20LikeAccount;
 class EthereumLikeTransaction;
 class EthereumLikeTransactionBuilder;
@@ -81,6 +82,13 @@ public:
      * Note: same note as above
      */
     virtual void getERC20Balances(const std::vector<std::string> & erc20Addresses, const std::shared_ptr<BigIntListCallback> & callback) = 0;
+
+    /**
+     * Get balances of every ERC20 account of this Ethereum account
+     * They are read at once from the synchronized operations, pending ones included
+     * Note: same note as above
+     */
+    virtual void getAllERC20Balances(const std::shared_ptr<ERC20BalanceListCallback> & callback) = 0;
 };
 
 } } }  // namespace ledger::core::api
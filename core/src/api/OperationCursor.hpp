@@ -0,0 +1,39 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wallet.djinni
+
+#ifndef DJINNI_GENERATED_OPERATIONCURSOR_HPP
+#define DJINNI_GENERATED_OPERATIONCURSOR_HPP
+
+#include <memory>
+#ifndef LIBCORE_EXPORT
+    #if defined(_MSC_VER)
+       #include <libcore_export.h>
+    #else
+       #define LIBCORE_EXPORT
+    #endif
+#endif
+
+namespace ledger { namespace core { namespace api {
+
+class OperationListCallback;
+
+/** Cursor walking the operations matching a query chunk by chunk. */
+class LIBCORE_EXPORT OperationCursor {
+public:
+    virtual ~OperationCursor() {}
+
+    /**
+     * Fetch the next chunk of operations, empty once the cursor is exhausted. Wait for a chunk before asking for the next one.
+     * @param callback, ListCallback object returning a List of Operation objects
+     */
+    virtual void next(const std::shared_ptr<OperationListCallback> & callback) = 0;
+
+    /**
+     * Whether the cursor may return more operations.
+     * @return bool
+     */
+    virtual bool hasNext() = 0;
+};
+
+} } }  // namespace ledger::core::api
+#endif //DJINNI_GENERATED_OPERATIONCURSOR_HPP
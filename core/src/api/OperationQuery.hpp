@@ -17,6 +17,7 @@
 namespace ledger { namespace core { namespace api {
 
 class OperationCountListCallback;
+class OperationCursor;
 class OperationListCallback;
 class QueryFilter;
 enum class OperationOrderKey;
@@ -72,6 +73,16 @@ public:
      * @param callback, if execute method succeed, ListCallback object returning a List of OperationCount objects
      */
     virtual void count(const std::shared_ptr<OperationCountListCallback> & callback) = 0;
+
+    /**
+     * Walk the operations matching this query chunk by chunk, each chunk resuming after the last operation of the previous one.
+     * Orders, offset and limit of the query are ignored. Prefer it over offset to walk large results.
+     * @param key, OperationOrderKey object, DATE or BLOCK_HEIGHT, operations not yet in a block have the highest block height
+     * @param descending, bool
+     * @param chunkSize, 32-bit integer, maximum number of operations per chunk
+     * @return OperationCursor object
+     */
+    virtual std::shared_ptr<OperationCursor> cursor(OperationOrderKey key, bool descending, int32_t chunkSize) = 0;
 };
 
 } } }  // namespace ledger::core::api
@@ -9,4 +9,14 @@ std::string const PoolConfiguration::DATABASE_NAME = {"DATABASE_NAME"};
 
 std::string const PoolConfiguration::ENABLE_INTERNAL_LOGGING = {"ENABLE_INTERNAL_LOGGING"};
 
+std::string const PoolConfiguration::SYNCHRONIZATION_MAX_CONCURRENT_ACCOUNTS = {"SYNCHRONIZATION_MAX_CONCURRENT_ACCOUNTS"};
+
+std::string const PoolConfiguration::SYNCHRONIZATION_MAX_CONCURRENT_ACCOUNTS_PER_EXPLORER = {"SYNCHRONIZATION_MAX_CONCURRENT_ACCOUNTS_PER_EXPLORER"};
+
+std::string const PoolConfiguration::HTTP_CACHE_MAX_MEMORY_SIZE = {"HTTP_CACHE_MAX_MEMORY_SIZE"};
+
+std::string const PoolConfiguration::HTTP_CACHE_MAX_DISK_SIZE = {"HTTP_CACHE_MAX_DISK_SIZE"};
+
+std::string const PoolConfiguration::HTTP_CACHE_TTL = {"HTTP_CACHE_TTL"};
+
 } } }  // namespace ledger::core::api
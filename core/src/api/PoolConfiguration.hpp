@@ -29,6 +29,21 @@ public:
      * Set to true by default.
      */
     static std::string const ENABLE_INTERNAL_LOGGING;
+
+    /** Maximum number of accounts the pool synchronization scheduler synchronizes at the same time (default: 16). */
+    static std::string const SYNCHRONIZATION_MAX_CONCURRENT_ACCOUNTS;
+
+    /** Maximum number of accounts synchronized at the same time against a single explorer (default: 4). */
+    static std::string const SYNCHRONIZATION_MAX_CONCURRENT_ACCOUNTS_PER_EXPLORER;
+
+    /** Size in bytes of the memory tier of the explorers HTTP response cache, the cache is disabled when not set (default: 0). */
+    static std::string const HTTP_CACHE_MAX_MEMORY_SIZE;
+
+    /** Size in bytes of the disk tier of the explorers HTTP response cache, responses are only kept in memory when not set (default: 0). */
+    static std::string const HTTP_CACHE_MAX_DISK_SIZE;
+
+    /** Number of seconds before a cached explorer response which may still change is revalidated (default: 300). */
+    static std::string const HTTP_CACHE_TTL;
 };
 
 } } }  // namespace ledger::core::api
@@ -18,6 +18,7 @@
 
 namespace ledger { namespace core { namespace api {
 
+class Account;
 class BlockCallback;
 class CoreTracer;
 class CurrencyCallback;
@@ -26,6 +27,7 @@ class DatabaseBackend;
 class DynamicObject;
 class ErrorCodeCallback;
 class EventBus;
+class EventCodeCallback;
 class HttpClient;
 class I32Callback;
 class LogPrinter;
@@ -145,6 +147,15 @@ public:
      */
     virtual std::shared_ptr<EventBus> getEventBus() = 0;
 
+    /**
+     * Synchronize an account through the pool scheduler, which bounds the number of accounts synchronized at once.
+     * Scheduling an account already queued or synchronizing joins the pending synchronization.
+     * @param account, Account object, account of a wallet of this pool
+     * @param interactive, bool, whether a user waits for it, interactive synchronizations are started first
+     * @param callback, Callback object returning the final synchronization event code
+     */
+    virtual void scheduleSynchronization(const std::shared_ptr<Account> & account, bool interactive, const std::shared_ptr<EventCodeCallback> & callback) = 0;
+
     /**
      * Erase data (in user's DB) relative to wallet since given date.
      * @param date, start date of data deletion
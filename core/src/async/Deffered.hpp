@@ -37,11 +37,14 @@
 #include "../utils/Option.hpp"
 #include "../utils/Try.hpp"
 
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <queue>
 #include <tuple>
+#include <utility>
 
 namespace ledger {
     namespace core {
@@ -52,6 +55,16 @@ namespace ledger {
         template <typename T>
         class Promise;
 
+        /*
+         * Shared state between a Promise and its Futures.
+         *
+         * Callbacks are kept in a lock-free stack: registering a callback is a single CAS and
+         * completing the deffered atomically swaps the stack with a "completed" marker, so
+         * every callback is dispatched exactly once whichever side wins the race. The first
+         * callback (the common case of a map/flatMap chain) is stored inline and does not
+         * allocate. The result is stored once, immutable, and shared by all the callbacks
+         * instead of being copied into each of them.
+         */
         template <typename T>
         class Deffered {
           public:
@@ -65,78 +78,125 @@ namespace ledger {
             Deffered(const Deffered &) = delete;
             Deffered(Deffered &&)      = delete;
 
-            void setResult(const Try<T> &result) {
-                {
-                    std::lock_guard<std::recursive_mutex> lock(_lock);
-                    ensureNotCompleted();
-                    _value = result;
+            ~Deffered() {
+                // Callbacks still pending were never dispatched (the deffered was never completed)
+                auto node = _callbacks.load(std::memory_order_acquire);
+                while (node != nullptr && node != completedMarker()) {
+                    auto next = node->next;
+                    release(node);
+                    node = next;
                 }
-                trigger();
+            }
+
+            void setResult(const Try<T> &result) {
+                complete(std::make_shared<const Try<T>>(result));
             }
 
             void setValue(const T &value) {
-                std::lock_guard<std::recursive_mutex> lock(_lock);
-                ensureNotCompleted();
-                _value = Try<T>(value);
-                _trigger();
+                complete(std::make_shared<const Try<T>>(value));
             };
 
             void setError(const Exception &exception) {
-                std::lock_guard<std::recursive_mutex> lock(_lock);
-                ensureNotCompleted();
-                Try<T> ex;
-                ex.fail(exception);
-                _value = ex;
-                _trigger();
+                auto ex = std::make_shared<Try<T>>();
+                ex->fail(exception);
+                complete(std::move(ex));
             }
 
             void addCallback(Callback callback, std::shared_ptr<api::ExecutionContext> context) {
-                // Add to the queue
-                std::lock_guard<std::recursive_mutex> lock(_lock);
-                _callbacks.push(std::make_tuple(callback, context));
-                _trigger();
+                auto head = _callbacks.load(std::memory_order_acquire);
+                if (head == completedMarker()) {
+                    dispatch(std::move(callback), std::move(context));
+                    return;
+                }
+                auto node = acquire();
+                node->callback = std::move(callback);
+                node->context  = std::move(context);
+                do {
+                    if (head == completedMarker()) {
+                        // Completed while we were preparing the node, run it right away
+                        dispatch(std::move(node->callback), std::move(node->context));
+                        release(node);
+                        return;
+                    }
+                    node->next = head;
+                } while (!_callbacks.compare_exchange_weak(head, node, std::memory_order_acq_rel, std::memory_order_acquire));
             }
 
             Option<Try<T>> getValue() const {
-                Option<Try<T>> cpy = _value;
-                return cpy;
+                if (!hasValue()) {
+                    return Option<Try<T>>();
+                }
+                return Option<Try<T>>(*_result);
             }
 
             bool hasValue() const {
-                std::lock_guard<std::recursive_mutex> lock(_lock);
-                return _value.hasValue();
-            }
-
-            void trigger() {
-                std::lock_guard<std::recursive_mutex> lock(_lock);
-                _trigger();
+                return _callbacks.load(std::memory_order_acquire) == completedMarker();
             }
 
           private:
-            inline void ensureNotCompleted() {
-                if (_value.hasValue())
-                    throw Exception(api::ErrorCode::ALREADY_COMPLETED, "This promise is already completed");
+            struct Node {
+                Callback callback;
+                std::shared_ptr<api::ExecutionContext> context;
+                Node *next;
             };
 
-            inline void _trigger() {
-                if (_value.isEmpty() || _callbacks.empty()) {
-                    return;
+            // Never dereferenced, only compared against the head of the callback stack
+            static Node *completedMarker() {
+                return reinterpret_cast<Node *>(static_cast<uintptr_t>(1));
+            }
+
+            Node *acquire() {
+                if (!_inlineNodeUsed.test_and_set(std::memory_order_acq_rel)) {
+                    return &_inlineNode;
                 }
-                while (!_callbacks.empty()) {
-                    std::tuple<Callback, std::shared_ptr<api::ExecutionContext>> callback = _callbacks.front();
-                    Callback cb                                                           = std::get<0>(callback);
-                    auto value                                                            = _value.getValue();
-                    std::get<1>(callback)->execute(make_runnable([cb, value]() {
-                        cb(value);
-                    }));
-                    _callbacks.pop();
+                return new Node();
+            }
+
+            void release(Node *node) {
+                if (node == &_inlineNode) {
+                    node->callback = nullptr;
+                    node->context.reset();
+                } else {
+                    delete node;
                 }
             }
 
+            void complete(std::shared_ptr<const Try<T>> result) {
+                if (_completing.exchange(true, std::memory_order_acq_rel)) {
+                    throw Exception(api::ErrorCode::ALREADY_COMPLETED, "This promise is already completed");
+                }
+                _result   = std::move(result);
+                // Publishing the marker releases _result to every reader observing it
+                auto node = _callbacks.exchange(completedMarker(), std::memory_order_acq_rel);
+                // The stack is LIFO, restore the registration order before dispatching
+                Node *ordered = nullptr;
+                while (node != nullptr) {
+                    auto next  = node->next;
+                    node->next = ordered;
+                    ordered    = node;
+                    node       = next;
+                }
+                while (ordered != nullptr) {
+                    auto next = ordered->next;
+                    dispatch(std::move(ordered->callback), std::move(ordered->context));
+                    release(ordered);
+                    ordered = next;
+                }
+            }
+
+            void dispatch(Callback callback, std::shared_ptr<api::ExecutionContext> context) {
+                auto result = _result;
+                context->execute(make_runnable([callback = std::move(callback), result = std::move(result)]() {
+                    callback(*result);
+                }));
+            }
+
           private:
-            mutable std::recursive_mutex _lock;
-            Option<Try<T>> _value;
-            std::queue<std::tuple<Callback, std::shared_ptr<api::ExecutionContext>>> _callbacks;
+            std::atomic<Node *> _callbacks{nullptr};
+            std::atomic<bool> _completing{false};
+            std::shared_ptr<const Try<T>> _result;
+            std::atomic_flag _inlineNodeUsed = ATOMIC_FLAG_INIT;
+            Node _inlineNode;
         };
 
     } // namespace core
@@ -75,5 +75,27 @@ namespace ledger {
             }
             return Future<std::vector<T>>(deffered);
         }
+
+        // Like executeAll, but waits for every future and keeps each outcome instead of failing on the first error
+        template <typename T>
+        Future<std::vector<Try<T>>> executeAllSettled(const std::shared_ptr<api::ExecutionContext> &context, std::vector<Future<T>> &futures) {
+            auto container   = std::make_shared<Container<Try<T>>>();
+            container->count = 0;
+            container->result.resize(futures.size());
+            auto deffered = std::make_shared<Deffered<std::vector<Try<T>>>>();
+            if (futures.empty()) {
+                deffered->setValue(container->result);
+            }
+            for (int i = 0; i < futures.size(); ++i) {
+                futures[i].onComplete(context, [container, deffered, i](const Try<T> &result) {
+                    std::lock_guard<std::mutex> lock(container->lock);
+                    container->result[i] = result;
+                    container->count++;
+                    if (container->count == container->result.size())
+                        deffered->setValue(container->result);
+                });
+            }
+            return Future<std::vector<Try<T>>>(deffered);
+        }
     } // namespace core
 } // namespace ledger
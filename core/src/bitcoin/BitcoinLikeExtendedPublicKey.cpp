@@ -36,12 +36,15 @@
 #include "crypto/HASH160.hpp"
 #include "debug/Benchmarker.h"
 #include "math/Base58.hpp"
+#include "utils/Concurrency.hpp"
+#include "utils/Exception.hpp"
 #include "utils/DerivationPath.hpp"
 #include "utils/djinni_helpers.hpp"
 
 #include <api/Configuration.hpp>
 #include <api/KeychainEngines.hpp>
 #include <crypto/SECP256k1Point.hpp>
+#include <numeric>
 
 namespace ledger {
     namespace core {
@@ -66,6 +69,42 @@ namespace ledger {
             return std::make_shared<BitcoinLikeExtendedPublicKey>(_currency, dpk, _configuration, _path + path);
         }
 
+        std::vector<std::string> BitcoinLikeExtendedPublicKey::deriveChildrenAddresses(const std::vector<uint32_t> &childNums,
+                                                                                       const std::string &keychainEngine) {
+            const auto isHash160Engine = keychainEngine == api::KeychainEngines::BIP32_P2PKH || keychainEngine == api::KeychainEngines::BIP173_P2WPKH;
+            const auto isScriptEngine  = keychainEngine == api::KeychainEngines::BIP49_P2SH || keychainEngine == api::KeychainEngines::BIP173_P2WSH;
+            if (!isHash160Engine && !isScriptEngine) {
+                // BIP350_P2TR: we don't create Taproot addresses from extended pubkey.
+                throw make_exception(api::ErrorCode::INVALID_ARGUMENT, "Invalid Keychain Engine: ", keychainEngine);
+            }
+
+            // Every child shares the same parent, hash it only once
+            const auto fingerprint = _key.getFingerprint();
+            std::vector<std::string> addresses(childNums.size());
+            std::vector<size_t> positions(childNums.size());
+            std::iota(positions.begin(), positions.end(), 0);
+
+            std::mutex errorMutex;
+            std::exception_ptr error;
+            Concurrency::parallel_for_each(positions.begin(), positions.end(), [&](size_t position) {
+                try {
+                    auto child   = _key.derive(childNums[position], fingerprint);
+                    auto hash160 = isHash160Engine ? child.getPublicKeyHash160()
+                                                   : BitcoinLikeAddress::fromPublicKeyToHash160(child.getPublicKey(), child.getPublicKeyHash160(), _currency, keychainEngine);
+                    addresses[position] = BitcoinLikeAddress(_currency, hash160, keychainEngine).toString();
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(errorMutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+            });
+            if (error) {
+                std::rethrow_exception(error);
+            }
+            return addresses;
+        }
+
         std::string BitcoinLikeExtendedPublicKey::toBase58() {
             return BitcoinExtendedPublicKey::toBase58();
         }
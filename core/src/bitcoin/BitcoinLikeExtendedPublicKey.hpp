@@ -52,6 +52,13 @@ namespace ledger {
             std::shared_ptr<api::BitcoinLikeAddress> derive(const std::string &path) override;
             std::shared_ptr<BitcoinLikeExtendedPublicKey> derive(const DerivationPath &path);
 
+            /**
+             * Derive the addresses of the given direct (non-hardened) children of this key, spreading the work
+             * over the available cores. Results are returned in the same order as childNums and match
+             * BitcoinLikeAddress::fromPublicKey(this, currency, "<childNum>", keychainEngine).
+             */
+            std::vector<std::string> deriveChildrenAddresses(const std::vector<uint32_t> &childNums, const std::string &keychainEngine);
+
             std::vector<uint8_t> derivePublicKey(const std::string &path) override;
 
             std::vector<uint8_t> deriveHash160(const std::string &path) override;
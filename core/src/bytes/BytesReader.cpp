@@ -163,18 +163,14 @@ namespace ledger {
             uint8_t size = readNextByte();
             switch (size) {
             case 0xFD:
-                size = 2;
-                break;
+                return readNextLeUint16();
             case 0xFE:
-                size = 4;
-                break;
+                return readNextLeUint();
             case 0xFF:
-                size = 8;
-                break;
+                return readNextLeUlong();
             default:
                 return size;
             }
-            return readNextLeBigInt(size).toUint64();
         }
 
         std::string BytesReader::readNextVarString() {
@@ -191,10 +187,11 @@ namespace ledger {
         }
 
         void BytesReader::read(unsigned long length, std::vector<uint8_t> &data) {
-            for (auto i = 0; i < length; i++) {
-                data[i] = _bytes[_cursor];
-                seek(1, Seek::CUR);
+            if (length > available()) {
+                throw std::out_of_range(fmt::format("Offset [{}] is too high (maximum value is {})", _cursor + length, _offset + _length));
             }
+            std::copy(_bytes.begin() + _cursor, _bytes.begin() + _cursor + length, data.begin());
+            _cursor += length;
         }
 
         uint16_t BytesReader::readNextBeUint16() {
@@ -96,6 +96,10 @@ namespace ledger {
         }
 
         DeterministicPublicKey DeterministicPublicKey::derive(uint32_t childIndex) const {
+            return derive(childIndex, getFingerprint());
+        }
+
+        DeterministicPublicKey DeterministicPublicKey::derive(uint32_t childIndex, uint32_t fingerprint) const {
             if (childIndex & 0x80000000) {
                 throw Exception(api::ErrorCode::PRIVATE_DERIVATION_NOT_SUPPORTED, "Private derivation is not supported by DeterministicPublicKey");
             }
@@ -117,7 +121,7 @@ namespace ledger {
                 IR,
                 childIndex,
                 _depth + 1,
-                getFingerprint(),
+                fingerprint,
                 _networkIdentifier);
         }
 
@@ -48,6 +48,11 @@ namespace ledger {
             DeterministicPublicKey(const DeterministicPublicKey &key);
             uint32_t getFingerprint() const;
             DeterministicPublicKey derive(uint32_t childIndex) const;
+            /**
+             * Same as derive(childIndex) with the fingerprint of this key already computed. Use it when
+             * deriving many children of the same key to avoid hashing the parent for every child.
+             */
+            DeterministicPublicKey derive(uint32_t childIndex, uint32_t fingerprint) const;
 
             const std::vector<uint8_t> &getPublicKey() const;
             std::vector<uint8_t> getUncompressedPublicKey() const;
@@ -36,6 +36,26 @@
 
 namespace ledger {
     namespace core {
+        struct SHA256::Hasher::Context {
+            SHA256_CTX sha256;
+        };
+
+        SHA256::Hasher::Hasher() : _context(new Context()) {
+            SHA256_Init(&_context->sha256);
+        }
+
+        SHA256::Hasher::~Hasher() = default;
+
+        void SHA256::Hasher::update(const uint8_t *data, size_t size) {
+            SHA256_Update(&_context->sha256, data, size);
+        }
+
+        std::vector<uint8_t> SHA256::Hasher::finalize() {
+            uint8_t hash[SHA256_DIGEST_LENGTH];
+            SHA256_Final(hash, &_context->sha256);
+            return std::vector<uint8_t>(hash, hash + SHA256_DIGEST_LENGTH);
+        }
+
         std::string SHA256::stringToHexHash(const std::string &input) {
             return hex::toString(SHA256::stringToBytesHash(input));
         }
@@ -31,6 +31,7 @@
 #ifndef LEDGER_CORE_SHA256_HPP
 #define LEDGER_CORE_SHA256_HPP
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -38,6 +39,25 @@ namespace ledger {
     namespace core {
         class SHA256 {
           public:
+            /**
+             * Incremental hasher, to digest a message made of several chunks without
+             * concatenating them first.
+             */
+            class Hasher {
+              public:
+                Hasher();
+                ~Hasher();
+                Hasher(const Hasher &)            = delete;
+                Hasher &operator=(const Hasher &) = delete;
+
+                void update(const uint8_t *data, size_t size);
+                std::vector<uint8_t> finalize();
+
+              private:
+                struct Context;
+                std::unique_ptr<Context> _context;
+            };
+
             static std::string stringToHexHash(const std::string &input);
             static std::string bytesToHexHash(const std::vector<uint8_t> &bytes);
             static std::vector<uint8_t> stringToBytesHash(const std::string &input);
@@ -107,6 +107,7 @@ namespace ledger {
                 if (_logger != nullptr) {
                     session.set_log_stream(_logger);
                 }
+                attachStatementCache(session);
             }
 
             _type = api::DatabaseBackendType::POSTGRESQL;
@@ -123,10 +124,17 @@ namespace ledger {
                 if (_logger != nullptr) {
                     session.set_log_stream(_logger);
                 }
+                attachStatementCache(session);
             }
         }
 
         DatabaseSessionPool::~DatabaseSessionPool() {
+            for (size_t i = 0; i < _backend->getConnectionPoolSize(); i++) {
+                StatementCache::detach(getPool().at(i));
+            }
+            for (size_t i = 0; i < _backend->getReadonlyConnectionPoolSize(); i++) {
+                StatementCache::detach(getReadonlyPool().at(i));
+            }
             delete _logger;
         }
 
@@ -155,6 +163,7 @@ namespace ledger {
         }
 
         void DatabaseSessionPool::performDatabaseMigration() {
+            invalidateStatementCaches();
             soci::session sql(getPool());
             int version = getDatabaseMigrationVersion(sql);
 
@@ -164,6 +173,7 @@ namespace ledger {
         }
 
         void DatabaseSessionPool::performDatabaseRollback() {
+            invalidateStatementCaches();
             soci::session sql(getPool());
             int version = getDatabaseMigrationVersion(sql);
 
@@ -184,5 +194,26 @@ namespace ledger {
         bool DatabaseSessionPool::isPostgres() const {
             return std::dynamic_pointer_cast<PostgreSQLBackend>(_backend) != nullptr;
         }
+
+        bool DatabaseSessionPool::isSaturated() {
+            std::size_t position;
+            if (!_pool.try_lease(position, 0)) {
+                return true;
+            }
+            _pool.give_back(position);
+            return false;
+        }
+
+        void DatabaseSessionPool::invalidateStatementCaches() {
+            for (const auto &cache : _statementCaches) {
+                cache->invalidate();
+            }
+        }
+
+        void DatabaseSessionPool::attachStatementCache(soci::session &session) {
+            auto cache = std::make_shared<StatementCache>();
+            StatementCache::attach(session, cache);
+            _statementCaches.push_back(cache);
+        }
     } // namespace core
 } // namespace ledger
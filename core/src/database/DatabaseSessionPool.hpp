@@ -37,6 +37,7 @@
 #include <api/ExecutionContext.hpp>
 #include <async/Future.hpp>
 #include <database/DatabaseBackend.hpp>
+#include <database/StatementCache.hpp>
 #include <debug/LoggerStreamBuffer.h>
 #include <soci.h>
 
@@ -63,21 +64,29 @@ namespace ledger {
                 const std::string &dbName,
                 const std::string &password = "");
 
-            static const int CURRENT_DATABASE_SCHEME_VERSION = 32;
+            static const int CURRENT_DATABASE_SCHEME_VERSION = 36;
 
             void performDatabaseMigration();
             void performDatabaseRollback();
             void performChangePassword(const std::string &oldPassword,
                                        const std::string &newPassword);
             bool isPostgres() const;
+            // True when no read-write session can be leased right now
+            bool isSaturated();
+            // Drops the cached prepared statements of every connection
+            void invalidateStatementCaches();
 
           private:
+            void attachStatementCache(soci::session &session);
+
             std::shared_ptr<DatabaseBackend> _backend;
             soci::connection_pool _pool;
             soci::connection_pool _readonlyPool;
             std::ostream *_logger;
             LoggerStreamBuffer _buffer;
             api::DatabaseBackendType _type;
+            // Destroyed before the connections, the statements are deallocated on them
+            std::vector<std::shared_ptr<StatementCache>> _statementCaches;
         };
     } // namespace core
 } // namespace ledger
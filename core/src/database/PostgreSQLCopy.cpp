@@ -0,0 +1,167 @@
+/*
+ *
+ * PostgreSQLCopy.cpp
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#include "PostgreSQLCopy.hpp"
+
+#include <cstring>
+#include <soci-postgresql.h>
+#include <utils/DateUtils.hpp>
+#include <utils/Exception.hpp>
+
+namespace {
+    // Rows are handed to libpq in chunks of this size
+    const std::size_t COPY_CHUNK_SIZE = 64 * 1024;
+
+    const char COPY_SIGNATURE[] = {'P', 'G', 'C', 'O', 'P', 'Y', '\n', '\377', '\r', '\n', '\0'};
+
+    template <typename T>
+    void appendBigEndian(std::vector<char> &buffer, T value) {
+        for (int shift = (sizeof(T) - 1) * 8; shift >= 0; shift -= 8) {
+            buffer.push_back(static_cast<char>((static_cast<uint64_t>(value) >> shift) & 0xFF));
+        }
+    }
+} // namespace
+
+namespace ledger {
+    namespace core {
+
+        PostgreSQLCopyWriter::PostgreSQLCopyWriter(soci::session &sql,
+                                                   const std::string &table,
+                                                   const std::vector<std::string> &columns) : _fields(static_cast<int16_t>(columns.size())), _ended(false) {
+            auto backend = dynamic_cast<soci::postgresql_session_backend *>(sql.get_backend());
+            if (backend == nullptr) {
+                throw make_exception(api::ErrorCode::DATABASE_EXCEPTION, "COPY is only available on PostgreSQL sessions");
+            }
+            _connection = backend->conn_;
+
+            std::stringstream names;
+            strings::join(columns, names, ", ");
+            auto query  = fmt::format("COPY {} ({}) FROM STDIN (FORMAT binary)", table, names.str());
+            auto result = PQexec(_connection, query.c_str());
+            auto status = PQresultStatus(result);
+            PQclear(result);
+            if (status != PGRES_COPY_IN) {
+                throw make_exception(api::ErrorCode::DATABASE_EXCEPTION, "Unable to start copy to {}: {}", table, PQerrorMessage(_connection));
+            }
+
+            _buffer.reserve(COPY_CHUNK_SIZE * 2);
+            _buffer.insert(_buffer.end(), std::begin(COPY_SIGNATURE), std::end(COPY_SIGNATURE));
+            // Flags and header extension length
+            appendBigEndian<int32_t>(_buffer, 0);
+            appendBigEndian<int32_t>(_buffer, 0);
+        }
+
+        PostgreSQLCopyWriter::~PostgreSQLCopyWriter() {
+            if (!_ended) {
+                // Leave the connection usable when rows could not be written, the enclosing
+                // transaction is rolled back by the caller
+                PQputCopyEnd(_connection, "aborted");
+                while (auto result = PQgetResult(_connection)) {
+                    PQclear(result);
+                }
+            }
+        }
+
+        PostgreSQLCopyWriter &PostgreSQLCopyWriter::row() {
+            flush(false);
+            appendBigEndian<int16_t>(_buffer, _fields);
+            return *this;
+        }
+
+        PostgreSQLCopyWriter &PostgreSQLCopyWriter::null() {
+            appendBigEndian<int32_t>(_buffer, -1);
+            return *this;
+        }
+
+        PostgreSQLCopyWriter &PostgreSQLCopyWriter::text(const std::string &value) {
+            writeField(value.data(), static_cast<int32_t>(value.size()));
+            return *this;
+        }
+
+        PostgreSQLCopyWriter &PostgreSQLCopyWriter::text(const Option<std::string> &value) {
+            return value.hasValue() ? text(value.getValue()) : null();
+        }
+
+        PostgreSQLCopyWriter &PostgreSQLCopyWriter::date(const std::chrono::system_clock::time_point &value) {
+            // Dates are stored as their JSON representation, see soci-date.h
+            return text(DateUtils::toJSON(value));
+        }
+
+        PostgreSQLCopyWriter &PostgreSQLCopyWriter::int4(int32_t value) {
+            appendBigEndian<int32_t>(_buffer, sizeof(value));
+            appendBigEndian(_buffer, value);
+            return *this;
+        }
+
+        PostgreSQLCopyWriter &PostgreSQLCopyWriter::int8(int64_t value) {
+            appendBigEndian<int32_t>(_buffer, sizeof(value));
+            appendBigEndian(_buffer, value);
+            return *this;
+        }
+
+        void PostgreSQLCopyWriter::end() {
+            appendBigEndian<int16_t>(_buffer, -1);
+            flush(true);
+            _ended = true;
+            if (PQputCopyEnd(_connection, nullptr) != 1) {
+                throw make_exception(api::ErrorCode::DATABASE_EXCEPTION, "Unable to end copy: {}", PQerrorMessage(_connection));
+            }
+            std::string error;
+            while (auto result = PQgetResult(_connection)) {
+                if (PQresultStatus(result) != PGRES_COMMAND_OK && error.empty()) {
+                    error = PQresultErrorMessage(result);
+                }
+                PQclear(result);
+            }
+            if (!error.empty()) {
+                throw make_exception(api::ErrorCode::DATABASE_EXCEPTION, "Copy failed: {}", error);
+            }
+        }
+
+        bool PostgreSQLCopyWriter::isSupported(soci::session &sql) {
+            return dynamic_cast<soci::postgresql_session_backend *>(sql.get_backend()) != nullptr;
+        }
+
+        void PostgreSQLCopyWriter::writeField(const char *data, int32_t length) {
+            appendBigEndian<int32_t>(_buffer, length);
+            _buffer.insert(_buffer.end(), data, data + length);
+        }
+
+        void PostgreSQLCopyWriter::flush(bool force) {
+            if (_buffer.empty() || (!force && _buffer.size() < COPY_CHUNK_SIZE)) {
+                return;
+            }
+            if (PQputCopyData(_connection, _buffer.data(), static_cast<int>(_buffer.size())) != 1) {
+                throw make_exception(api::ErrorCode::DATABASE_EXCEPTION, "Unable to copy rows: {}", PQerrorMessage(_connection));
+            }
+            _buffer.clear();
+        }
+    } // namespace core
+} // namespace ledger
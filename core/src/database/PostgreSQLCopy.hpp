@@ -0,0 +1,159 @@
+/*
+ *
+ * PostgreSQLCopy.hpp
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#ifndef LEDGER_CORE_POSTGRESQLCOPY_HPP
+#define LEDGER_CORE_POSTGRESQLCOPY_HPP
+
+#include <chrono>
+#include <collections/strings.hpp>
+#include <fmt/format.h>
+#include <functional>
+#include <soci.h>
+#include <sstream>
+#include <string>
+#include <utils/Option.hpp>
+#include <vector>
+
+struct pg_conn;
+
+namespace ledger {
+    namespace core {
+
+        /**
+         * Streams rows to a table with COPY ... FROM STDIN (FORMAT binary). Values are sent in
+         * the binary wire format so they must match the column types exactly: int4 for INTEGER,
+         * int8 for BIGINT and text for VARCHAR and TEXT columns.
+         */
+        class PostgreSQLCopyWriter {
+          public:
+            PostgreSQLCopyWriter(soci::session &sql, const std::string &table, const std::vector<std::string> &columns);
+            ~PostgreSQLCopyWriter();
+
+            PostgreSQLCopyWriter &row();
+            PostgreSQLCopyWriter &null();
+            PostgreSQLCopyWriter &text(const std::string &value);
+            PostgreSQLCopyWriter &text(const Option<std::string> &value);
+            PostgreSQLCopyWriter &date(const std::chrono::system_clock::time_point &value);
+            PostgreSQLCopyWriter &int4(int32_t value);
+            PostgreSQLCopyWriter &int8(int64_t value);
+
+            template <typename T>
+            PostgreSQLCopyWriter &int4(const Option<T> &value) {
+                return value.hasValue() ? int4(static_cast<int32_t>(value.getValue())) : null();
+            }
+
+            template <typename T>
+            PostgreSQLCopyWriter &int8(const Option<T> &value) {
+                return value.hasValue() ? int8(static_cast<int64_t>(value.getValue())) : null();
+            }
+
+            // Sends the trailer and waits for the server to acknowledge the copied rows
+            void end();
+
+            // True when the session is backed by libpq, which is required to stream COPY data
+            static bool isSupported(soci::session &sql);
+
+          private:
+            void writeField(const char *data, int32_t length);
+            void flush(bool force);
+
+            pg_conn *_connection;
+            std::vector<char> _buffer;
+            int16_t _fields;
+            bool _ended;
+        };
+
+        /**
+         * Set-based counterpart of StatementDeclaration for PostgreSQL. Rows are copied into a
+         * temporary staging table shaped like the target table, then merged with a single
+         * INSERT ... SELECT ... ON CONFLICT. Staging tables are session local and never written
+         * to the WAL, so concurrent connections can stage the same table safely.
+         * Rows staged twice for the same key are merged once, picking the row the row by row
+         * upsert would have kept: the first one when conflicts are ignored, the last one otherwise.
+         */
+        template <class Bindings>
+        class CopyDeclaration {
+          public:
+            using WriteFunction = std::function<void(PostgreSQLCopyWriter &, const Bindings &)>;
+
+            CopyDeclaration(const std::string &table,
+                            const std::vector<std::string> &columns,
+                            const std::string &key,
+                            const std::string &onConflict,
+                            const WriteFunction &writer)
+                : _table(table), _columns(columns), _writer(writer) {
+                const auto staging = _table + "_staging";
+                std::stringstream names;
+                strings::join(_columns, names, ", ");
+                // COPY leaves the sequence column to its default, which numbers rows in the order they were streamed
+                _prepare  = fmt::format("CREATE TEMPORARY TABLE IF NOT EXISTS {} (LIKE {} INCLUDING DEFAULTS, {} BIGSERIAL)",
+                                        staging, _table, STAGING_SEQUENCE);
+                _truncate = fmt::format("TRUNCATE {}", staging);
+                _merge    = fmt::format("INSERT INTO {0} ({1}) SELECT DISTINCT ON ({2}) {1} FROM {3} ORDER BY {2}, {4} {5} "
+                                        "ON CONFLICT ({2}) {6}",
+                                        _table, names.str(), key, staging, STAGING_SEQUENCE,
+                                        onConflict == "DO NOTHING" ? "ASC" : "DESC", onConflict);
+            }
+
+            void operator()(soci::session &sql, const Bindings &bindings) const {
+                sql << _prepare;
+                sql << _truncate;
+                PostgreSQLCopyWriter writer(sql, _table + "_staging", _columns);
+                _writer(writer, bindings);
+                writer.end();
+                sql << _merge;
+            }
+
+          private:
+            static constexpr const char *STAGING_SEQUENCE = "staging_sequence";
+
+            std::string _table;
+            std::vector<std::string> _columns;
+            WriteFunction _writer;
+            std::string _prepare;
+            std::string _truncate;
+            std::string _merge;
+        };
+
+        namespace db {
+            template <class Bindings>
+            CopyDeclaration<Bindings> copy(const std::string &table,
+                                           const std::vector<std::string> &columns,
+                                           const std::string &key,
+                                           const std::string &onConflict,
+                                           const typename CopyDeclaration<Bindings>::WriteFunction &writer) {
+                return CopyDeclaration<Bindings>(table, columns, key, onConflict, writer);
+            }
+        } // namespace db
+
+    } // namespace core
+} // namespace ledger
+
+#endif // LEDGER_CORE_POSTGRESQLCOPY_HPP
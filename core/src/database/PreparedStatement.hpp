@@ -67,6 +67,10 @@ namespace ledger {
                 out.statement = (prepare);
             }
 
+            const std::string &getQuery() const {
+                return _query;
+            }
+
           private:
             std::string _query;
             BindFunction _binder;
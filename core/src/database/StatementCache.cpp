@@ -0,0 +1,96 @@
+/*
+ *
+ * StatementCache
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#include "StatementCache.hpp"
+
+namespace ledger {
+    namespace core {
+        namespace {
+            std::mutex registryLock;
+            std::unordered_map<soci::details::session_backend *, std::weak_ptr<StatementCache>> registry;
+        } // namespace
+
+        const std::size_t StatementCache::DEFAULT_CAPACITY;
+
+        StatementCache::StatementCache(std::size_t capacity) : _stale(false), _capacity(capacity), _stats{0, 0, 0} {
+        }
+
+        std::shared_ptr<StatementCache> StatementCache::of(soci::session &sql) {
+            std::lock_guard<std::mutex> lock(registryLock);
+            auto it = registry.find(sql.get_backend());
+            return it == registry.end() ? nullptr : it->second.lock();
+        }
+
+        void StatementCache::attach(soci::session &sql, const std::shared_ptr<StatementCache> &cache) {
+            std::lock_guard<std::mutex> lock(registryLock);
+            registry[sql.get_backend()] = cache;
+        }
+
+        void StatementCache::detach(soci::session &sql) {
+            std::lock_guard<std::mutex> lock(registryLock);
+            registry.erase(sql.get_backend());
+        }
+
+        void StatementCache::invalidate() {
+            std::lock_guard<std::mutex> lock(_lock);
+            _stale = true;
+        }
+
+        std::size_t StatementCache::size() const {
+            std::lock_guard<std::mutex> lock(_lock);
+            return _entries.size();
+        }
+
+        StatementCache::Stats StatementCache::getStats() const {
+            std::lock_guard<std::mutex> lock(_lock);
+            return _stats;
+        }
+
+        void StatementCache::clear() {
+            // Statements in use are dropped when released
+            _entries.clear();
+            _index.clear();
+            _stale = false;
+        }
+
+        void StatementCache::evict() {
+            auto it = _entries.end();
+            while (_entries.size() > _capacity && it != _entries.begin()) {
+                --it;
+                // Statements in use are evicted once released
+                if (!it->inUse) {
+                    _index.erase(it->key);
+                    it = _entries.erase(it);
+                    _stats.evictions += 1;
+                }
+            }
+        }
+    } // namespace core
+} // namespace ledger
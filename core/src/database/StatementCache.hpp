@@ -0,0 +1,198 @@
+/*
+ *
+ * StatementCache
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#ifndef LEDGER_CORE_STATEMENTCACHE_HPP
+#define LEDGER_CORE_STATEMENTCACHE_HPP
+
+#include <database/PreparedStatement.hpp>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <soci.h>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+
+namespace ledger {
+    namespace core {
+
+        /**
+         * Prepared statements of a single database connection, keyed by their SQL text and
+         * evicting the least recently used statements first. Preparing a statement once per
+         * connection spares PostgreSQL from parsing and planning the query on every call.
+         *
+         * Caches are attached to the connections of the DatabaseSessionPool and found back from
+         * any session leased from them. Statements are only prepared and dropped by the session
+         * currently using the connection, invalidating a cache from another thread (migrations)
+         * only marks its statements as stale.
+         */
+        class StatementCache {
+          public:
+            static const std::size_t DEFAULT_CAPACITY = 64;
+
+            struct Stats {
+                uint64_t hits;
+                uint64_t misses;
+                uint64_t evictions;
+            };
+
+            explicit StatementCache(std::size_t capacity = DEFAULT_CAPACITY);
+
+            // Cache of the connection of the session, null when the session is not attached to one
+            static std::shared_ptr<StatementCache> of(soci::session &sql);
+            static void attach(soci::session &sql, const std::shared_ptr<StatementCache> &cache);
+            static void detach(soci::session &sql);
+
+            template <class Bindings>
+            std::shared_ptr<PreparedStatement<Bindings>> acquire(soci::session &sql, const StatementDeclaration<Bindings> &declaration) {
+                std::lock_guard<std::mutex> lock(_lock);
+                if (_stale) {
+                    clear();
+                }
+                auto key = Key{declaration.getQuery(), std::type_index(typeid(Bindings))};
+                auto it  = _index.find(key);
+                if (it != _index.end() && !it->second->inUse) {
+                    _entries.splice(_entries.begin(), _entries, it->second);
+                    it->second->inUse = true;
+                    _stats.hits += 1;
+                    return std::static_pointer_cast<PreparedStatement<Bindings>>(it->second->statement);
+                }
+                _stats.misses += 1;
+                auto statement = std::make_shared<PreparedStatement<Bindings>>();
+                declaration(sql, *statement);
+                // A statement already in use by the caller (reentrant call) is not replaced
+                if (it == _index.end() && _capacity > 0) {
+                    _entries.push_front(Entry{key, statement, true});
+                    _index[key] = _entries.begin();
+                    evict();
+                }
+                return statement;
+            }
+
+            template <class Bindings>
+            void release(const StatementDeclaration<Bindings> &declaration, const std::shared_ptr<PreparedStatement<Bindings>> &statement, bool reusable) {
+                std::lock_guard<std::mutex> lock(_lock);
+                auto it = _index.find(Key{declaration.getQuery(), std::type_index(typeid(Bindings))});
+                if (it == _index.end() || it->second->statement != statement) {
+                    return;
+                }
+                it->second->inUse = false;
+                if (!reusable) {
+                    _entries.erase(it->second);
+                    _index.erase(it);
+                }
+            }
+
+            // Drops every statement before the next use of the connection, e.g. when the schema of the database changed
+            void invalidate();
+            std::size_t size() const;
+            Stats getStats() const;
+
+          private:
+            struct Key {
+                std::string query;
+                std::type_index bindings;
+
+                bool operator==(const Key &other) const {
+                    return query == other.query && bindings == other.bindings;
+                }
+            };
+
+            struct KeyHash {
+                std::size_t operator()(const Key &key) const {
+                    return std::hash<std::string>()(key.query) ^ key.bindings.hash_code();
+                }
+            };
+
+            struct Entry {
+                Key key;
+                std::shared_ptr<void> statement;
+                bool inUse;
+            };
+
+            using Entries = std::list<Entry>;
+
+            void evict();
+            void clear();
+
+            mutable std::mutex _lock;
+            bool _stale;
+            std::size_t _capacity;
+            Entries _entries;
+            std::unordered_map<Key, Entries::iterator, KeyHash> _index;
+            Stats _stats;
+        };
+
+        namespace db {
+            template <class Bindings>
+            struct StatementLease {
+                StatementLease(const std::shared_ptr<StatementCache> &cache, soci::session &sql, const StatementDeclaration<Bindings> &declaration)
+                    : cache(cache), declaration(declaration), statement(cache->acquire(sql, declaration)), reusable(true) {
+                }
+
+                ~StatementLease() {
+                    cache->release(declaration, statement, reusable);
+                }
+
+                std::shared_ptr<StatementCache> cache;
+                const StatementDeclaration<Bindings> &declaration;
+                std::shared_ptr<PreparedStatement<Bindings>> statement;
+                bool reusable;
+            };
+
+            /**
+             * Runs the function with the prepared statement of the declaration, taken from the
+             * statement cache of the session when it has one. Bindings keep the values of the
+             * previous call, so the function must set every input and output it relies on.
+             */
+            template <class Bindings, class Function>
+            auto withStatement(soci::session &sql, const StatementDeclaration<Bindings> &declaration, Function function)
+                -> decltype(function(std::declval<PreparedStatement<Bindings> &>())) {
+                auto cache = StatementCache::of(sql);
+                if (!cache) {
+                    PreparedStatement<Bindings> statement;
+                    declaration(sql, statement);
+                    return function(statement);
+                }
+                StatementLease<Bindings> lease(cache, sql, declaration);
+                try {
+                    return function(*lease.statement);
+                } catch (...) {
+                    // The statement may be left in an undefined state, prepare it again next time
+                    lease.reusable = false;
+                    throw;
+                }
+            }
+        } // namespace db
+    } // namespace core
+} // namespace ledger
+
+#endif // LEDGER_CORE_STATEMENTCACHE_HPP
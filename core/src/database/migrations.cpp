@@ -1275,5 +1275,74 @@ namespace ledger {
         void rollback<32>(soci::session &sql, api::DatabaseBackendType /*type*/) {
             sql << "ALTER TABLE bitcoin_accounts DROP COLUMN balance;";
         }
+
+        template <>
+        void migrate<33>(soci::session &sql, api::DatabaseBackendType /*type*/) {
+            sql << "CREATE TABLE balance_checkpoints("
+                   "account_uid VARCHAR(255) NOT NULL REFERENCES accounts(uid) ON DELETE CASCADE,"
+                   "date VARCHAR(255) NOT NULL,"
+                   "balance VARCHAR(255) NOT NULL,"
+                   "PRIMARY KEY (account_uid, date)"
+                   ")";
+        }
+
+        template <>
+        void rollback<33>(soci::session &sql, api::DatabaseBackendType /*type*/) {
+            sql << "DROP TABLE balance_checkpoints";
+        }
+
+        template <>
+        void migrate<34>(soci::session &sql, api::DatabaseBackendType /*type*/) {
+            // Unspent outputs of bitcoin accounts, maintained at synchronization time
+            sql << "CREATE TABLE bitcoin_utxos("
+                   "idx INTEGER NOT NULL,"
+                   "transaction_uid VARCHAR(255) NOT NULL,"
+                   "account_uid VARCHAR(255) NOT NULL,"
+                   "amount BIGINT NOT NULL,"
+                   "PRIMARY KEY (idx, transaction_uid),"
+                   "FOREIGN KEY (idx, transaction_uid) REFERENCES bitcoin_outputs(idx, transaction_uid) ON DELETE CASCADE"
+                   ")";
+            sql << "CREATE INDEX bitcoin_utxos_account_uid_index ON bitcoin_utxos(account_uid)";
+            sql << "CREATE INDEX bitcoin_inputs_previous_output_index ON bitcoin_inputs(previous_tx_uid, previous_output_idx)";
+            sql << "INSERT INTO bitcoin_utxos "
+                   "SELECT o.idx, o.transaction_uid, o.account_uid, o.amount FROM bitcoin_outputs AS o "
+                   "LEFT OUTER JOIN bitcoin_inputs AS i ON i.previous_tx_uid = o.transaction_uid "
+                   "AND i.previous_output_idx = o.idx "
+                   "WHERE i.previous_tx_uid IS NULL AND o.account_uid IS NOT NULL";
+        }
+
+        template <>
+        void rollback<34>(soci::session &sql, api::DatabaseBackendType /*type*/) {
+            sql << "DROP INDEX bitcoin_inputs_previous_output_index";
+            sql << "DROP TABLE bitcoin_utxos";
+        }
+
+        template <>
+        void migrate<35>(soci::session &sql, api::DatabaseBackendType /*type*/) {
+            // Operation cursors seek on (date, uid) within the accounts of their query
+            sql << "CREATE INDEX operations_account_uid_date_uid_index ON operations(account_uid, date, uid)";
+        }
+
+        template <>
+        void rollback<35>(soci::session &sql, api::DatabaseBackendType /*type*/) {
+            sql << "DROP INDEX operations_account_uid_date_uid_index";
+        }
+
+        template <>
+        void migrate<36>(soci::session &sql, api::DatabaseBackendType /*type*/) {
+            sql << "CREATE TABLE erc20_balance_checkpoints("
+                   "account_uid VARCHAR(255) NOT NULL REFERENCES erc20_accounts(uid) ON DELETE CASCADE,"
+                   "date VARCHAR(255) NOT NULL,"
+                   "balance VARCHAR(255) NOT NULL,"
+                   "PRIMARY KEY (account_uid, date)"
+                   ")";
+            sql << "CREATE INDEX erc20_operations_account_date_index ON erc20_operations(account_uid, date)";
+        }
+
+        template <>
+        void rollback<36>(soci::session &sql, api::DatabaseBackendType /*type*/) {
+            sql << "DROP INDEX erc20_operations_account_date_index";
+            sql << "DROP TABLE erc20_balance_checkpoints";
+        }
     } // namespace core
 } // namespace ledger
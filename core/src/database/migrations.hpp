@@ -299,6 +299,30 @@ namespace ledger {
         void migrate<32>(soci::session &sql, api::DatabaseBackendType type);
         template <>
         void rollback<32>(soci::session &sql, api::DatabaseBackendType type);
+
+        // add balance checkpoints
+        template <>
+        void migrate<33>(soci::session &sql, api::DatabaseBackendType type);
+        template <>
+        void rollback<33>(soci::session &sql, api::DatabaseBackendType type);
+
+        // add materialized bitcoin UTXO set
+        template <>
+        void migrate<34>(soci::session &sql, api::DatabaseBackendType type);
+        template <>
+        void rollback<34>(soci::session &sql, api::DatabaseBackendType type);
+
+        // add keyset pagination index on operations
+        template <>
+        void migrate<35>(soci::session &sql, api::DatabaseBackendType type);
+        template <>
+        void rollback<35>(soci::session &sql, api::DatabaseBackendType type);
+
+        // add ERC20 balance checkpoints
+        template <>
+        void migrate<36>(soci::session &sql, api::DatabaseBackendType type);
+        template <>
+        void rollback<36>(soci::session &sql, api::DatabaseBackendType type);
     } // namespace core
 } // namespace ledger
 
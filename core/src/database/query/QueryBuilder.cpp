@@ -46,17 +46,33 @@ namespace ledger {
                 }
             }
 
-            if (_filter) {
+            const auto seekAfter = _seek.nonEmpty() && _seek.getValue().bindAfter;
+            if (_filter && seekAfter) {
+                query << " WHERE (" << _filter->getHead()->toString() << ") AND ";
+            } else if (_filter) {
                 query << " WHERE ";
                 std::string sFilter = _filter->getHead()->toString();
                 query << sFilter;
+            } else if (seekAfter) {
+                query << " WHERE ";
+            }
+            if (seekAfter) {
+                const auto &seek = _seek.getValue();
+                const auto op    = seek.descending ? " < " : " > ";
+                // A row value comparison is a range condition on a (key, uid) index, unlike the
+                // equivalent OR of comparisons
+                query << "(" << seek.key << ", " << seek.uid << ")" << op << "(:seek_key, :seek_uid)";
             }
 
             if (!_group.empty()) {
                 query << " GROUP BY " << _group;
             }
 
-            if (!_order.empty()) {
+            if (_seek.nonEmpty()) {
+                const auto &seek      = _seek.getValue();
+                const auto direction = seek.descending ? " DESC" : " ASC";
+                query << " ORDER BY " << seek.key << direction << ", " << seek.uid << direction;
+            } else if (!_order.empty()) {
                 query << " ORDER BY ";
                 for (auto it = _order.begin(); it != _order.end(); it++) {
                     auto &order = *it;
@@ -79,6 +95,9 @@ namespace ledger {
             if (_filter) {
                 _filter->getHead()->bindValue(statement);
             }
+            if (seekAfter) {
+                _seek.getValue().bindAfter(statement);
+            }
             return statement;
         }
 
@@ -142,5 +161,10 @@ namespace ledger {
             return *this;
         }
 
+        QueryBuilder &QueryBuilder::seek(const std::string &key, const std::string &uid, bool descending) {
+            _seek = Seek{key, uid, descending, nullptr};
+            return *this;
+        }
+
     } // namespace core
 } // namespace ledger
\ No newline at end of file
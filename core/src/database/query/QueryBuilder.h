@@ -33,6 +33,7 @@
 
 #include "QueryFilter.h"
 
+#include <functional>
 #include <list>
 #include <soci.h>
 #include <tuple>
@@ -57,11 +58,35 @@ namespace ledger {
             QueryBuilder &limit(int32_t limit);
             QueryBuilder &offset(int32_t offset);
             QueryBuilder &groupBy(std::string group);
+
+            /**
+             * Keyset pagination: order rows by (key, uid) and, once a position is given, only keep
+             * the rows strictly after it. Replaces any order() and should be used instead of offset(),
+             * so that rows before the page are not scanned when (key, uid) is indexed.
+             */
+            QueryBuilder &seek(const std::string &key, const std::string &uid, bool descending);
+            template <typename T>
+            QueryBuilder &seek(const std::string &key, const std::string &uid, bool descending, const T &afterKey, const std::string &afterUid) {
+                seek(key, uid, descending);
+                _seek.getValue().bindAfter = [afterKey, afterUid](soci::details::prepare_temp_type &statement) {
+                    statement, soci::use(afterKey), soci::use(afterUid);
+                };
+                return *this;
+            }
+
             soci::details::prepare_temp_type execute(soci::session &sql);
 
           private:
             using LeftOuterJoin = std::tuple<std::string, std::string>;
 
+            struct Seek {
+                std::string key;
+                std::string uid;
+                bool descending;
+                // Binds the position to start after, empty for the first page
+                std::function<void(soci::details::prepare_temp_type &)> bindAfter;
+            };
+
             std::string _keys;
             std::string _table;
             std::string _output;
@@ -71,6 +96,7 @@ namespace ledger {
             std::shared_ptr<QueryFilter> _filter;
             Option<int32_t> _limit;
             Option<int32_t> _offset;
+            Option<Seek> _seek;
         };
     } // namespace core
 } // namespace ledger
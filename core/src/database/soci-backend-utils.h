@@ -32,13 +32,42 @@
 #ifndef LEDGER_CORE_SOCI_BACKEND_UTILS_H
 #define LEDGER_CORE_SOCI_BACKEND_UTILS_H
 
+#include <algorithm>
+#include <fmt/format.h>
 #include <soci.h>
+#include <string>
+#include <vector>
 
 namespace soci {
 
     bool is_sqlite_backend(soci::session &sql);
     bool is_postgres_backend(soci::session &sql);
 
+    // Keeps bound parameters well below the SQLite limit (999)
+    static const std::size_t MAX_IN_CLAUSE_VALUES = 500;
+
+    // Runs a query whose {} marker is expanded into one placeholder per value, so that a whole
+    // set of values is bound to a single IN clause instead of executing the query once per
+    // value as binding a vector does. Large sets are split in chunks of MAX_IN_CLAUSE_VALUES.
+    template <typename T, typename RowHandler>
+    void for_each_row_in(soci::session &sql, const std::string &query, const std::vector<T> &values, RowHandler handler) {
+        for (std::size_t offset = 0; offset < values.size(); offset += MAX_IN_CLAUSE_VALUES) {
+            const auto end = std::min(values.size(), offset + MAX_IN_CLAUSE_VALUES);
+            std::string placeholders;
+            for (auto index = offset; index < end; index++) {
+                placeholders += fmt::format(index == offset ? ":v{}" : ", :v{}", index - offset);
+            }
+            details::prepare_temp_type prepared = (sql.prepare << fmt::format(query, placeholders));
+            for (auto index = offset; index < end; index++) {
+                prepared, use(values[index]);
+            }
+            rowset<row> rows(prepared);
+            for (auto &r : rows) {
+                handler(r);
+            }
+        }
+    }
+
 } // namespace soci
 
 #endif // LEDGER_CORE_SOCI_BACKEND_UTILS_H
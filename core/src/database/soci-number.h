@@ -33,6 +33,7 @@
 
 #include <boost/lexical_cast.hpp>
 #include <math/BigInt.h>
+#include <math/Int256.h>
 #include <soci.h>
 #include <utils/Exception.hpp>
 
@@ -50,6 +51,19 @@ namespace soci {
         }
     };
 
+    // Amounts are stored as hexadecimal strings
+    template <>
+    struct type_conversion<ledger::core::UInt256> {
+        typedef std::string base_type;
+        static void from_base(base_type const &in, indicator ind, ledger::core::UInt256 &out) {
+            out = ledger::core::UInt256::fromHex(in);
+        }
+
+        static void to_base(ledger::core::UInt256 const &in, base_type &out, indicator &ind) {
+            out = in.toHexString();
+        }
+    };
+
     template <typename T>
     T get_number(const row &row, std::size_t pos) {
         auto prop = row.get_properties(pos);
@@ -9,6 +9,7 @@
 #include "BitcoinLikeOutputListCallback.hpp"
 #include "BitcoinLikePickingStrategy.hpp"
 #include "BitcoinLikeTransaction.hpp"
+#include "BitcoinLikeTransactionBatchCallback.hpp"
 #include "BitcoinLikeTransactionBuilder.hpp"
 #include "I32Callback.hpp"
 #include "Marshal.hpp"
@@ -79,6 +80,17 @@ CJNIEXPORT jobject JNICALL Java_co_ledger_core_BitcoinLikeAccount_00024CppProxy_
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
+CJNIEXPORT void JNICALL Java_co_ledger_core_BitcoinLikeAccount_00024CppProxy_native_1buildTransactions(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jobject j_builders, jboolean j_partial, jobject j_callback)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        const auto& ref = ::djinni::objectFromHandleAddress<::ledger::core::api::BitcoinLikeAccount>(nativeRef);
+        ref->buildTransactions(::djinni::List<::djinni_generated::BitcoinLikeTransactionBuilder>::toCpp(jniEnv, j_builders),
+                               ::djinni::Bool::toCpp(jniEnv, j_partial),
+                               ::djinni_generated::BitcoinLikeTransactionBatchCallback::toCpp(jniEnv, j_callback));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
 CJNIEXPORT void JNICALL Java_co_ledger_core_BitcoinLikeAccount_00024CppProxy_native_1getFees(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jobject j_callback)
 {
     try {
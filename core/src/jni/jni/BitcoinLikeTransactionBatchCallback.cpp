@@ -0,0 +1,30 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from bitcoin_like_wallet.djinni
+
+#include "BitcoinLikeTransactionBatchCallback.hpp"  // my header
+#include "BitcoinLikeTransaction.hpp"
+#include "Error.hpp"
+#include "Marshal.hpp"
+
+namespace djinni_generated {
+
+BitcoinLikeTransactionBatchCallback::BitcoinLikeTransactionBatchCallback() : ::djinni::JniInterface<::ledger::core::api::BitcoinLikeTransactionBatchCallback, BitcoinLikeTransactionBatchCallback>() {}
+
+BitcoinLikeTransactionBatchCallback::~BitcoinLikeTransactionBatchCallback() = default;
+
+BitcoinLikeTransactionBatchCallback::JavaProxy::JavaProxy(JniType j) : Handle(::djinni::jniGetThreadEnv(), j) { }
+
+BitcoinLikeTransactionBatchCallback::JavaProxy::~JavaProxy() = default;
+
+void BitcoinLikeTransactionBatchCallback::JavaProxy::onTransaction(int32_t c_index, const std::shared_ptr<::ledger::core::api::BitcoinLikeTransaction> & c_result, const std::experimental::optional<::ledger::core::api::Error> & c_error) {
+    auto jniEnv = ::djinni::jniGetThreadEnv();
+    ::djinni::JniLocalScope jscope(jniEnv, 10);
+    const auto& data = ::djinni::JniClass<::djinni_generated::BitcoinLikeTransactionBatchCallback>::get();
+    jniEnv->CallVoidMethod(Handle::get().get(), data.method_onTransaction,
+                           ::djinni::get(::djinni::I32::fromCpp(jniEnv, c_index)),
+                           ::djinni::get(::djinni::Optional<std::experimental::optional, ::djinni_generated::BitcoinLikeTransaction>::fromCpp(jniEnv, c_result)),
+                           ::djinni::get(::djinni::Optional<std::experimental::optional, ::djinni_generated::Error>::fromCpp(jniEnv, c_error)));
+    ::djinni::jniExceptionCheck(jniEnv);
+}
+
+}  // namespace djinni_generated
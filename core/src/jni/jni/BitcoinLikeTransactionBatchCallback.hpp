@@ -0,0 +1,48 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from bitcoin_like_wallet.djinni
+
+#ifndef DJINNI_GENERATED_BITCOINLIKETRANSACTIONBATCHCALLBACK_HPP_JNI_
+#define DJINNI_GENERATED_BITCOINLIKETRANSACTIONBATCHCALLBACK_HPP_JNI_
+
+#include "../../api/BitcoinLikeTransactionBatchCallback.hpp"
+#include "djinni_support.hpp"
+
+namespace djinni_generated {
+
+class BitcoinLikeTransactionBatchCallback final : ::djinni::JniInterface<::ledger::core::api::BitcoinLikeTransactionBatchCallback, BitcoinLikeTransactionBatchCallback> {
+public:
+    using CppType = std::shared_ptr<::ledger::core::api::BitcoinLikeTransactionBatchCallback>;
+    using CppOptType = std::shared_ptr<::ledger::core::api::BitcoinLikeTransactionBatchCallback>;
+    using JniType = jobject;
+
+    using Boxed = BitcoinLikeTransactionBatchCallback;
+
+    ~BitcoinLikeTransactionBatchCallback();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<BitcoinLikeTransactionBatchCallback>::get()._fromJava(jniEnv, j); }
+    static ::djinni::LocalRef<JniType> fromCppOpt(JNIEnv* jniEnv, const CppOptType& c) { return {jniEnv, ::djinni::JniClass<BitcoinLikeTransactionBatchCallback>::get()._toJava(jniEnv, c)}; }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return fromCppOpt(jniEnv, c); }
+
+private:
+    BitcoinLikeTransactionBatchCallback();
+    friend ::djinni::JniClass<BitcoinLikeTransactionBatchCallback>;
+    friend ::djinni::JniInterface<::ledger::core::api::BitcoinLikeTransactionBatchCallback, BitcoinLikeTransactionBatchCallback>;
+
+    class JavaProxy final : ::djinni::JavaProxyHandle<JavaProxy>, public ::ledger::core::api::BitcoinLikeTransactionBatchCallback
+    {
+    public:
+        JavaProxy(JniType j);
+        ~JavaProxy();
+
+        void onTransaction(int32_t index, const std::shared_ptr<::ledger::core::api::BitcoinLikeTransaction> & result, const std::experimental::optional<::ledger::core::api::Error> & error) override;
+
+    private:
+        friend ::djinni::JniInterface<::ledger::core::api::BitcoinLikeTransactionBatchCallback, ::djinni_generated::BitcoinLikeTransactionBatchCallback>;
+    };
+
+    const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("co/ledger/core/BitcoinLikeTransactionBatchCallback") };
+    const jmethodID method_onTransaction { ::djinni::jniGetMethodID(clazz.get(), "onTransaction", "(ILco/ledger/core/BitcoinLikeTransaction;Lco/ledger/core/Error;)V") };
+};
+
+}  // namespace djinni_generated
+#endif //DJINNI_GENERATED_BITCOINLIKETRANSACTIONBATCHCALLBACK_HPP_JNI_
@@ -0,0 +1,30 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from erc20.djinni
+
+#include "ERC20Balance.hpp"  // my header
+#include "Marshal.hpp"
+
+namespace djinni_generated {
+
+ERC20Balance::ERC20Balance() = default;
+
+ERC20Balance::~ERC20Balance() = default;
+
+auto ERC20Balance::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
+    const auto& data = ::djinni::JniClass<ERC20Balance>::get();
+    auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject(data.clazz.get(), data.jconstructor,
+                                                           ::djinni::get(::djinni::String::fromCpp(jniEnv, c.contractAddress)),
+                                                           ::djinni::get(::djinni::String::fromCpp(jniEnv, c.balance)))};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
+auto ERC20Balance::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
+    ::djinni::JniLocalScope jscope(jniEnv, 3);
+    assert(j != nullptr);
+    const auto& data = ::djinni::JniClass<ERC20Balance>::get();
+    return {::djinni::String::toCpp(jniEnv, (jstring)jniEnv->GetObjectField(j, data.field_contractAddress)),
+            ::djinni::String::toCpp(jniEnv, (jstring)jniEnv->GetObjectField(j, data.field_balance))};
+}
+
+}  // namespace djinni_generated
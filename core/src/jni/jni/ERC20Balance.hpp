@@ -0,0 +1,35 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from erc20.djinni
+
+#ifndef DJINNI_GENERATED_ERC20BALANCE_HPP_JNI_
+#define DJINNI_GENERATED_ERC20BALANCE_HPP_JNI_
+
+#include "../../api/ERC20Balance.hpp"
+#include "djinni_support.hpp"
+
+namespace djinni_generated {
+
+class ERC20Balance final {
+public:
+    using CppType = ::ledger::core::api::ERC20Balance;
+    using JniType = jobject;
+
+    using Boxed = ERC20Balance;
+
+    ~ERC20Balance();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+
+private:
+    ERC20Balance();
+    friend ::djinni::JniClass<ERC20Balance>;
+
+    const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("co/ledger/core/ERC20Balance") };
+    const jmethodID jconstructor { ::djinni::jniGetMethodID(clazz.get(), "<init>", "(Ljava/lang/String;Ljava/lang/String;)V") };
+    const jfieldID field_contractAddress { ::djinni::jniGetFieldID(clazz.get(), "contractAddress", "Ljava/lang/String;") };
+    const jfieldID field_balance { ::djinni::jniGetFieldID(clazz.get(), "balance", "Ljava/lang/String;") };
+};
+
+}  // namespace djinni_generated
+#endif //DJINNI_GENERATED_ERC20BALANCE_HPP_JNI_
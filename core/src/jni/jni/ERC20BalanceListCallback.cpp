@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from callback.djinni
+
+#include "ERC20BalanceListCallback.hpp"  // my header
+#include "ERC20Balance.hpp"
+#include "Error.hpp"
+#include "Marshal.hpp"
+
+namespace djinni_generated {
+
+ERC20BalanceListCallback::ERC20BalanceListCallback() : ::djinni::JniInterface<::ledger::core::api::ERC20BalanceListCallback, ERC20BalanceListCallback>() {}
+
+ERC20BalanceListCallback::~ERC20BalanceListCallback() = default;
+
+ERC20BalanceListCallback::JavaProxy::JavaProxy(JniType j) : Handle(::djinni::jniGetThreadEnv(), j) { }
+
+ERC20BalanceListCallback::JavaProxy::~JavaProxy() = default;
+
+void ERC20BalanceListCallback::JavaProxy::onCallback(const std::experimental::optional<std::vector<::ledger::core::api::ERC20Balance>> & c_result, const std::experimental::optional<::ledger::core::api::Error> & c_error) {
+    auto jniEnv = ::djinni::jniGetThreadEnv();
+    ::djinni::JniLocalScope jscope(jniEnv, 10);
+    const auto& data = ::djinni::JniClass<::djinni_generated::ERC20BalanceListCallback>::get();
+    jniEnv->CallVoidMethod(Handle::get().get(), data.method_onCallback,
+                           ::djinni::get(::djinni::Optional<std::experimental::optional, ::djinni::List<::djinni_generated::ERC20Balance>>::fromCpp(jniEnv, c_result)),
+                           ::djinni::get(::djinni::Optional<std::experimental::optional, ::djinni_generated::Error>::fromCpp(jniEnv, c_error)));
+    ::djinni::jniExceptionCheck(jniEnv);
+}
+
+}  // namespace djinni_generated
@@ -0,0 +1,48 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from callback.djinni
+
+#ifndef DJINNI_GENERATED_ERC20BALANCELISTCALLBACK_HPP_JNI_
+#define DJINNI_GENERATED_ERC20BALANCELISTCALLBACK_HPP_JNI_
+
+#include "../../api/ERC20BalanceListCallback.hpp"
+#include "djinni_support.hpp"
+
+namespace djinni_generated {
+
+class ERC20BalanceListCallback final : ::djinni::JniInterface<::ledger::core::api::ERC20BalanceListCallback, ERC20BalanceListCallback> {
+public:
+    using CppType = std::shared_ptr<::ledger::core::api::ERC20BalanceListCallback>;
+    using CppOptType = std::shared_ptr<::ledger::core::api::ERC20BalanceListCallback>;
+    using JniType = jobject;
+
+    using Boxed = ERC20BalanceListCallback;
+
+    ~ERC20BalanceListCallback();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<ERC20BalanceListCallback>::get()._fromJava(jniEnv, j); }
+    static ::djinni::LocalRef<JniType> fromCppOpt(JNIEnv* jniEnv, const CppOptType& c) { return {jniEnv, ::djinni::JniClass<ERC20BalanceListCallback>::get()._toJava(jniEnv, c)}; }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return fromCppOpt(jniEnv, c); }
+
+private:
+    ERC20BalanceListCallback();
+    friend ::djinni::JniClass<ERC20BalanceListCallback>;
+    friend ::djinni::JniInterface<::ledger::core::api::ERC20BalanceListCallback, ERC20BalanceListCallback>;
+
+    class JavaProxy final : ::djinni::JavaProxyHandle<JavaProxy>, public ::ledger::core::api::ERC20BalanceListCallback
+    {
+    public:
+        JavaProxy(JniType j);
+        ~JavaProxy();
+
+        void onCallback(const std::experimental::optional<std::vector<::ledger::core::api::ERC20Balance>> & result, const std::experimental::optional<::ledger::core::api::Error> & error) override;
+
+    private:
+        friend ::djinni::JniInterface<::ledger::core::api::ERC20BalanceListCallback, ::djinni_generated::ERC20BalanceListCallback>;
+    };
+
+    const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("co/ledger/core/ERC20BalanceListCallback") };
+    const jmethodID method_onCallback { ::djinni::jniGetMethodID(clazz.get(), "onCallback", "(Ljava/util/ArrayList;Lco/ledger/core/Error;)V") };
+};
+
+}  // namespace djinni_generated
+#endif //DJINNI_GENERATED_ERC20BALANCELISTCALLBACK_HPP_JNI_
@@ -4,6 +4,7 @@
 #include "EthereumLikeAccount.hpp"  // my header
 #include "BigIntCallback.hpp"
 #include "BigIntListCallback.hpp"
+#include "ERC20BalanceListCallback.hpp"
 #include "ERC20LikeAccount.hpp"
 #include "EthereumGasLimitRequest.hpp"
 #include "EthereumLikeTransaction.hpp"
@@ -116,4 +117,13 @@ CJNIEXPORT void JNICALL Java_co_ledger_core_EthereumLikeAccount_00024CppProxy_na
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
 }
 
+CJNIEXPORT void JNICALL Java_co_ledger_core_EthereumLikeAccount_00024CppProxy_native_1getAllERC20Balances(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jobject j_callback)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        const auto& ref = ::djinni::objectFromHandleAddress<::ledger::core::api::EthereumLikeAccount>(nativeRef);
+        ref->getAllERC20Balances(::djinni_generated::ERC20BalanceListCallback::toCpp(jniEnv, j_callback));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
 }  // namespace djinni_generated
@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from callback.djinni
+
+#include "EventCodeCallback.hpp"  // my header
+#include "Error.hpp"
+#include "EventCode.hpp"
+#include "Marshal.hpp"
+
+namespace djinni_generated {
+
+EventCodeCallback::EventCodeCallback() : ::djinni::JniInterface<::ledger::core::api::EventCodeCallback, EventCodeCallback>() {}
+
+EventCodeCallback::~EventCodeCallback() = default;
+
+EventCodeCallback::JavaProxy::JavaProxy(JniType j) : Handle(::djinni::jniGetThreadEnv(), j) { }
+
+EventCodeCallback::JavaProxy::~JavaProxy() = default;
+
+void EventCodeCallback::JavaProxy::onCallback(std::experimental::optional<::ledger::core::api::EventCode> c_result, const std::experimental::optional<::ledger::core::api::Error> & c_error) {
+    auto jniEnv = ::djinni::jniGetThreadEnv();
+    ::djinni::JniLocalScope jscope(jniEnv, 10);
+    const auto& data = ::djinni::JniClass<::djinni_generated::EventCodeCallback>::get();
+    jniEnv->CallVoidMethod(Handle::get().get(), data.method_onCallback,
+                           ::djinni::get(::djinni::Optional<std::experimental::optional, ::djinni_generated::EventCode>::fromCpp(jniEnv, c_result)),
+                           ::djinni::get(::djinni::Optional<std::experimental::optional, ::djinni_generated::Error>::fromCpp(jniEnv, c_error)));
+    ::djinni::jniExceptionCheck(jniEnv);
+}
+
+}  // namespace djinni_generated
@@ -0,0 +1,48 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from callback.djinni
+
+#ifndef DJINNI_GENERATED_EVENTCODECALLBACK_HPP_JNI_
+#define DJINNI_GENERATED_EVENTCODECALLBACK_HPP_JNI_
+
+#include "../../api/EventCodeCallback.hpp"
+#include "djinni_support.hpp"
+
+namespace djinni_generated {
+
+class EventCodeCallback final : ::djinni::JniInterface<::ledger::core::api::EventCodeCallback, EventCodeCallback> {
+public:
+    using CppType = std::shared_ptr<::ledger::core::api::EventCodeCallback>;
+    using CppOptType = std::shared_ptr<::ledger::core::api::EventCodeCallback>;
+    using JniType = jobject;
+
+    using Boxed = EventCodeCallback;
+
+    ~EventCodeCallback();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<EventCodeCallback>::get()._fromJava(jniEnv, j); }
+    static ::djinni::LocalRef<JniType> fromCppOpt(JNIEnv* jniEnv, const CppOptType& c) { return {jniEnv, ::djinni::JniClass<EventCodeCallback>::get()._toJava(jniEnv, c)}; }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return fromCppOpt(jniEnv, c); }
+
+private:
+    EventCodeCallback();
+    friend ::djinni::JniClass<EventCodeCallback>;
+    friend ::djinni::JniInterface<::ledger::core::api::EventCodeCallback, EventCodeCallback>;
+
+    class JavaProxy final : ::djinni::JavaProxyHandle<JavaProxy>, public ::ledger::core::api::EventCodeCallback
+    {
+    public:
+        JavaProxy(JniType j);
+        ~JavaProxy();
+
+        void onCallback(std::experimental::optional<::ledger::core::api::EventCode> result, const std::experimental::optional<::ledger::core::api::Error> & error) override;
+
+    private:
+        friend ::djinni::JniInterface<::ledger::core::api::EventCodeCallback, ::djinni_generated::EventCodeCallback>;
+    };
+
+    const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("co/ledger/core/EventCodeCallback") };
+    const jmethodID method_onCallback { ::djinni::jniGetMethodID(clazz.get(), "onCallback", "(Lco/ledger/core/EventCode;Lco/ledger/core/Error;)V") };
+};
+
+}  // namespace djinni_generated
+#endif //DJINNI_GENERATED_EVENTCODECALLBACK_HPP_JNI_
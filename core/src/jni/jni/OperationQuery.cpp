@@ -4,6 +4,7 @@
 #include "OperationQuery.hpp"  // my header
 #include "Marshal.hpp"
 #include "OperationCountListCallback.hpp"
+#include "OperationCursor.hpp"
 #include "OperationListCallback.hpp"
 #include "OperationOrderKey.hpp"
 #include "QueryFilter.hpp"
@@ -102,4 +103,16 @@ CJNIEXPORT void JNICALL Java_co_ledger_core_OperationQuery_00024CppProxy_native_
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
 }
 
+CJNIEXPORT jobject JNICALL Java_co_ledger_core_OperationQuery_00024CppProxy_native_1cursor(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jobject j_key, jboolean j_descending, jint j_chunkSize)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        const auto& ref = ::djinni::objectFromHandleAddress<::ledger::core::api::OperationQuery>(nativeRef);
+        auto r = ref->cursor(::djinni_generated::OperationOrderKey::toCpp(jniEnv, j_key),
+                             ::djinni::Bool::toCpp(jniEnv, j_descending),
+                             ::djinni::I32::toCpp(jniEnv, j_chunkSize));
+        return ::djinni::release(::djinni_generated::OperationCursor::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
 }  // namespace djinni_generated
@@ -2,6 +2,7 @@
 // This file generated by Djinni from wallet_pool.djinni
 
 #include "WalletPool.hpp"  // my header
+#include "Account.hpp"
 #include "BlockCallback.hpp"
 #include "CoreTracer.hpp"
 #include "Currency.hpp"
@@ -11,6 +12,7 @@
 #include "DynamicObject.hpp"
 #include "ErrorCodeCallback.hpp"
 #include "EventBus.hpp"
+#include "EventCodeCallback.hpp"
 #include "HttpClient.hpp"
 #include "I32Callback.hpp"
 #include "LogPrinter.hpp"
@@ -180,6 +182,17 @@ CJNIEXPORT jobject JNICALL Java_co_ledger_core_WalletPool_00024CppProxy_native_1
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
+CJNIEXPORT void JNICALL Java_co_ledger_core_WalletPool_00024CppProxy_native_1scheduleSynchronization(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jobject j_account, jboolean j_interactive, jobject j_callback)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        const auto& ref = ::djinni::objectFromHandleAddress<::ledger::core::api::WalletPool>(nativeRef);
+        ref->scheduleSynchronization(::djinni_generated::Account::toCpp(jniEnv, j_account),
+                                     ::djinni::Bool::toCpp(jniEnv, j_interactive),
+                                     ::djinni_generated::EventCodeCallback::toCpp(jniEnv, j_callback));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
 CJNIEXPORT void JNICALL Java_co_ledger_core_WalletPool_00024CppProxy_native_1eraseDataSince(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jobject j_date, jobject j_callback)
 {
     try {
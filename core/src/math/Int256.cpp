@@ -0,0 +1,202 @@
+/*
+ *
+ * Int256
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#include "Int256.h"
+
+#include <algorithm>
+#include <utils/Exception.hpp>
+
+namespace ledger {
+    namespace core {
+        static constexpr uint32_t DECIMAL_CHUNK      = 1000000000;
+        static constexpr size_t DECIMAL_CHUNK_DIGITS = 9;
+        static constexpr const char *HEX_DIGITS      = "0123456789abcdef";
+        static constexpr size_t BYTES_COUNT          = UInt256::LIMBS_COUNT * sizeof(uint32_t);
+
+        static int hexDigitValue(char c) {
+            if (c >= '0' && c <= '9') {
+                return c - '0';
+            } else if (c >= 'a' && c <= 'f') {
+                return c - 'a' + 10;
+            } else if (c >= 'A' && c <= 'F') {
+                return c - 'A' + 10;
+            }
+            return -1;
+        }
+
+        void UInt256::throwOverflow() {
+            throw make_exception(api::ErrorCode::OUT_OF_RANGE, "256 bits integer overflow");
+        }
+
+        uint32_t UInt256::divide(uint32_t divisor) {
+            uint64_t remainder = 0;
+            for (auto index = LIMBS_COUNT; index > 0; index--) {
+                auto dividend     = (remainder << 32) | _limbs[index - 1];
+                _limbs[index - 1] = static_cast<uint32_t>(dividend / divisor);
+                remainder         = dividend % divisor;
+            }
+            return static_cast<uint32_t>(remainder);
+        }
+
+        UInt256 &UInt256::multiplyAdd(uint32_t factor, uint32_t addend) {
+            uint64_t carry = addend;
+            for (size_t index = 0; index < LIMBS_COUNT; index++) {
+                carry += static_cast<uint64_t>(_limbs[index]) * factor;
+                _limbs[index] = static_cast<uint32_t>(carry);
+                carry >>= 32;
+            }
+            if (carry != 0) {
+                throwOverflow();
+            }
+            return *this;
+        }
+
+        UInt256 UInt256::fromHex(const std::string &str) {
+            auto begin = std::find_if(str.begin(), str.end(), [](char c) { return c != '0'; });
+            if (std::distance(begin, str.end()) > static_cast<std::ptrdiff_t>(BYTES_COUNT * 2)) {
+                throw make_exception(api::ErrorCode::OUT_OF_RANGE, "Hexadecimal number {} does not fit in 256 bits", str);
+            }
+            UInt256 result;
+            size_t shift = 0;
+            for (auto it = str.rbegin(); it != std::string::const_reverse_iterator(begin); ++it, shift += 4) {
+                auto value = hexDigitValue(*it);
+                if (value < 0) {
+                    throw make_exception(api::ErrorCode::INVALID_ARGUMENT, "Invalid hexadecimal number {}", str);
+                }
+                result._limbs[shift / 32] |= static_cast<uint32_t>(value) << (shift % 32);
+            }
+            return result;
+        }
+
+        UInt256 UInt256::fromDecimal(const std::string &str) {
+            if (str.empty()) {
+                throw make_exception(api::ErrorCode::INVALID_ARGUMENT, "Invalid decimal number {}", str);
+            }
+            UInt256 result;
+            for (auto c : str) {
+                if (c < '0' || c > '9') {
+                    throw make_exception(api::ErrorCode::INVALID_ARGUMENT, "Invalid decimal number {}", str);
+                }
+                result.multiplyAdd(10, static_cast<uint32_t>(c - '0'));
+            }
+            return result;
+        }
+
+        UInt256 UInt256::fromBigInt(const BigInt &value) {
+            if (value.isNegative()) {
+                throw make_exception(api::ErrorCode::OUT_OF_RANGE, "Negative number {} cannot be an unsigned 256 bits integer", value.toString());
+            }
+            auto bytes = value.toByteArray();
+            auto begin = std::find_if(bytes.begin(), bytes.end(), [](uint8_t b) { return b != 0; });
+            if (std::distance(begin, bytes.end()) > static_cast<std::ptrdiff_t>(BYTES_COUNT)) {
+                throw make_exception(api::ErrorCode::OUT_OF_RANGE, "Number {} does not fit in 256 bits", value.toString());
+            }
+            UInt256 result;
+            size_t shift = 0;
+            for (auto it = bytes.rbegin(); it != std::vector<uint8_t>::reverse_iterator(begin); ++it, shift += 8) {
+                result._limbs[shift / 32] |= static_cast<uint32_t>(*it) << (shift % 32);
+            }
+            return result;
+        }
+
+        BigInt UInt256::toBigInt() const {
+            uint8_t bytes[BYTES_COUNT];
+            for (size_t index = 0; index < BYTES_COUNT; index++) {
+                auto limb                      = _limbs[index / 4];
+                bytes[BYTES_COUNT - 1 - index] = static_cast<uint8_t>(limb >> (8 * (index % 4)));
+            }
+            return BigInt(bytes, BYTES_COUNT, false);
+        }
+
+        std::string UInt256::toString() const {
+            if (isZero()) {
+                return "0";
+            }
+            // Peel 9 decimal digits at a time to keep the number of divisions low
+            std::string out;
+            UInt256 quotient(*this);
+            while (!quotient.isZero()) {
+                auto chunk = quotient.divide(DECIMAL_CHUNK);
+                for (size_t digit = 0; digit < DECIMAL_CHUNK_DIGITS && (chunk != 0 || !quotient.isZero()); digit++) {
+                    out.push_back(static_cast<char>('0' + chunk % 10));
+                    chunk /= 10;
+                }
+            }
+            std::reverse(out.begin(), out.end());
+            return out;
+        }
+
+        std::string UInt256::toHexString() const {
+            std::string out;
+            for (auto index = LIMBS_COUNT; index > 0; index--) {
+                auto limb = _limbs[index - 1];
+                for (auto shift = 28; shift >= 0; shift -= 4) {
+                    auto digit = (limb >> shift) & 0xF;
+                    if (!out.empty() || digit != 0) {
+                        out.push_back(HEX_DIGITS[digit]);
+                    }
+                }
+            }
+            if (out.size() % 2 != 0) {
+                out.insert(out.begin(), '0');
+            }
+            return out.empty() ? "00" : out;
+        }
+
+        uint64_t UInt256::toUint64() const {
+            for (size_t index = 2; index < LIMBS_COUNT; index++) {
+                if (_limbs[index] != 0) {
+                    throw make_exception(api::ErrorCode::OUT_OF_RANGE, "Number {} does not fit in 64 bits", toString());
+                }
+            }
+            return (static_cast<uint64_t>(_limbs[1]) << 32) | _limbs[0];
+        }
+
+        Int256 Int256::fromDecimal(const std::string &str) {
+            if (!str.empty() && (str[0] == '-' || str[0] == '+')) {
+                return Int256(UInt256::fromDecimal(str.substr(1)), str[0] == '-');
+            }
+            return Int256(UInt256::fromDecimal(str));
+        }
+
+        Int256 Int256::fromBigInt(const BigInt &value) {
+            return Int256(UInt256::fromBigInt(value.positive()), value.isNegative());
+        }
+
+        BigInt Int256::toBigInt() const {
+            auto out = _magnitude.toBigInt();
+            return _negative ? out.negative() : out;
+        }
+
+        std::string Int256::toString() const {
+            return _negative ? "-" + _magnitude.toString() : _magnitude.toString();
+        }
+    } // namespace core
+} // namespace ledger
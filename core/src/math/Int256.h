@@ -0,0 +1,234 @@
+/*
+ *
+ * Int256
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#ifndef LEDGER_CORE_INT256_H
+#define LEDGER_CORE_INT256_H
+
+#include "BigInt.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace ledger {
+    namespace core {
+
+        /**
+         * Stack allocated unsigned 256 bits integer for amounts folded in loops, where BigInt would
+         * allocate on every operation. Arithmetic throws OUT_OF_RANGE instead of wrapping around.
+         * Only balance histories use it: Operation, Amount and the UTXO picker hold BigInt values
+         * exposed through the API, so parsing them as UInt256 would only add a conversion.
+         * @headerfile Int256.h <ledger/core/math/Int256.h>
+         */
+        class UInt256 {
+          public:
+            static constexpr size_t LIMBS_COUNT = 8;
+
+            constexpr UInt256() : _limbs{} {}
+            constexpr explicit UInt256(uint64_t value) : _limbs{static_cast<uint32_t>(value), static_cast<uint32_t>(value >> 32)} {}
+
+            /**
+             * Creates a new UInt256 from the given hexadecimal encoded string (e.g. "E0A1B3").
+             * Throws INVALID_ARGUMENT on non hexadecimal digits and OUT_OF_RANGE above 256 bits.
+             */
+            static UInt256 fromHex(const std::string &str);
+            /**
+             * Creates a new UInt256 from the given decimal encoded string (e.g. "125").
+             * Throws INVALID_ARGUMENT on non decimal digits and OUT_OF_RANGE above 256 bits.
+             */
+            static UInt256 fromDecimal(const std::string &str);
+            /**
+             * Creates a new UInt256 from the given BigInt, throws OUT_OF_RANGE if it is negative
+             * or does not fit in 256 bits.
+             */
+            static UInt256 fromBigInt(const BigInt &value);
+
+            BigInt toBigInt() const;
+            std::string toString() const;
+            /**
+             * Serializes the number into lower case hexadecimal with an even number of digits,
+             * as BigInt::toHexString does.
+             */
+            std::string toHexString() const;
+            // Throws OUT_OF_RANGE if the number does not fit in 64 bits
+            uint64_t toUint64() const;
+
+            constexpr bool isZero() const {
+                for (auto limb : _limbs) {
+                    if (limb != 0) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            constexpr int compare(const UInt256 &rhs) const {
+                for (auto index = LIMBS_COUNT; index > 0; index--) {
+                    if (_limbs[index - 1] != rhs._limbs[index - 1]) {
+                        return _limbs[index - 1] < rhs._limbs[index - 1] ? -1 : 1;
+                    }
+                }
+                return 0;
+            }
+
+            constexpr UInt256 &operator+=(const UInt256 &rhs) {
+                uint64_t carry = 0;
+                for (size_t index = 0; index < LIMBS_COUNT; index++) {
+                    carry += static_cast<uint64_t>(_limbs[index]) + rhs._limbs[index];
+                    _limbs[index] = static_cast<uint32_t>(carry);
+                    carry >>= 32;
+                }
+                if (carry != 0) {
+                    throwOverflow();
+                }
+                return *this;
+            }
+
+            constexpr UInt256 &operator-=(const UInt256 &rhs) {
+                if (compare(rhs) < 0) {
+                    throwOverflow();
+                }
+                int64_t borrow = 0;
+                for (size_t index = 0; index < LIMBS_COUNT; index++) {
+                    auto difference = static_cast<int64_t>(_limbs[index]) - rhs._limbs[index] - borrow;
+                    borrow          = difference < 0 ? 1 : 0;
+                    _limbs[index]   = static_cast<uint32_t>(difference + (borrow << 32));
+                }
+                return *this;
+            }
+
+            constexpr UInt256 &operator*=(const UInt256 &rhs) {
+                std::array<uint32_t, LIMBS_COUNT> product{};
+                for (size_t i = 0; i < LIMBS_COUNT; i++) {
+                    if (_limbs[i] == 0) {
+                        continue;
+                    }
+                    uint64_t carry = 0;
+                    for (size_t j = 0; j < LIMBS_COUNT; j++) {
+                        if (i + j >= LIMBS_COUNT) {
+                            if (rhs._limbs[j] != 0) {
+                                throwOverflow();
+                            }
+                            continue;
+                        }
+                        carry += static_cast<uint64_t>(_limbs[i]) * rhs._limbs[j] + product[i + j];
+                        product[i + j] = static_cast<uint32_t>(carry);
+                        carry >>= 32;
+                    }
+                    if (carry != 0) {
+                        throwOverflow();
+                    }
+                }
+                _limbs = product;
+                return *this;
+            }
+
+            constexpr UInt256 operator+(const UInt256 &rhs) const { return UInt256(*this) += rhs; }
+            constexpr UInt256 operator-(const UInt256 &rhs) const { return UInt256(*this) -= rhs; }
+            constexpr UInt256 operator*(const UInt256 &rhs) const { return UInt256(*this) *= rhs; }
+
+            constexpr bool operator==(const UInt256 &rhs) const { return compare(rhs) == 0; }
+            constexpr bool operator!=(const UInt256 &rhs) const { return compare(rhs) != 0; }
+            constexpr bool operator<(const UInt256 &rhs) const { return compare(rhs) < 0; }
+            constexpr bool operator<=(const UInt256 &rhs) const { return compare(rhs) <= 0; }
+            constexpr bool operator>(const UInt256 &rhs) const { return compare(rhs) > 0; }
+            constexpr bool operator>=(const UInt256 &rhs) const { return compare(rhs) >= 0; }
+
+          private:
+            static void throwOverflow();
+            // Divides in place and returns the remainder
+            uint32_t divide(uint32_t divisor);
+            UInt256 &multiplyAdd(uint32_t factor, uint32_t addend);
+
+            // Little endian limbs
+            std::array<uint32_t, LIMBS_COUNT> _limbs;
+        };
+
+        /**
+         * Signed counterpart of UInt256, stored as sign and magnitude like BigInt.
+         * @headerfile Int256.h <ledger/core/math/Int256.h>
+         */
+        class Int256 {
+          public:
+            constexpr Int256() : _magnitude(), _negative(false) {}
+            constexpr explicit Int256(int64_t value)
+                : _magnitude(value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value)), _negative(value < 0) {}
+            constexpr explicit Int256(const UInt256 &magnitude, bool negative = false)
+                : _magnitude(magnitude), _negative(negative && !magnitude.isZero()) {}
+
+            // Decimal representation, with an optional leading '-'
+            static Int256 fromDecimal(const std::string &str);
+            static Int256 fromBigInt(const BigInt &value);
+
+            BigInt toBigInt() const;
+            std::string toString() const;
+
+            constexpr const UInt256 &magnitude() const { return _magnitude; }
+            constexpr bool isNegative() const { return _negative; }
+            constexpr bool isZero() const { return _magnitude.isZero(); }
+            constexpr Int256 negative() const { return Int256(_magnitude, !_negative); }
+
+            constexpr int compare(const Int256 &rhs) const {
+                if (_negative != rhs._negative) {
+                    return _negative ? -1 : 1;
+                }
+                auto magnitudes = _magnitude.compare(rhs._magnitude);
+                return _negative ? -magnitudes : magnitudes;
+            }
+
+            constexpr Int256 operator+(const Int256 &rhs) const {
+                if (_negative == rhs._negative) {
+                    return Int256(_magnitude + rhs._magnitude, _negative);
+                }
+                if (_magnitude >= rhs._magnitude) {
+                    return Int256(_magnitude - rhs._magnitude, _negative);
+                }
+                return Int256(rhs._magnitude - _magnitude, rhs._negative);
+            }
+
+            constexpr Int256 operator-(const Int256 &rhs) const { return *this + rhs.negative(); }
+            constexpr Int256 &operator+=(const Int256 &rhs) { return *this = *this + rhs; }
+            constexpr Int256 &operator-=(const Int256 &rhs) { return *this = *this - rhs; }
+
+            constexpr bool operator==(const Int256 &rhs) const { return compare(rhs) == 0; }
+            constexpr bool operator!=(const Int256 &rhs) const { return compare(rhs) != 0; }
+            constexpr bool operator<(const Int256 &rhs) const { return compare(rhs) < 0; }
+            constexpr bool operator<=(const Int256 &rhs) const { return compare(rhs) <= 0; }
+            constexpr bool operator>(const Int256 &rhs) const { return compare(rhs) > 0; }
+            constexpr bool operator>=(const Int256 &rhs) const { return compare(rhs) >= 0; }
+
+          private:
+            UInt256 _magnitude;
+            bool _negative;
+        };
+    } // namespace core
+} // namespace ledger
+
+#endif // LEDGER_CORE_INT256_H
@@ -102,14 +102,19 @@ namespace ledger {
                 _client,
                 _sequentialContext,
                 _threadpoolContext,
-                _logger);
+                _logger,
+                method == api::HttpMethod::GET ? _cache : nullptr);
         }
 
         void HttpClient::setLogger(const std::shared_ptr<spdlog::logger> &logger) {
             _logger = make_option(logger);
         }
 
-        HttpRequest::HttpRequest(api::HttpMethod method, const std::string &url, const std::unordered_map<std::string, std::string> &headers, const std::experimental::optional<std::vector<uint8_t>> &body, const std::shared_ptr<api::HttpClient> &client, const std::shared_ptr<api::ExecutionContext> &sequentialContext, const std::shared_ptr<api::ExecutionContext> &threadpoolContext, const Option<std::shared_ptr<spdlog::logger>> &logger) {
+        void HttpClient::setResponseCache(const std::shared_ptr<HttpResponseCache> &cache) {
+            _cache = cache;
+        }
+
+        HttpRequest::HttpRequest(api::HttpMethod method, const std::string &url, const std::unordered_map<std::string, std::string> &headers, const std::experimental::optional<std::vector<uint8_t>> &body, const std::shared_ptr<api::HttpClient> &client, const std::shared_ptr<api::ExecutionContext> &sequentialContext, const std::shared_ptr<api::ExecutionContext> &threadpoolContext, const Option<std::shared_ptr<spdlog::logger>> &logger, const std::shared_ptr<HttpResponseCache> &cache) {
             _method            = method;
             _url               = url;
             _headers           = headers;
@@ -119,6 +124,7 @@ namespace ledger {
             _threadpoolContext = threadpoolContext;
             _context           = _sequentialContext;
             _logger            = logger;
+            _cache             = cache && cache->isCacheable(url) ? cache : nullptr;
         }
 
         HttpRequest::ApiRequest::ApiRequest(const std::shared_ptr<const ledger::core::HttpRequest> &self) {
@@ -130,16 +136,38 @@ namespace ledger {
         }
 
         Future<std::shared_ptr<api::HttpUrlConnection>> HttpRequest::operator()() const {
-            auto request = std::dynamic_pointer_cast<ApiRequest>(toApiRequest());
+            auto self = std::make_shared<HttpRequest>(*this);
+            std::shared_ptr<HttpResponseCache::Entry> cached;
+            if (_cache) {
+                auto lookup = _cache->lookup(_url);
+                if (lookup.nonEmpty() && lookup->fresh) {
+                    _logger.foreach ([&](const std::shared_ptr<spdlog::logger> &logger) {
+                        logger->info("{} {} - cached", api::to_string(_method), _url);
+                    });
+                    return Future<std::shared_ptr<api::HttpUrlConnection>>::successful(std::make_shared<CachedHttpUrlConnection>(lookup->entry));
+                }
+                if (lookup.nonEmpty() && !lookup->entry->etag.empty()) {
+                    cached                          = lookup->entry;
+                    self->_headers["If-None-Match"] = cached->etag;
+                }
+            }
+            auto request = std::make_shared<ApiRequest>(self);
             _client->execute(request);
             _logger.foreach ([&](const std::shared_ptr<spdlog::logger> &logger) {
                 logger->info("{} {}", api::to_string(request->getMethod()), request->getUrl());
             });
             auto logger = _logger;
-            return request->getFuture().map<std::shared_ptr<api::HttpUrlConnection>>(_context, [=](const std::shared_ptr<api::HttpUrlConnection> &connection) {
+            auto cache  = _cache;
+            return request->getFuture().map<std::shared_ptr<api::HttpUrlConnection>>(_context, [=](const std::shared_ptr<api::HttpUrlConnection> &c) {
+                std::shared_ptr<api::HttpUrlConnection> connection = c;
                 logger.foreach ([&](const std::shared_ptr<spdlog::logger> &l) {
                     l->info("{} {} - {} {}", api::to_string(request->getMethod()), request->getUrl(), connection->getStatusCode(), connection->getStatusText());
                 });
+                if (cached && connection->getStatusCode() == 304) {
+                    connection = std::make_shared<CachedHttpUrlConnection>(cache->refresh(request->getUrl(), cached));
+                } else if (cache && connection->getStatusCode() >= 200 && connection->getStatusCode() < 300) {
+                    connection = std::make_shared<CachedHttpUrlConnection>(cache->store(request->getUrl(), connection));
+                }
                 if (connection->getStatusCode() < 200 || connection->getStatusCode() >= 300) {
                     throw Exception(HttpRequest::getErrorCode(connection->getStatusCode()), connection->getStatusText(),
                                     Option<std::shared_ptr<void>>(std::static_pointer_cast<void>(connection)));
@@ -43,6 +43,7 @@
 #include "../utils/Either.hpp"
 #include "../utils/Option.hpp"
 #include "../utils/optional.hpp"
+#include "HttpResponseCache.hpp"
 #include "HttpUrlConnectionInputStream.hpp"
 
 #include <memory>
@@ -68,7 +69,8 @@ namespace ledger {
                         const std::shared_ptr<api::HttpClient> &client,
                         const std::shared_ptr<api::ExecutionContext> &sequentialContext,
                         const std::shared_ptr<api::ExecutionContext> &threadpoolContext,
-                        const Option<std::shared_ptr<spdlog::logger>> &logger);
+                        const Option<std::shared_ptr<spdlog::logger>> &logger,
+                        const std::shared_ptr<HttpResponseCache> &cache = nullptr);
             Future<std::shared_ptr<api::HttpUrlConnection>> operator()() const;
 
             template <typename Success, typename Failure, typename Handler>
@@ -111,26 +113,31 @@ namespace ledger {
                                         std::static_pointer_cast<void>(c));
                     }
 
-                    const std::vector<uint8_t> &buffer = result.data.value();
-                    std::stringstream ss;
-                    std::copy(buffer.begin(), buffer.end(), std::ostream_iterator<char>(ss, ""));
-                    const std::string str    = ss.str();
-
-                    const int32_t statusCode = c->getStatusCode();
-                    bool isFailure           = statusCode < 200 || statusCode >= 400;
+                    // Parse straight from the body bytes, the body is only turned into a string to report errors
+                    std::vector<uint8_t> buffer = std::move(result.data.value());
+                    const int32_t statusCode    = c->getStatusCode();
+                    bool isFailure              = statusCode < 200 || statusCode >= 400;
                     if (isFailure) {
-                        return Either<Exception, std::shared_ptr<Success>>(make_exception(api::ErrorCode::API_ERROR, "{} - {}: {}", statusCode, c->getStatusText(), str));
+                        return Either<Exception, std::shared_ptr<Success>>(make_exception(api::ErrorCode::API_ERROR, "{} - {}: {}", statusCode, c->getStatusText(), std::string(buffer.begin(), buffer.end())));
+                    }
+
+                    nlohmann::json json;
+                    try {
+                        json = nlohmann::json::parse(buffer.begin(), buffer.end());
+                    } catch (std::exception &e) {
+                        return Either<Exception, std::shared_ptr<Success>>(make_exception(api::ErrorCode::API_ERROR, "Failed to parse response body: {}: {}", e.what(), std::string(buffer.begin(), buffer.end())));
                     }
+                    // The document holds everything from now on, release the raw body before building the result
+                    std::vector<uint8_t>().swap(buffer);
 
                     try {
-                        const auto json = nlohmann::json::parse(str);
-                        Success success;
-                        parse_json<Success, CustomParser>(json, success);
-                        return Either<Exception, std::shared_ptr<Success>>(std::make_shared<Success>(success));
+                        auto success = std::make_shared<Success>();
+                        parse_json<Success, CustomParser>(json, *success);
+                        return Either<Exception, std::shared_ptr<Success>>(success);
                     } catch (Exception &e) {
                         return Either<Exception, std::shared_ptr<Success>>(e);
                     } catch (std::exception &e) {
-                        return Either<Exception, std::shared_ptr<Success>>(make_exception(api::ErrorCode::API_ERROR, "Failed to parse response body: {}: {}", e.what(), str));
+                        return Either<Exception, std::shared_ptr<Success>>(make_exception(api::ErrorCode::API_ERROR, "Failed to parse response body: {}: {}", e.what(), json.dump()));
                     }
                 });
             }
@@ -150,6 +157,7 @@ namespace ledger {
             std::shared_ptr<api::ExecutionContext> _threadpoolContext;
             mutable std::shared_ptr<api::ExecutionContext> _context;
             Option<std::shared_ptr<spdlog::logger>> _logger;
+            std::shared_ptr<HttpResponseCache> _cache;
 
             static api::ErrorCode getErrorCode(int32_t statusCode) {
                 return statusCode >= 200 && statusCode < 300 ? api::ErrorCode::FUTURE_WAS_SUCCESSFULL : statusCode >= 500 ? api::ErrorCode::UNABLE_TO_CONNECT_TO_HOST
@@ -206,6 +214,8 @@ namespace ledger {
             HttpClient &addHeader(const std::string &key, const std::string &value);
             HttpClient &removeHeader(const std::string &key);
             void setLogger(const std::shared_ptr<spdlog::logger> &logger);
+            // GET requests matching a rule of the cache are served from it
+            void setResponseCache(const std::shared_ptr<HttpResponseCache> &cache);
 
           private:
             HttpRequest createRequest(api::HttpMethod method,
@@ -221,6 +231,7 @@ namespace ledger {
             std::shared_ptr<api::ExecutionContext> _threadpoolContext;
             std::unordered_map<std::string, std::string> _headers;
             Option<std::shared_ptr<spdlog::logger>> _logger;
+            std::shared_ptr<HttpResponseCache> _cache;
         };
     } // namespace core
 } // namespace ledger
@@ -0,0 +1,375 @@
+/*
+ *
+ * HttpResponseCache
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#include "HttpResponseCache.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <api/ErrorCode.hpp>
+#include <rapidjson/document.h>
+#include <utils/Exception.hpp>
+
+namespace ledger {
+    namespace core {
+        namespace {
+            const std::string DISK_INDEX_KEY = "index";
+
+            std::string toDiskKey(const std::string &url) {
+                return "entry:" + url;
+            }
+
+            std::string toSlotKey(uint64_t sequence) {
+                return "slot:" + std::to_string(sequence);
+            }
+
+            int64_t now() {
+                return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+            }
+
+            Option<std::string> findHeader(const std::unordered_map<std::string, std::string> &headers, const std::string &name) {
+                for (const auto &header : headers) {
+                    if (header.first.size() == name.size() &&
+                        std::equal(header.first.begin(), header.first.end(), name.begin(), [](char a, char b) {
+                            return std::tolower(a) == std::tolower(b);
+                        })) {
+                        return header.second;
+                    }
+                }
+                return Option<std::string>();
+            }
+        } // namespace
+
+        HttpResponseCache::HttpResponseCache(std::size_t maxMemorySize,
+                                             const std::shared_ptr<Preferences> &disk,
+                                             std::size_t maxDiskSize) : _maxMemorySize(maxMemorySize),
+                                                                        _memorySize(0),
+                                                                        _disk(disk),
+                                                                        _maxDiskSize(maxDiskSize),
+                                                                        _diskIndex{0, 0},
+                                                                        _diskSize(0),
+                                                                        _stats{0, 0, 0} {
+            if (_disk) {
+                loadDiskIndex();
+            }
+        }
+
+        void HttpResponseCache::addImmutableRule(const std::string &urlPattern) {
+            std::lock_guard<std::mutex> lock(_lock);
+            _rules.push_back(Rule{std::regex(urlPattern), std::chrono::seconds(0), true, false});
+        }
+
+        void HttpResponseCache::addRule(const std::string &urlPattern, std::chrono::seconds ttl) {
+            std::lock_guard<std::mutex> lock(_lock);
+            _rules.push_back(Rule{std::regex(urlPattern), ttl, false, false});
+        }
+
+        void HttpResponseCache::addConfirmedRule(const std::string &urlPattern, std::chrono::seconds ttl) {
+            std::lock_guard<std::mutex> lock(_lock);
+            _rules.push_back(Rule{std::regex(urlPattern), ttl, false, true});
+        }
+
+        void HttpResponseCache::addExplorerRules(std::chrono::seconds ttl) {
+            // Ledger API raw transactions
+            addImmutableRule("/transactions/[0-9a-fA-F]{64}/hex$");
+            // Ledger API and Cosmos transactions by hash, stored once in a block and revalidated after the
+            // TTL in case of a reorganization
+            addConfirmedRule("/blockchain/[^/]+/[^/]+/transactions/[0-9a-fA-F]{64}$", ttl);
+            addConfirmedRule("/txs/[0-9a-fA-F]{64}$", ttl);
+            // Cosmos blocks and Tezos transactions count by height, they only change on a reorganization
+            addRule("/blocks/[0-9]+$", ttl);
+            addRule("/operations/transactions/count\\?level=[0-9]+$", ttl);
+        }
+
+        bool HttpResponseCache::isCacheable(const std::string &url) const {
+            return findRule(url).nonEmpty();
+        }
+
+        Option<HttpResponseCache::Lookup> HttpResponseCache::lookup(const std::string &url) {
+            auto rule = findRule(url);
+            if (rule.isEmpty()) {
+                return Option<Lookup>();
+            }
+            std::lock_guard<std::mutex> lock(_lock);
+            std::shared_ptr<Entry> entry;
+            auto it = _index.find(url);
+            if (it != _index.end()) {
+                _entries.splice(_entries.begin(), _entries, it->second);
+                entry = it->second->second;
+            } else if (_disk) {
+                auto stored = _disk->getObject<Entry>(toDiskKey(url));
+                if (stored.nonEmpty()) {
+                    entry = std::make_shared<Entry>(stored.getValue());
+                    putInMemory(url, entry);
+                }
+            }
+            if (!entry) {
+                _stats.misses += 1;
+                return Option<Lookup>();
+            }
+            auto fresh = rule->immutable || now() - entry->storedAt < std::chrono::duration_cast<std::chrono::milliseconds>(rule->ttl).count();
+            if (fresh) {
+                _stats.hits += 1;
+            }
+            return Lookup{entry, fresh};
+        }
+
+        std::shared_ptr<HttpResponseCache::Entry> HttpResponseCache::store(const std::string &url, const std::shared_ptr<api::HttpUrlConnection> &connection) {
+            auto rule  = findRule(url);
+            auto entry        = std::make_shared<Entry>();
+            entry->statusCode = connection->getStatusCode();
+            entry->statusText = connection->getStatusText();
+            entry->headers    = connection->getHeaders();
+            entry->etag       = findHeader(entry->headers, "ETag").getValueOr("");
+            entry->storedAt   = now();
+            while (true) {
+                auto result = connection->readBody();
+                if (result.error) {
+                    throw Exception(result.error.value().code, result.error.value().message, std::static_pointer_cast<void>(connection));
+                }
+                if (!result.data || result.data->empty()) {
+                    break;
+                }
+                entry->body.insert(entry->body.end(), result.data->begin(), result.data->end());
+            }
+
+            if (findHeader(entry->headers, "Cache-Control").getValueOr("").find("no-store") != std::string::npos ||
+                (rule.nonEmpty() && rule->confirmedOnly && !isConfirmed(entry->body))) {
+                return entry;
+            }
+            std::lock_guard<std::mutex> lock(_lock);
+            putInMemory(url, entry);
+            putOnDisk(url, entry);
+            return entry;
+        }
+
+        std::shared_ptr<HttpResponseCache::Entry> HttpResponseCache::refresh(const std::string &url, const std::shared_ptr<Entry> &entry) {
+            auto refreshed      = std::make_shared<Entry>(*entry);
+            refreshed->storedAt = now();
+            std::lock_guard<std::mutex> lock(_lock);
+            _stats.revalidations += 1;
+            putInMemory(url, refreshed);
+            putOnDisk(url, refreshed);
+            return refreshed;
+        }
+
+        void HttpResponseCache::clear() {
+            std::lock_guard<std::mutex> lock(_lock);
+            _entries.clear();
+            _index.clear();
+            _memorySize = 0;
+            if (_disk) {
+                auto editor = _disk->editor();
+                for (const auto &slot : _diskSlots) {
+                    editor->remove(toDiskKey(slot.second.url));
+                    editor->remove(toSlotKey(slot.first));
+                }
+                _diskSlots.clear();
+                _diskSequences.clear();
+                _diskIndex.first = _diskIndex.next;
+                _diskSize        = 0;
+                editor->putObject(DISK_INDEX_KEY, _diskIndex);
+                editor->commit();
+            }
+        }
+
+        HttpResponseCache::Stats HttpResponseCache::getStats() const {
+            std::lock_guard<std::mutex> lock(_lock);
+            return _stats;
+        }
+
+        std::size_t HttpResponseCache::getMemorySize() const {
+            std::lock_guard<std::mutex> lock(_lock);
+            return _memorySize;
+        }
+
+        Option<HttpResponseCache::Rule> HttpResponseCache::findRule(const std::string &url) const {
+            std::lock_guard<std::mutex> lock(_lock);
+            for (const auto &rule : _rules) {
+                if (std::regex_search(url, rule.pattern)) {
+                    return rule;
+                }
+            }
+            return Option<Rule>();
+        }
+
+        void HttpResponseCache::putInMemory(const std::string &url, const std::shared_ptr<Entry> &entry) {
+            auto size = sizeOf(*entry);
+            auto it   = _index.find(url);
+            if (it != _index.end()) {
+                _memorySize -= sizeOf(*it->second->second);
+                _entries.erase(it->second);
+                _index.erase(it);
+            }
+            if (size > _maxMemorySize) {
+                return;
+            }
+            _entries.emplace_front(url, entry);
+            _index[url] = _entries.begin();
+            _memorySize += size;
+            while (_memorySize > _maxMemorySize) {
+                _memorySize -= sizeOf(*_entries.back().second);
+                _index.erase(_entries.back().first);
+                _entries.pop_back();
+            }
+        }
+
+        void HttpResponseCache::putOnDisk(const std::string &url, const std::shared_ptr<Entry> &entry) {
+            auto size = sizeOf(*entry);
+            if (!_disk || size > _maxDiskSize) {
+                return;
+            }
+            auto editor   = _disk->editor();
+            auto previous = _diskSequences.find(url);
+            if (previous != _diskSequences.end()) {
+                auto slot = _diskSlots.find(previous->second);
+                _diskSize -= slot->second.size;
+                editor->remove(toSlotKey(slot->first));
+                _diskSlots.erase(slot);
+                _diskSequences.erase(previous);
+            }
+            // The oldest entries are evicted first
+            while (!_diskSlots.empty() && _diskSize + size > _maxDiskSize) {
+                auto oldest = _diskSlots.begin();
+                editor->remove(toDiskKey(oldest->second.url));
+                editor->remove(toSlotKey(oldest->first));
+                _diskSize -= oldest->second.size;
+                _diskSequences.erase(oldest->second.url);
+                _diskSlots.erase(oldest);
+            }
+            DiskSlot slot{url, size};
+            auto sequence = _diskIndex.next++;
+            _diskSlots.emplace(sequence, slot);
+            _diskSequences[url] = sequence;
+            _diskIndex.first    = _diskSlots.begin()->first;
+            _diskSize += size;
+            editor->putObject(toDiskKey(url), *entry);
+            editor->putObject(toSlotKey(sequence), slot);
+            editor->putObject(DISK_INDEX_KEY, _diskIndex);
+            editor->commit();
+        }
+
+        void HttpResponseCache::loadDiskIndex() {
+            _diskIndex = _disk->getObject<DiskIndex>(DISK_INDEX_KEY).getValueOr(DiskIndex{0, 0});
+            for (auto sequence = _diskIndex.first; sequence < _diskIndex.next; sequence++) {
+                auto slot = _disk->getObject<DiskSlot>(toSlotKey(sequence));
+                if (slot.nonEmpty()) {
+                    _diskSlots.emplace(sequence, slot.getValue());
+                    _diskSequences[slot.getValue().url] = sequence;
+                    _diskSize += slot.getValue().size;
+                }
+            }
+            // Renumber the slots once the gaps outnumber them, so that loading stays proportional to the entries
+            if (_diskIndex.next - _diskIndex.first <= 2 * _diskSlots.size()) {
+                return;
+            }
+            auto editor = _disk->editor();
+            std::map<uint64_t, DiskSlot> slots;
+            for (auto &slot : _diskSlots) {
+                auto sequence = _diskIndex.next++;
+                editor->remove(toSlotKey(slot.first));
+                editor->putObject(toSlotKey(sequence), slot.second);
+                _diskSequences[slot.second.url] = sequence;
+                slots.emplace(sequence, slot.second);
+            }
+            _diskSlots.swap(slots);
+            _diskIndex.first = _diskSlots.empty() ? _diskIndex.next : _diskSlots.begin()->first;
+            editor->putObject(DISK_INDEX_KEY, _diskIndex);
+            editor->commit();
+        }
+
+        std::size_t HttpResponseCache::sizeOf(const Entry &entry) {
+            auto size = entry.body.size() + entry.statusText.size() + entry.etag.size();
+            for (const auto &header : entry.headers) {
+                size += header.first.size() + header.second.size();
+            }
+            return size;
+        }
+
+        bool HttpResponseCache::isConfirmed(const std::vector<uint8_t> &body) {
+            rapidjson::Document document;
+            document.Parse(reinterpret_cast<const char *>(body.data()), body.size());
+            if (document.HasParseError()) {
+                return false;
+            }
+            // Ledger API transactions have a "block" which is null while in the mempool, Cosmos ones a "height"
+            auto isConfirmedTransaction = [](const rapidjson::Value &transaction) {
+                if (!transaction.IsObject()) {
+                    return false;
+                }
+                auto block = transaction.FindMember("block");
+                if (block != transaction.MemberEnd()) {
+                    return block->value.IsObject();
+                }
+                auto height = transaction.FindMember("height");
+                if (height != transaction.MemberEnd()) {
+                    return (height->value.IsString() && height->value.GetStringLength() > 0 && std::string(height->value.GetString()) != "0") ||
+                           (height->value.IsNumber() && height->value.GetDouble() > 0);
+                }
+                return false;
+            };
+            if (document.IsArray()) {
+                if (document.Empty()) {
+                    return false;
+                }
+                for (const auto &transaction : document.GetArray()) {
+                    if (!isConfirmedTransaction(transaction)) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            return isConfirmedTransaction(document);
+        }
+
+        CachedHttpUrlConnection::CachedHttpUrlConnection(const std::shared_ptr<HttpResponseCache::Entry> &entry) : _entry(entry), _consumed(false) {
+        }
+
+        int32_t CachedHttpUrlConnection::getStatusCode() {
+            return _entry->statusCode;
+        }
+
+        std::string CachedHttpUrlConnection::getStatusText() {
+            return _entry->statusText;
+        }
+
+        std::unordered_map<std::string, std::string> CachedHttpUrlConnection::getHeaders() {
+            return _entry->headers;
+        }
+
+        api::HttpReadBodyResult CachedHttpUrlConnection::readBody() {
+            // The whole body is returned by the first read, the next ones signal the end of the body
+            if (_consumed) {
+                return api::HttpReadBodyResult(std::experimental::optional<api::Error>(), std::vector<uint8_t>());
+            }
+            _consumed = true;
+            return api::HttpReadBodyResult(std::experimental::optional<api::Error>(), _entry->body);
+        }
+    } // namespace core
+} // namespace ledger
@@ -0,0 +1,190 @@
+/*
+ *
+ * HttpResponseCache
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#ifndef LEDGER_CORE_HTTPRESPONSECACHE_HPP
+#define LEDGER_CORE_HTTPRESPONSECACHE_HPP
+
+#include "../api/HttpReadBodyResult.hpp"
+#include "../api/HttpUrlConnection.hpp"
+#include "../preferences/Preferences.hpp"
+#include "../utils/Option.hpp"
+
+#include <cereal/types/string.hpp>
+#include <cereal/types/unordered_map.hpp>
+#include <cereal/types/vector.hpp>
+#include <chrono>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <regex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ledger {
+    namespace core {
+
+        /**
+         * Opt-in cache of the responses of GET requests. Only URLs matching a rule are cached, a
+         * rule either marks its resources as immutable or gives them a TTL after which they are
+         * revalidated with their ETag (If-None-Match). Rules for transactions only store them once
+         * they are in a block. Entries live in a memory tier bounded in
+         * bytes and evicting the least recently used entries first, and optionally in a disk tier
+         * backed by the preferences of the pool so that they survive restarts. The disk tier evicts
+         * the oldest stored entries first, each store only writes the entry, its slot in the
+         * eviction order and the bounds of the slot sequence.
+         */
+        class HttpResponseCache {
+          public:
+            struct Entry {
+                int32_t statusCode;
+                std::string statusText;
+                std::unordered_map<std::string, std::string> headers;
+                std::vector<uint8_t> body;
+                std::string etag;
+                // Milliseconds since epoch of the last time the entry was fetched or revalidated
+                int64_t storedAt;
+
+                template <class Archive>
+                void serialize(Archive &archive) {
+                    archive(statusCode, statusText, headers, body, etag, storedAt);
+                }
+            };
+
+            struct Lookup {
+                std::shared_ptr<Entry> entry;
+                bool fresh;
+            };
+
+            struct Stats {
+                uint64_t hits;
+                uint64_t revalidations;
+                uint64_t misses;
+            };
+
+            HttpResponseCache(std::size_t maxMemorySize,
+                              const std::shared_ptr<Preferences> &disk = nullptr,
+                              std::size_t maxDiskSize                  = 0);
+
+            // Responses of URLs matching the pattern never change
+            void addImmutableRule(const std::string &urlPattern);
+            // Responses of URLs matching the pattern are revalidated once older than the TTL
+            void addRule(const std::string &urlPattern, std::chrono::seconds ttl);
+            // Same as addRule, but responses are only stored when they report a block or a height, so
+            // that transactions still in the mempool are always fetched again
+            void addConfirmedRule(const std::string &urlPattern, std::chrono::seconds ttl);
+            // Rules for the immutable resources of the supported explorers (raw transactions, confirmed
+            // transactions by hash, blocks by height)
+            void addExplorerRules(std::chrono::seconds ttl);
+
+            bool isCacheable(const std::string &url) const;
+            Option<Lookup> lookup(const std::string &url);
+            // Reads the whole body of the response and stores it, the returned entry replaces the
+            // consumed connection
+            std::shared_ptr<Entry> store(const std::string &url, const std::shared_ptr<api::HttpUrlConnection> &connection);
+            // The cached entry is still valid (304 Not Modified)
+            std::shared_ptr<Entry> refresh(const std::string &url, const std::shared_ptr<Entry> &entry);
+            void clear();
+
+            Stats getStats() const;
+            std::size_t getMemorySize() const;
+
+          private:
+            struct Rule {
+                std::regex pattern;
+                std::chrono::seconds ttl;
+                bool immutable;
+                bool confirmedOnly;
+            };
+
+            // Position of a disk entry in the eviction order, stored under its own key
+            struct DiskSlot {
+                std::string url;
+                uint64_t size;
+
+                template <class Archive>
+                void serialize(Archive &archive) {
+                    archive(url, size);
+                }
+            };
+
+            // Bounds of the sequence numbers of the disk slots, slots of entries stored again leave gaps
+            struct DiskIndex {
+                uint64_t first;
+                uint64_t next;
+
+                template <class Archive>
+                void serialize(Archive &archive) {
+                    archive(first, next);
+                }
+            };
+
+            using Entries = std::list<std::pair<std::string, std::shared_ptr<Entry>>>;
+
+            Option<Rule> findRule(const std::string &url) const;
+            void putInMemory(const std::string &url, const std::shared_ptr<Entry> &entry);
+            void putOnDisk(const std::string &url, const std::shared_ptr<Entry> &entry);
+            void loadDiskIndex();
+            static std::size_t sizeOf(const Entry &entry);
+            static bool isConfirmed(const std::vector<uint8_t> &body);
+
+            mutable std::mutex _lock;
+            std::vector<Rule> _rules;
+            std::size_t _maxMemorySize;
+            std::size_t _memorySize;
+            Entries _entries;
+            std::unordered_map<std::string, Entries::iterator> _index;
+            std::shared_ptr<Preferences> _disk;
+            std::size_t _maxDiskSize;
+            DiskIndex _diskIndex;
+            std::map<uint64_t, DiskSlot> _diskSlots;
+            std::unordered_map<std::string, uint64_t> _diskSequences;
+            uint64_t _diskSize;
+            Stats _stats;
+        };
+
+        // Connection replaying a cached response
+        class CachedHttpUrlConnection : public api::HttpUrlConnection {
+          public:
+            explicit CachedHttpUrlConnection(const std::shared_ptr<HttpResponseCache::Entry> &entry);
+            int32_t getStatusCode() override;
+            std::string getStatusText() override;
+            std::unordered_map<std::string, std::string> getHeaders() override;
+            api::HttpReadBodyResult readBody() override;
+
+          private:
+            std::shared_ptr<HttpResponseCache::Entry> _entry;
+            bool _consumed;
+        };
+    } // namespace core
+} // namespace ledger
+
+#endif // LEDGER_CORE_HTTPRESPONSECACHE_HPP
@@ -31,8 +31,11 @@
 #ifndef LEDGER_CORE_CONCURRENCY_H
 #define LEDGER_CORE_CONCURRENCY_H
 
+#include <algorithm>
+#include <iterator>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 namespace ledger {
     namespace core {
@@ -40,8 +43,13 @@ namespace ledger {
           public:
             template <typename InputIter, typename UnaryFunction>
             static void parallel_for_each(InputIter first, InputIter last, UnaryFunction f) {
-                auto range               = std::distance(first, last);
-                size_t approxNumThreads  = std::thread::hardware_concurrency();
+                size_t range = std::distance(first, last);
+                if (range == 0) {
+                    return;
+                }
+                // hardware_concurrency() may return 0 when it cannot be computed, and there is
+                // no point in spawning more threads than there are elements
+                size_t approxNumThreads  = std::min<size_t>(std::max<size_t>(std::thread::hardware_concurrency(), 1), range);
                 // number of elements for one thread
                 size_t jobsForThread     = range / approxNumThreads;
                 // number of elements for one thread + remainder
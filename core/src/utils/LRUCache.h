@@ -0,0 +1,107 @@
+/*
+ *
+ * LRUCache
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#pragma once
+
+#include "Option.hpp"
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+/*
+ * A thread safe cache bounded in size, evicting the least recently used entries first
+ */
+namespace ledger {
+    namespace core {
+        template <typename K, typename V>
+        class LRUCache {
+          public:
+            explicit LRUCache(size_t capacity) : _capacity(capacity){};
+
+            Option<V> get(const K &key) {
+                std::lock_guard<std::mutex> lock(_lock);
+                auto it = _index.find(key);
+                if (it == _index.end()) {
+                    return Option<V>();
+                }
+                // Move the entry at the front of the recency list
+                _entries.splice(_entries.begin(), _entries, it->second);
+                return Option<V>(it->second->second);
+            }
+
+            void put(const K &key, const V &value) {
+                std::lock_guard<std::mutex> lock(_lock);
+                if (_capacity == 0) {
+                    return;
+                }
+                auto it = _index.find(key);
+                if (it != _index.end()) {
+                    it->second->second = value;
+                    _entries.splice(_entries.begin(), _entries, it->second);
+                    return;
+                }
+                _entries.emplace_front(key, value);
+                _index[key] = _entries.begin();
+                if (_entries.size() > _capacity) {
+                    _index.erase(_entries.back().first);
+                    _entries.pop_back();
+                }
+            }
+
+            void erase(const K &key) {
+                std::lock_guard<std::mutex> lock(_lock);
+                auto it = _index.find(key);
+                if (it != _index.end()) {
+                    _entries.erase(it->second);
+                    _index.erase(it);
+                }
+            }
+
+            size_t size() {
+                std::lock_guard<std::mutex> lock(_lock);
+                return _entries.size();
+            }
+
+            size_t capacity() const {
+                return _capacity;
+            }
+
+          private:
+            using Entries = std::list<std::pair<K, V>>;
+
+            size_t _capacity;
+            Entries _entries;
+            std::unordered_map<K, typename Entries::iterator> _index;
+            std::mutex _lock;
+        };
+    } // namespace core
+} // namespace ledger
@@ -32,53 +32,168 @@
 
 #include "Option.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <functional>
 #include <iostream>
+#include <list>
+#include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <utility>
+#include <vector>
+
 /*
- * A really simple implementation of TTL cache
+ * A thread safe cache whose entries expire after a fixed TTL.
+ *
+ * Entries are spread over independently locked shards so that concurrent readers of
+ * different keys do not contend on a single mutex. Each shard is bounded and evicts its
+ * least recently used entry when full, and expired entries are swept from a shard at most
+ * once per TTL when it is written to, so keys that are never read again do not leak.
  */
 namespace ledger {
     namespace core {
         template <typename K, typename V, typename Duration = std::chrono::seconds>
         class TTLCache {
           public:
-            TTLCache(const Duration &ttl) : _ttl(ttl){};
+            static constexpr size_t DEFAULT_MAX_SIZE     = 4096;
+            static constexpr size_t DEFAULT_SHARDS_COUNT = 16;
+
+            struct Stats {
+                uint64_t hits;
+                uint64_t misses;
+                uint64_t evictions;
+            };
+
+            TTLCache(const Duration &ttl,
+                     size_t maxSize     = DEFAULT_MAX_SIZE,
+                     size_t shardsCount = DEFAULT_SHARDS_COUNT)
+                : _ttl(ttl), _shards(std::max<size_t>(1, std::min(shardsCount, std::max<size_t>(1, maxSize)))) {
+                _shardCapacity = std::max<size_t>(1, (maxSize + _shards.size() - 1) / _shards.size());
+            };
 
             Option<V> get(const K &key) {
-                std::lock_guard<std::mutex> lock(_lock);
-                auto it = _cache.find(key);
-                if (it == _cache.end()) {
+                auto &shard = getShard(key);
+                std::lock_guard<std::mutex> lock(shard.lock);
+                auto it = shard.index.find(key);
+                if (it == shard.index.end()) {
+                    shard.misses++;
                     return Option<V>();
-                } else if (getNowDurationSinceEpoch() - (*it).second.second > _ttl) {
+                } else if (isExpired(*it->second, now())) {
                     // Clean the cache
-                    _cache.erase(key);
+                    shard.entries.erase(it->second);
+                    shard.index.erase(it);
+                    shard.misses++;
+                    shard.evictions++;
                     return Option<V>();
                 }
-                return Option<V>((*it).second.first);
+                shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+                shard.hits++;
+                return Option<V>(it->second->value);
             }
 
             void put(const K &key, const V &value) {
-                std::lock_guard<std::mutex> lock(_lock);
-                _cache.insert(
-                    {key,
-                     {value,
-                      getNowDurationSinceEpoch()}});
+                auto &shard = getShard(key);
+                std::lock_guard<std::mutex> lock(shard.lock);
+                const auto timestamp = now();
+                sweep(shard, timestamp);
+                auto it = shard.index.find(key);
+                if (it != shard.index.end()) {
+                    // Overwrite the value and refresh its TTL
+                    it->second->value     = value;
+                    it->second->timestamp = timestamp;
+                    shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+                    return;
+                }
+                shard.entries.push_front(Entry{key, value, timestamp});
+                shard.index[key] = shard.entries.begin();
+                if (shard.entries.size() > _shardCapacity) {
+                    shard.index.erase(shard.entries.back().key);
+                    shard.entries.pop_back();
+                    shard.evictions++;
+                }
             }
 
             void erase(const K &key) {
-                std::lock_guard<std::mutex> lock(_lock);
-                _cache.erase(key);
+                auto &shard = getShard(key);
+                std::lock_guard<std::mutex> lock(shard.lock);
+                auto it = shard.index.find(key);
+                if (it != shard.index.end()) {
+                    shard.entries.erase(it->second);
+                    shard.index.erase(it);
+                }
+            }
+
+            size_t size() {
+                size_t count = 0;
+                for (auto &shard : _shards) {
+                    std::lock_guard<std::mutex> lock(shard.lock);
+                    count += shard.entries.size();
+                }
+                return count;
+            }
+
+            Stats getStats() {
+                Stats stats{0, 0, 0};
+                for (auto &shard : _shards) {
+                    std::lock_guard<std::mutex> lock(shard.lock);
+                    stats.hits += shard.hits;
+                    stats.misses += shard.misses;
+                    stats.evictions += shard.evictions;
+                }
+                return stats;
             }
 
           private:
-            Duration getNowDurationSinceEpoch() {
+            struct Entry {
+                K key;
+                V value;
+                Duration timestamp;
+            };
+
+            struct Shard {
+                std::mutex lock;
+                std::list<Entry> entries;
+                std::unordered_map<K, typename std::list<Entry>::iterator> index;
+                Duration lastSweep{0};
+                // Counters are kept per shard, under its lock, to avoid a contended atomic
+                uint64_t hits{0};
+                uint64_t misses{0};
+                uint64_t evictions{0};
+            };
+
+            Shard &getShard(const K &key) {
+                return _shards[std::hash<K>()(key) % _shards.size()];
+            }
+
+            bool isExpired(const Entry &entry, const Duration &timestamp) const {
+                return timestamp - entry.timestamp > _ttl;
+            }
+
+            // Must be called with the shard lock held
+            void sweep(Shard &shard, const Duration &timestamp) {
+                if (timestamp - shard.lastSweep <= _ttl) {
+                    return;
+                }
+                shard.lastSweep = timestamp;
+                for (auto it = shard.entries.begin(); it != shard.entries.end();) {
+                    if (isExpired(*it, timestamp)) {
+                        shard.index.erase(it->key);
+                        it = shard.entries.erase(it);
+                        shard.evictions++;
+                    } else {
+                        ++it;
+                    }
+                }
+            }
+
+            Duration now() const {
                 return std::chrono::duration_cast<Duration>(std::chrono::steady_clock::now().time_since_epoch());
             }
+
             Duration _ttl;
-            std::unordered_map<K, std::pair<V, Duration>> _cache;
-            std::mutex _lock;
+            std::vector<Shard> _shards;
+            size_t _shardCapacity;
         };
     } // namespace core
-} // namespace ledger
\ No newline at end of file
+} // namespace ledger
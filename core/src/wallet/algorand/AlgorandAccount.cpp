@@ -582,7 +582,9 @@ namespace ledger {
                 soci::session sql(getWallet()->getDatabase()->getPool());
 
                 // Update account's internal preferences (for synchronization)
-                auto savedState = getInternalPreferences()->getSubPreferences("AlgorandAccountSynchronizer")->getObject<SavedState>("state");
+                auto preferences   = getInternalPreferences()->getSubPreferences("AlgorandAccountSynchronizer");
+                auto savedState    = preferences->getObject<SavedState>("state");
+                auto backfillState = preferences->getObject<BackfillState>("backfill");
                 if (savedState.nonEmpty()) {
                     // Reset saved state to block mined before given date
                     auto previousBlock = BlockDatabaseHelper::getPreviousBlockInDatabase(sql, getWallet()->getCurrency().name, date);
@@ -591,7 +593,12 @@ namespace ledger {
                     } else if (!previousBlock.nonEmpty()) { // if no previous block, sync should go back from genesis block
                         savedState.getValue().round = 0;
                     }
-                    getInternalPreferences()->getSubPreferences("AlgorandAccountSynchronizer")->editor()->putObject<SavedState>("state", savedState.getValue())->commit();
+                    // The saved round of a pending backfill is the highest round of its newest page, the
+                    // rounds of its segments are only known to be fetched down to where the backfill started
+                    if (backfillState.nonEmpty()) {
+                        savedState.getValue().round = std::min(savedState.getValue().round, backfillState.getValue().firstRound);
+                    }
+                    preferences->editor()->putObject<SavedState>("state", savedState.getValue())->remove("backfill")->commit();
                 }
 
                 TransactionDatabaseHelper::eraseDataSince(sql, accountUid, date);
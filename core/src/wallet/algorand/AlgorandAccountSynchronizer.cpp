@@ -36,6 +36,7 @@
 #include <api/Configuration.hpp>
 #include <api/ConfigurationDefaults.hpp>
 #include <async/Future.hpp>
+#include <async/algorithm.h>
 #include <collections/vector.hpp>
 #include <debug/Benchmarker.h>
 #include <utils/DateUtils.hpp>
@@ -47,8 +48,12 @@ namespace ledger {
         namespace algorand {
 
             AccountSynchronizer::AccountSynchronizer(const std::shared_ptr<WalletPool> &pool,
-                                                     const std::shared_ptr<BlockchainExplorer> &explorer) : DedicatedContext(pool->getDispatcher()->getThreadPoolExecutionContext("synchronizers")),
-                                                                                                            _explorer(explorer) {}
+                                                     const std::shared_ptr<BlockchainExplorer> &explorer,
+                                                     uint64_t backfillSegmentSize,
+                                                     size_t backfillMaxConcurrentSegments) : DedicatedContext(pool->getDispatcher()->getThreadPoolExecutionContext("synchronizers")),
+                                                                                             _explorer(explorer),
+                                                                                             _backfillSegmentSize(backfillSegmentSize),
+                                                                                             _backfillMaxConcurrentSegments(backfillMaxConcurrentSegments) {}
 
             std::shared_ptr<ProgressNotifier<Unit>> AccountSynchronizer::synchronizeAccount(const std::shared_ptr<Account> &account) {
                 std::lock_guard<std::mutex> lock(_lock);
@@ -88,8 +93,13 @@ namespace ledger {
                 }
 
                 return updateLatestBlock(account->getContext())
-                    .template flatMap<bool>(account->getContext(), [this, account, firstRound](const Unit &) -> Future<bool> {
-                        return synchronizeBatch(account, false, firstRound);
+                    .template flatMap<bool>(account->getContext(), [this, account, firstRound](const uint64_t) -> Future<bool> {
+                        // An interrupted backfill resumes from its saved state
+                        auto backfillState = _internalPreferences->template getObject<BackfillState>("backfill");
+                        if (backfillState.nonEmpty()) {
+                            return backfill(account, backfillState.getValue());
+                        }
+                        return synchronizeFirstBatch(account, firstRound);
                     })
                     .template flatMap<Unit>(account->getContext(), [](const bool hadTransactions) -> Future<Unit> {
                         return Future<Unit>::successful(unit);
@@ -99,6 +109,54 @@ namespace ledger {
                     });
             }
 
+            Future<bool> AccountSynchronizer::synchronizeFirstBatch(const std::shared_ptr<Account> &account,
+                                                                    const Option<uint64_t> &firstRound) {
+                return _explorer->getTransactionsForAddress(account->getAddress().toString(), firstRound, Option<uint64_t>())
+                    .template flatMap<bool>(getContext(), [this, account, firstRound](const model::TransactionsBulk &bulk) -> Future<bool> {
+                        auto savedState = _internalPreferences->template getObject<SavedState>("state");
+                        if (savedState.isEmpty()) {
+                            throw Exception(api::ErrorCode::ILLEGAL_STATE, "Saved State not available during account synchronization");
+                        }
+
+                        auto lowestBatchRound = std::numeric_limits<uint64_t>::max();
+                        std::vector<Operation> operations;
+                        for (const auto &tx : bulk.transactions) {
+                            account->interpretTransaction(tx, operations);
+                            lowestBatchRound  = std::min(lowestBatchRound, tx.header.round.getValueOr(lowestBatchRound));
+                            savedState->round = std::max(savedState->round, tx.header.round.getValueOr(0));
+                        }
+
+                        auto tryPutTx = account->bulkInsert(operations);
+                        if (tryPutTx.isFailure()) {
+                            throw make_exception(api::ErrorCode::RUNTIME_ERROR, "Synchronization failed({})",
+                                                 tryPutTx.exception().getValue().getMessage());
+                        }
+
+                        // Only a history which does not fit in the newest page is worth splitting, the rounds
+                        // below this page are then restored by segments fetched concurrently. The backfill state
+                        // is saved along with the new round so that an interruption cannot skip these rounds.
+                        auto hadTX       = !bulk.transactions.empty();
+                        auto lowestRound = firstRound.getValueOr(0);
+                        auto editor      = _internalPreferences->editor()->template putObject<SavedState>("state", savedState.getValue());
+                        if (bulk.hasNext && lowestBatchRound > lowestRound && lowestBatchRound - lowestRound > _backfillSegmentSize) {
+                            BackfillState state;
+                            state.firstRound  = lowestRound;
+                            state.lastRound   = lowestBatchRound;
+                            state.segmentSize = _backfillSegmentSize;
+                            editor->template putObject<BackfillState>("backfill", state)->commit();
+                            return backfill(account, state)
+                                .template map<bool>(ImmediateExecutionContext::INSTANCE, [hadTX](const bool hadMoreTransactions) {
+                                    return hadTX || hadMoreTransactions;
+                                });
+                        }
+                        editor->commit();
+                        if (bulk.hasNext) {
+                            return synchronizeBatch(account, hadTX, firstRound, lowestBatchRound);
+                        }
+                        return Future<bool>::successful(hadTX);
+                    });
+            }
+
             Future<bool> AccountSynchronizer::synchronizeBatch(const std::shared_ptr<Account> &account,
                                                                const bool hadTransactions,
                                                                const Option<uint64_t> &lowestRound,
@@ -141,9 +199,115 @@ namespace ledger {
                                             });
             }
 
-            Future<Unit> AccountSynchronizer::updateLatestBlock(const std::shared_ptr<api::ExecutionContext> &context) {
+            Future<bool> AccountSynchronizer::backfill(const std::shared_ptr<Account> &account, const BackfillState &state) {
+                auto pendingSegments = std::make_shared<std::deque<uint64_t>>();
+                for (uint64_t segment = 0; segment < state.getSegmentCount(); segment++) {
+                    if (std::find(state.completedSegments.begin(), state.completedSegments.end(), segment) == state.completedSegments.end()) {
+                        pendingSegments->push_back(segment);
+                    }
+                }
+
+                // Each worker pulls the next pending segment once its own is stored
+                std::vector<Future<bool>> workers;
+                auto workerCount = std::min(_backfillMaxConcurrentSegments, pendingSegments->size());
+                for (size_t worker = 0; worker < workerCount; worker++) {
+                    workers.push_back(backfillSegments(account, state, pendingSegments));
+                }
+                return async::sequence(getContext(), workers)
+                    .template map<bool>(getContext(), [this](const std::vector<bool> &hadTransactions) {
+                        _internalPreferences->editor()->remove("backfill")->commit();
+                        return std::find(hadTransactions.begin(), hadTransactions.end(), true) != hadTransactions.end();
+                    });
+            }
+
+            Future<bool> AccountSynchronizer::backfillSegments(const std::shared_ptr<Account> &account,
+                                                               const BackfillState &state,
+                                                               const std::shared_ptr<std::deque<uint64_t>> &pendingSegments) {
+                uint64_t segment;
+                {
+                    std::lock_guard<std::mutex> lock(_stateLock);
+                    if (pendingSegments->empty()) {
+                        return Future<bool>::successful(false);
+                    }
+                    segment = pendingSegments->front();
+                    pendingSegments->pop_front();
+                }
+                return synchronizeSegment(account, state, segment)
+                    .template flatMap<bool>(getContext(), [this, account, state, pendingSegments](const bool hadTransactions) {
+                        return backfillSegments(account, state, pendingSegments)
+                            .template map<bool>(ImmediateExecutionContext::INSTANCE, [hadTransactions](const bool hadMoreTransactions) {
+                                return hadTransactions || hadMoreTransactions;
+                            });
+                    });
+            }
+
+            Future<bool> AccountSynchronizer::synchronizeSegment(const std::shared_ptr<Account> &account,
+                                                                 const BackfillState &state,
+                                                                 uint64_t segment) {
+                auto lowestRound  = state.firstRound + segment * state.segmentSize;
+                auto highestRound = Option<uint64_t>(std::min(lowestRound + state.segmentSize - 1, state.lastRound));
+                auto transactions = std::make_shared<std::vector<model::Transaction>>();
+                auto txIds        = std::make_shared<std::unordered_set<std::string>>();
+                return fetchSegment(account, lowestRound, highestRound, transactions, txIds)
+                    .template map<bool>(getContext(), [this, account, segment, transactions](const Unit &) {
+                        std::stable_sort(transactions->begin(), transactions->end(), [](const model::Transaction &lhs, const model::Transaction &rhs) {
+                            return lhs.header.round.getValueOr(0) < rhs.header.round.getValueOr(0);
+                        });
+
+                        uint64_t highestSegmentRound = 0;
+                        std::vector<Operation> operations;
+                        for (const auto &tx : *transactions) {
+                            account->interpretTransaction(tx, operations);
+                            highestSegmentRound = std::max(highestSegmentRound, tx.header.round.getValueOr(0));
+                        }
+
+                        auto tryPutTx = account->bulkInsert(operations);
+                        if (tryPutTx.isFailure()) {
+                            throw make_exception(api::ErrorCode::RUNTIME_ERROR, "Synchronization failed({})",
+                                                 tryPutTx.exception().getValue().getMessage());
+                        }
+
+                        // Record the segment as done and the highest round ever seen, for the next incremental synchronization
+                        std::lock_guard<std::mutex> lock(_stateLock);
+                        auto savedState    = _internalPreferences->template getObject<SavedState>("state");
+                        auto backfillState = _internalPreferences->template getObject<BackfillState>("backfill");
+                        if (savedState.isEmpty() || backfillState.isEmpty()) {
+                            throw Exception(api::ErrorCode::ILLEGAL_STATE, "Saved State not available during account synchronization");
+                        }
+                        savedState->round = std::max(savedState->round, highestSegmentRound);
+                        backfillState->completedSegments.push_back(segment);
+                        _internalPreferences->editor()->template putObject<SavedState>("state", savedState.getValue())->template putObject<BackfillState>("backfill", backfillState.getValue())->commit();
+                        return !transactions->empty();
+                    });
+            }
+
+            Future<Unit> AccountSynchronizer::fetchSegment(const std::shared_ptr<Account> &account,
+                                                           uint64_t lowestRound,
+                                                           const Option<uint64_t> &highestRound,
+                                                           const std::shared_ptr<std::vector<model::Transaction>> &transactions,
+                                                           const std::shared_ptr<std::unordered_set<std::string>> &txIds) {
+                return _explorer->getTransactionsForAddress(account->getAddress().toString(), lowestRound, highestRound)
+                    .template flatMap<Unit>(getContext(), [this, account, lowestRound, transactions, txIds](const model::TransactionsBulk &bulk) -> Future<Unit> {
+                        // Pages overlap on their lowest round, transactions already fetched are skipped
+                        auto lowestBatchRound = std::numeric_limits<uint64_t>::max();
+                        auto hadNewTx         = false;
+                        for (const auto &tx : bulk.transactions) {
+                            lowestBatchRound = std::min(lowestBatchRound, tx.header.round.getValueOr(lowestBatchRound));
+                            if (txIds->insert(tx.header.id.getValueOr("")).second) {
+                                transactions->push_back(tx);
+                                hadNewTx = true;
+                            }
+                        }
+                        if (bulk.hasNext && hadNewTx) {
+                            return fetchSegment(account, lowestRound, Option<uint64_t>(lowestBatchRound), transactions, txIds);
+                        }
+                        return Future<Unit>::successful(unit);
+                    });
+            }
+
+            Future<uint64_t> AccountSynchronizer::updateLatestBlock(const std::shared_ptr<api::ExecutionContext> &context) {
                 return _explorer->getLatestBlock()
-                    .template flatMap<Unit>(context, [this](const Try<api::Block> &block) -> Future<Unit> {
+                    .template flatMap<uint64_t>(context, [this](const Try<api::Block> &block) -> Future<uint64_t> {
                         if (block.isSuccess()) {
                             soci::session sql(_account->getWallet()->getDatabase()->getPool());
                             soci::transaction tr(sql);
@@ -155,9 +319,9 @@ namespace ledger {
                             } catch (...) {
                                 tr.rollback();
                             }
-                            return Future<Unit>::successful(unit);
+                            return Future<uint64_t>::successful(static_cast<uint64_t>(block.getValue().height));
                         }
-                        return Future<Unit>::failure(block.getFailure());
+                        return Future<uint64_t>::failure(block.getFailure());
                     });
             }
 
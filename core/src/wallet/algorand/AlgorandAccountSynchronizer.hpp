@@ -33,10 +33,13 @@
 #include "AlgorandAddress.hpp"
 #include "AlgorandBlockchainExplorer.hpp"
 
+#include <cereal/types/vector.hpp>
+#include <deque>
 #include <events/ProgressNotifier.h>
 #include <map>
 #include <mutex>
 #include <string>
+#include <unordered_set>
 #include <vector>
 #include <wallet/common/AbstractWallet.hpp>
 #include <wallet/pool/WalletPool.hpp>
@@ -56,31 +59,76 @@ namespace ledger {
                 };
             };
 
+            // Progress of a synchronization whose rounds below the newest page are split into segments fetched
+            // concurrently. Segment i covers the rounds [firstRound + i * segmentSize, firstRound + (i + 1) * segmentSize),
+            // the last one stops at lastRound, the lowest round of the newest page.
+            struct BackfillState {
+                uint64_t firstRound;
+                uint64_t lastRound;
+                uint64_t segmentSize;
+                std::vector<uint64_t> completedSegments;
+
+                BackfillState() : firstRound(0), lastRound(0), segmentSize(0) {}
+
+                uint64_t getSegmentCount() const {
+                    return (lastRound - firstRound) / segmentSize + 1;
+                }
+
+                template <class Archive>
+                void serialize(Archive &archive) {
+                    archive(firstRound, lastRound, segmentSize, completedSegments);
+                };
+            };
+
             class Account;
 
             class AccountSynchronizer : public DedicatedContext,
                                         public std::enable_shared_from_this<AccountSynchronizer> {
               public:
                 AccountSynchronizer(const std::shared_ptr<WalletPool> &pool,
-                                    const std::shared_ptr<BlockchainExplorer> &explorer);
+                                    const std::shared_ptr<BlockchainExplorer> &explorer,
+                                    uint64_t backfillSegmentSize,
+                                    size_t backfillMaxConcurrentSegments);
 
                 std::shared_ptr<ProgressNotifier<Unit>> synchronizeAccount(const std::shared_ptr<Account> &account);
 
               private:
                 Future<Unit> performSynchronization(const std::shared_ptr<Account> &account);
 
+                Future<bool> synchronizeFirstBatch(const std::shared_ptr<Account> &account, const Option<uint64_t> &firstRound);
+
                 Future<bool> synchronizeBatch(const std::shared_ptr<Account> &account,
                                               const bool hadTransactions,
                                               const Option<uint64_t> &lowestRound  = Option<uint64_t>(),
                                               const Option<uint64_t> &highestRound = Option<uint64_t>());
 
-                Future<Unit> updateLatestBlock(const std::shared_ptr<api::ExecutionContext> &context);
+                Future<bool> backfill(const std::shared_ptr<Account> &account, const BackfillState &state);
+
+                Future<bool> backfillSegments(const std::shared_ptr<Account> &account,
+                                              const BackfillState &state,
+                                              const std::shared_ptr<std::deque<uint64_t>> &pendingSegments);
+
+                Future<bool> synchronizeSegment(const std::shared_ptr<Account> &account,
+                                                const BackfillState &state,
+                                                uint64_t segment);
+
+                Future<Unit> fetchSegment(const std::shared_ptr<Account> &account,
+                                          uint64_t lowestRound,
+                                          const Option<uint64_t> &highestRound,
+                                          const std::shared_ptr<std::vector<model::Transaction>> &transactions,
+                                          const std::shared_ptr<std::unordered_set<std::string>> &txIds);
+
+                Future<uint64_t> updateLatestBlock(const std::shared_ptr<api::ExecutionContext> &context);
 
                 std::shared_ptr<Account> _account;
                 std::shared_ptr<BlockchainExplorer> _explorer;
                 std::shared_ptr<Preferences> _internalPreferences;
                 std::shared_ptr<ProgressNotifier<Unit>> _notifier;
                 std::mutex _lock;
+                uint64_t _backfillSegmentSize;
+                size_t _backfillMaxConcurrentSegments;
+                // Guards the saved and backfill states updated by concurrent segments
+                std::mutex _stateLock;
             };
 
         } // namespace algorand
@@ -35,6 +35,7 @@
 
 #include <api/AlgorandBlockchainExplorerEngines.hpp>
 #include <api/Configuration.hpp>
+#include <api/ConfigurationDefaults.hpp>
 #include <api/SynchronizationEngines.hpp>
 #include <utils/Assert.hpp>
 
@@ -80,12 +81,19 @@ namespace ledger {
                 {
                     if (syncEngine == api::SynchronizationEngines::BLOCKCHAIN_EXPLORER_SYNCHRONIZATION) {
                         std::weak_ptr<WalletPool> weakPool = pool;
-                        synchronizerFactory                = Option<AlgorandAccountSynchronizerFactory>([weakPool, explorer]() {
+                        auto segmentSize                   = entry.configuration->getInt(api::Configuration::SYNCHRONIZATION_BACKFILL_SEGMENT_SIZE)
+                                                                 .value_or(api::ConfigurationDefaults::DEFAULT_SYNCHRONIZATION_BACKFILL_SEGMENT_SIZE);
+                        auto maxConcurrentSegments         = entry.configuration->getInt(api::Configuration::SYNCHRONIZATION_BACKFILL_MAX_CONCURRENT_SEGMENTS)
+                                                                 .value_or(api::ConfigurationDefaults::DEFAULT_SYNCHRONIZATION_BACKFILL_MAX_CONCURRENT_SEGMENTS);
+                        synchronizerFactory                = Option<AlgorandAccountSynchronizerFactory>([weakPool, explorer, segmentSize, maxConcurrentSegments]() {
                             auto pool = weakPool.lock();
                             if (!pool) {
                                 throw make_exception(api::ErrorCode::NULL_POINTER, "Pool was released.");
                             }
-                            return std::make_shared<AccountSynchronizer>(pool, explorer);
+                            return std::make_shared<AccountSynchronizer>(pool,
+                                                                         explorer,
+                                                                         static_cast<uint64_t>(std::max(segmentSize, 1)),
+                                                                         static_cast<size_t>(std::max(maxConcurrentSegments, 1)));
                         });
                     }
                 }
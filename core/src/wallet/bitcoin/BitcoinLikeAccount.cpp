@@ -56,7 +56,9 @@
 #include <wallet/bitcoin/database/BitcoinLikeUTXODatabaseHelper.h>
 #include <wallet/bitcoin/transaction_builders/BitcoinLikeStrategyUtxoPicker.h>
 #include <wallet/bitcoin/transaction_builders/BitcoinLikeTransactionBuilder.h>
+#include <wallet/bitcoin/transaction_builders/BitcoinLikeUtxoPool.h>
 #include <wallet/common/Operation.h>
+#include <wallet/common/database/BalanceCheckpointDatabaseHelper.h>
 #include <wallet/common/database/BlockDatabaseHelper.h>
 #include <wallet/common/database/BulkInsertDatabaseHelper.hpp>
 #include <wallet/common/database/OperationDatabaseHelper.h>
@@ -189,6 +191,7 @@ namespace ledger {
                 getWallet()->getPool()->getThreadPoolExecutionContext(),
                 getWallet()->getCurrency(),
                 getWallet()->getConfig()->getBoolean(api::Configuration::CONFIRMED_UTXO_FIRST).value_or(true));
+            _utxoPool           = std::make_shared<BitcoinLikeUtxoPool>();
             _currentBlockHeight = 0;
         }
 
@@ -345,14 +348,29 @@ namespace ledger {
             return Try<int>::from([&]() {
                 soci::session sql(getWallet()->getDatabase()->getPool());
                 soci::transaction tr(sql);
+                BalanceCheckpointDatabaseHelper::invalidateCheckpoints(sql, ops);
                 BitcoinLikeOperationDatabaseHelper::bulkInsert(sql, ops);
+                updateBalanceCheckpoints(sql, ops);
                 tr.commit();
+                _utxoPool->invalidate();
                 // Emit
                 emitNewOperationsEvent(ops);
                 return ops.size();
             });
         }
 
+        void BitcoinLikeAccount::updateBalanceCheckpoints(soci::session &sql, const std::vector<Operation> &operations) {
+            const auto &uid  = getAccountUid();
+            auto latest      = BalanceCheckpointDatabaseHelper::getLatestCheckpoint(sql, uid).getValueOr(BalanceCheckpoint());
+            auto pendingDate = BalanceCheckpointDatabaseHelper::getEarliestPendingDate(sql, uid);
+            if (!BalanceCheckpointDatabaseHelper::hasFoldableOperations(latest, pendingDate, operations)) {
+                return;
+            }
+            std::vector<OperationBalanceChange> changes;
+            OperationDatabaseHelper::queryBalanceChanges(sql, uid, latest.date, pendingDate, changes);
+            BalanceCheckpointDatabaseHelper::updateCheckpoints(sql, uid, latest, pendingDate, changes);
+        }
+
         void BitcoinLikeAccount::computeOperationTrust(Operation &operation,
                                                        const BitcoinLikeBlockchainExplorerTransaction &tx) {
             if (tx.block.nonEmpty()) {
@@ -416,6 +434,8 @@ namespace ledger {
             eventPublisher->postSticky(std::make_shared<Event>(api::EventCode::SYNCHRONIZATION_STARTED, api::DynamicObject::newInstance()), 0);
             future.onComplete(getContext(), [eventPublisher, self, wasEmpty, startTime, span](auto const &result) {
                 auto span2   = self->getTracer()->startSpan("BitcoinLikeAccount::synchronize.onComplete");
+                // Whatever the outcome, the synchronization may have changed the UTXO set
+                self->_utxoPool->invalidate();
                 auto isEmpty = self->checkIfWalletIsEmpty();
                 api::EventCode code;
                 auto payload  = std::make_shared<DynamicObject>();
@@ -600,40 +620,40 @@ namespace ledger {
 
                 const auto &uid = self->getAccountUid();
                 soci::session sql(self->getWallet()->getDatabase()->getReadonlyPool());
-                std::vector<Operation> operations;
+                std::vector<OperationBalanceChange> operations;
+                Int256 sum;
+
+                // Get operations related to an account, starting after the latest balance checkpoint
+                // settled at the start date if there is one
+                auto checkpoint = BalanceCheckpointDatabaseHelper::getLatestCheckpoint(sql, uid, startDate);
+                auto after      = std::chrono::system_clock::time_point();
+                if (checkpoint.nonEmpty()) {
+                    sum   = Int256::fromBigInt(checkpoint->balance);
+                    after = checkpoint->date;
+                }
+                OperationDatabaseHelper::queryBalanceChanges(sql, uid, after, operations);
 
-                // Get operations related to an account
-                OperationDatabaseHelper::queryOperations(sql, uid, operations);
+                std::size_t operationsCount = 0;
+                while (operationsCount < operations.size() && operations[operationsCount].date <= startDate) {
+                    BalanceCheckpointDatabaseHelper::updateBalance(sum, operations[operationsCount]);
+                    operationsCount += 1;
+                }
 
                 auto lowerDate = startDate;
                 auto upperDate = DateUtils::incrementDate(startDate, precision);
 
                 std::vector<std::shared_ptr<api::Amount>> amounts;
-                std::size_t operationsCount = 0;
-                BigInt sum;
                 while (lowerDate <= endDate && operationsCount < operations.size()) {
                     auto operation = operations[operationsCount];
                     while (operation.date > upperDate && lowerDate < endDate) {
                         lowerDate = DateUtils::incrementDate(lowerDate, precision);
                         upperDate = DateUtils::incrementDate(upperDate, precision);
                         amounts.emplace_back(
-                            std::make_shared<ledger::core::Amount>(self->getWallet()->getCurrency(), 0, sum));
+                            std::make_shared<ledger::core::Amount>(self->getWallet()->getCurrency(), 0, sum.toBigInt()));
                     }
 
                     if (operation.date <= upperDate) {
-                        switch (operation.type) {
-                        case api::OperationType::RECEIVE: {
-                            sum = sum + operation.amount;
-                            break;
-                        }
-                        case api::OperationType::SEND: {
-                            sum = sum - (operation.amount + operation.fees.getValueOr(BigInt::ZERO));
-                            break;
-                        }
-                        case api::OperationType::NONE:
-                        default:
-                            break;
-                        }
+                        BalanceCheckpointDatabaseHelper::updateBalance(sum, operation);
                     }
                     operationsCount += 1;
                 }
@@ -641,7 +661,7 @@ namespace ledger {
                 while (lowerDate < endDate) {
                     lowerDate = DateUtils::incrementDate(lowerDate, precision);
                     amounts.emplace_back(
-                        std::make_shared<ledger::core::Amount>(self->getWallet()->getCurrency(), 0, sum));
+                        std::make_shared<ledger::core::Amount>(self->getWallet()->getCurrency(), 0, sum.toBigInt()));
                 }
 
                 return amounts;
@@ -746,45 +766,93 @@ namespace ledger {
             broadcastRawTransaction(transaction->serialize(), callback, transaction->getCorrelationId());
         }
 
-        std::shared_ptr<api::BitcoinLikeTransactionBuilder> BitcoinLikeAccount::buildTransaction(bool partial) {
-            auto self    = std::dynamic_pointer_cast<BitcoinLikeAccount>(shared_from_this());
-            auto getUTXO = [=]() -> Future<std::vector<BitcoinLikeUtxo>> {
-                return self->_explorer->getFees().map<std::vector<BitcoinLikeUtxo>>(self->getContext(), [self](const std::vector<std::shared_ptr<api::BigInt>> &fees) {
-                    auto keychain = self->getKeychain();
-                    soci::session session(self->getWallet()->getDatabase()->getPool());
-
+        BitcoinLikeGetUtxoFunction BitcoinLikeAccount::getUtxoFunction() {
+            auto self = std::dynamic_pointer_cast<BitcoinLikeAccount>(shared_from_this());
+            return [=]() -> Future<std::shared_ptr<const BitcoinLikeUtxoSet>> {
+                return self->_explorer->getFees().map<std::shared_ptr<const BitcoinLikeUtxoSet>>(self->getContext(), [self](const std::vector<std::shared_ptr<api::BigInt>> &fees) {
+                    auto keychain                  = self->getKeychain();
                     const auto worthlessUtxoAmount = BitcoinLikeTransactionApi::computeWorthlessUtxoValue(self->getWallet()->getCurrency(), keychain->getKeychainEngine(), fees);
                     self->logger()->info(fmt::format("Worthless utxo value is {}", worthlessUtxoAmount));
-                    return BitcoinLikeUTXODatabaseHelper::queryAllUtxos(session, self->getAccountUid(), self->getWallet()->getCurrency(), worthlessUtxoAmount);
+                    // The pool only hits the database when the account changed since the last build
+                    return self->_utxoPool->get(worthlessUtxoAmount, [&]() {
+                        soci::session session(self->getWallet()->getDatabase()->getPool());
+                        return BitcoinLikeUTXODatabaseHelper::queryAllUtxos(session, self->getAccountUid(), self->getWallet()->getCurrency(), worthlessUtxoAmount);
+                    });
                 });
             };
-            auto getTransaction = [self](const std::string &hash) -> FuturePtr<BitcoinLikeBlockchainExplorerTransaction> {
+        }
+
+        BitcoinLikeGetTxFunction BitcoinLikeAccount::getTransactionFunction() {
+            auto self = std::dynamic_pointer_cast<BitcoinLikeAccount>(shared_from_this());
+            return [self](const std::string &hash) -> FuturePtr<BitcoinLikeBlockchainExplorerTransaction> {
                 return self->getTransaction(hash);
             };
+        }
 
-            uint64_t lastBlockHeight = 0;
-            auto cachedBlock         = self->getWallet()->getPool()->getBlockFromCache(self->getWallet()->getCurrency().name);
+        uint64_t BitcoinLikeAccount::getLastBlockHeight() {
+            auto cachedBlock = getWallet()->getPool()->getBlockFromCache(getWallet()->getCurrency().name);
             if (cachedBlock.hasValue()) {
-                lastBlockHeight = cachedBlock.getValue().height;
-            } else {
-                soci::session sql(self->getWallet()->getDatabase()->getReadonlyPool());
-                lastBlockHeight = getLastBlockFromDB(sql, self->getWallet()->getCurrency().name);
+                return cachedBlock.getValue().height;
             }
+            soci::session sql(getWallet()->getDatabase()->getReadonlyPool());
+            return getLastBlockFromDB(sql, getWallet()->getCurrency().name);
+        }
 
+        std::shared_ptr<api::BitcoinLikeTransactionBuilder> BitcoinLikeAccount::buildTransaction(bool partial) {
             return std::make_shared<BitcoinLikeTransactionBuilder>(
                 getMainExecutionContext(),
                 getWallet()->getCurrency(),
                 logger(),
-                _picker->getBuildFunction(getUTXO,
-                                          getTransaction,
+                _picker->getBuildFunction(getUtxoFunction(),
+                                          getTransactionFunction(),
                                           _explorer,
                                           _keychain,
-                                          lastBlockHeight,
+                                          getLastBlockHeight(),
                                           logger(),
                                           partial),
                 allowP2TR());
         }
 
+        Future<std::vector<Try<std::shared_ptr<api::BitcoinLikeTransaction>>>>
+        BitcoinLikeAccount::buildTransactions(const std::vector<std::shared_ptr<api::BitcoinLikeTransactionBuilder>> &builders, bool partial) {
+            std::vector<BitcoinLikeTransactionBuildRequest> requests;
+            requests.reserve(builders.size());
+            for (auto const &builder : builders) {
+                auto localBuilder = std::dynamic_pointer_cast<BitcoinLikeTransactionBuilder>(builder);
+                if (localBuilder == nullptr) {
+                    return Future<std::vector<Try<std::shared_ptr<api::BitcoinLikeTransaction>>>>::failure(
+                        make_exception(api::ErrorCode::INVALID_ARGUMENT, "Transaction builder was not created by a bitcoin like account."));
+                }
+                requests.push_back(localBuilder->getRequest());
+            }
+            auto build = _picker->getBatchBuildFunction(getUtxoFunction(),
+                                                        getTransactionFunction(),
+                                                        _explorer,
+                                                        _keychain,
+                                                        getLastBlockHeight(),
+                                                        logger(),
+                                                        partial);
+            return build(requests);
+        }
+
+        void BitcoinLikeAccount::buildTransactions(const std::vector<std::shared_ptr<api::BitcoinLikeTransactionBuilder>> &builders,
+                                                   bool partial,
+                                                   const std::shared_ptr<api::BitcoinLikeTransactionBatchCallback> &callback) {
+            const auto count = builders.size();
+            buildTransactions(builders, partial).onComplete(getMainExecutionContext(), [callback, count](const Try<std::vector<Try<std::shared_ptr<api::BitcoinLikeTransaction>>>> &result) {
+                for (size_t index = 0; index < count; index++) {
+                    // A failure of the whole batch is reported for each of its transactions
+                    if (result.isFailure()) {
+                        callback->onTransaction(static_cast<int32_t>(index), nullptr, Option<api::Error>(result.getFailure().toApiError()).toOptional());
+                    } else if (result.getValue()[index].isFailure()) {
+                        callback->onTransaction(static_cast<int32_t>(index), nullptr, Option<api::Error>(result.getValue()[index].getFailure().toApiError()).toOptional());
+                    } else {
+                        callback->onTransaction(static_cast<int32_t>(index), result.getValue()[index].getValue(), Option<api::Error>().toOptional());
+                    }
+                }
+            });
+        }
+
         const std::shared_ptr<BitcoinLikeBlockchainExplorer> &BitcoinLikeAccount::getExplorer() const {
             return _explorer;
         }
@@ -825,6 +893,7 @@ namespace ledger {
 
             auto accountUid = getAccountUid();
             BitcoinLikeTransactionDatabaseHelper::eraseDataSince(sql, accountUid, date);
+            _utxoPool->invalidate();
 
             return Future<api::ErrorCode>::successful(api::ErrorCode::FUTURE_WAS_SUCCESSFULL);
         }
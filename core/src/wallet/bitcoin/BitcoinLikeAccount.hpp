@@ -41,19 +41,20 @@
 #include <api/BitcoinLikeOutput.hpp>
 #include <api/BitcoinLikePickingStrategy.hpp>
 #include <api/BitcoinLikePreparedTransaction.hpp>
+#include <api/BitcoinLikeTransactionBatchCallback.hpp>
 #include <api/BitcoinLikeTransactionRequest.hpp>
 #include <api/OperationListCallback.hpp>
 #include <preferences/Preferences.hpp>
 #include <soci.h>
 #include <wallet/bitcoin/keychains/BitcoinLikeKeychain.hpp>
 #include <wallet/bitcoin/synchronizers/BitcoinLikeAccountSynchronizer.hpp>
+#include <wallet/bitcoin/transaction_builders/BitcoinLikeUtxoPicker.h>
 #include <wallet/bitcoin/types.h>
 #include <wallet/common/AbstractAccount.hpp>
 
 namespace ledger {
     namespace core {
         class Operation;
-        class BitcoinLikeUtxoPicker;
 
         class BitcoinLikeAccount : public api::BitcoinLikeAccount, public AbstractAccount {
           public:
@@ -112,6 +113,14 @@ namespace ledger {
 
             std::shared_ptr<api::BitcoinLikeTransactionBuilder> buildTransaction(bool partial) override;
 
+            // Builds the transactions described by builders obtained from buildTransaction, sharing one UTXO
+            // snapshot and never spending the same UTXO twice. Each transaction fails or succeeds on its own.
+            Future<std::vector<Try<std::shared_ptr<api::BitcoinLikeTransaction>>>>
+            buildTransactions(const std::vector<std::shared_ptr<api::BitcoinLikeTransactionBuilder>> &builders, bool partial);
+            void buildTransactions(const std::vector<std::shared_ptr<api::BitcoinLikeTransactionBuilder>> &builders,
+                                   bool partial,
+                                   const std::shared_ptr<api::BitcoinLikeTransactionBatchCallback> &callback) override;
+
             std::shared_ptr<api::OperationQuery> queryOperations() override;
 
             FuturePtr<ledger::core::Amount> getMaxSpendable(api::BitcoinLikePickingStrategy strategy, optional<int32_t> maxUtxos);
@@ -152,13 +161,19 @@ namespace ledger {
                                          const BitcoinLikeBlockchainExplorerTransaction &tx);
             inline void computeOperationTrust(Operation &operation,
                                               const BitcoinLikeBlockchainExplorerTransaction &tx);
+            // Save the balance checkpoints of the operations inserted since the latest one
+            void updateBalanceCheckpoints(soci::session &sql, const std::vector<Operation> &operations);
             std::vector<std::shared_ptr<api::Address>> fromBitcoinAddressesToAddresses(const std::vector<std::shared_ptr<BitcoinLikeAddress>> &addresses);
             inline bool allowP2TR() const;
+            BitcoinLikeGetUtxoFunction getUtxoFunction();
+            BitcoinLikeGetTxFunction getTransactionFunction();
+            uint64_t getLastBlockHeight();
 
             std::shared_ptr<BitcoinLikeKeychain> _keychain;
             std::shared_ptr<BitcoinLikeBlockchainExplorer> _explorer;
             std::shared_ptr<BitcoinLikeAccountSynchronizer> _synchronizer;
             std::shared_ptr<BitcoinLikeUtxoPicker> _picker;
+            std::shared_ptr<BitcoinLikeUtxoPool> _utxoPool;
             std::shared_ptr<api::EventBus> _currentSyncEventBus;
             std::mutex _synchronizationLock;
             uint64_t _currentBlockHeight;
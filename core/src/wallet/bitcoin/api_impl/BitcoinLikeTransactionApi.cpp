@@ -633,10 +633,19 @@ namespace ledger {
                 tx->setTimestamp(timeStamp);
             }
 
+            // For XST we should remove the script sigs to compute the tx hash
+            // Reference: https://github.com/StealthSend/Stealth/commit/5be35d6c2c500b32ed82e5d6913d66d18a4b0a7f#diff-e8db9b851adc2422aadfffca88f14c91R566
+            auto stripsScriptSigs = isSigned && params.Identifier == "xst" && !usesTimeStamp;
+
             // Parse inputs
             std::vector<BitcoinLikePreparedInput> preparedInputs;
-            std::vector<std::vector<uint8_t>> scriptSigs;
+            // Script sig bytes of each input, kept next to their hex form to avoid decoding it back
+            std::vector<std::vector<uint8_t>> inputScripts;
+            // Byte ranges [begin, end) of rawTransaction which are replaced by an empty script when hashing
+            std::vector<std::pair<size_t, size_t>> strippedScriptSigs;
             auto inputsCount = reader.readNextVarInt();
+            preparedInputs.reserve(inputsCount);
+            inputScripts.reserve(inputsCount);
             for (auto index = 0; index < inputsCount; index++) {
                 // Previous Tx Hash in LE
                 auto prevTxHashBytes = reader.read(32);
@@ -647,21 +656,19 @@ namespace ledger {
                 ledger::core::BitcoinLikeBlockchainExplorerOutput output;
                 std::string address;
                 std::vector<std::vector<uint8_t>> pubKeys;
+                std::vector<uint8_t> inputScript;
 
                 // Decred has a tree field (1 bytes) and nothing else
                 if (isDecred) {
                     reader.readNextByte();
                 } else {
+                    auto scriptBegin  = reader.getCursor();
                     auto scriptSize   = reader.readNextVarInt();
                     auto scriptSig    = reader.read(scriptSize);
                     auto parsedScript = ledger::core::BitcoinLikeScript::parse(scriptSig);
                     if (parsedScript.isSuccess()) {
-                        // Useful to remove script sigs from rawTx to compute txHash (e.g. XST)
-                        {
-                            BytesWriter localWriter;
-                            localWriter.writeVarInt(scriptSize);
-                            localWriter.writeByteArray(scriptSig);
-                            scriptSigs.emplace_back(localWriter.toByteArray());
+                        if (stripsScriptSigs) {
+                            strippedScriptSigs.emplace_back(scriptBegin, reader.getCursor());
                         }
 
                         BytesReader localReader(scriptSig);
@@ -680,6 +687,7 @@ namespace ledger {
                                 address = localAddress.toBase58();
                             }
                             output.script = hex::toString(scriptSig);
+                            inputScript   = std::move(scriptSig);
                         } else if (isSigned && isSegwit && !scriptSig.empty()) {
                             // Get address from redeem script
                             auto redeemScriptSize = localReader.readNextVarInt();
@@ -697,7 +705,8 @@ namespace ledger {
                             if (parsedAddress.hasValue()) {
                                 address = parsedAddress.getValue().toString();
                             }
-                            output.script = hex::toString(parsedScript.getValue().serialize());
+                            inputScript   = parsedScript.getValue().serialize();
+                            output.script = hex::toString(inputScript);
                         }
                     }
                 }
@@ -706,6 +715,7 @@ namespace ledger {
                 output.transactionHash = previousTxHash;
                 output.index           = outputIndex;
                 preparedInputs.emplace_back(BitcoinLikePreparedInput(sequence, address, previousTxHash, outputIndex, pubKeys, output));
+                inputScripts.emplace_back(std::move(inputScript));
             }
 
             // Parse outputs
@@ -741,30 +751,8 @@ namespace ledger {
                 reader.readNextVarInt();
             }
 
-            // This will usefull to computes tx hash (txID)
-            std::vector<uint8_t> modifTx(rawTransaction.begin(), rawTransaction.begin() + reader.getCursor());
-
-            // For XST we should remove the script sigs
-            // Reference: https://github.com/StealthSend/Stealth/commit/5be35d6c2c500b32ed82e5d6913d66d18a4b0a7f#diff-e8db9b851adc2422aadfffca88f14c91R566
-            if (params.Identifier == "xst" && !usesTimeStamp) {
-                auto strRawTx        = hex::toString(modifTx);
-                auto removeScriptSig = [](std::string &rawTx, const std::string &scriptSig) {
-                    size_t pos = rawTx.find(scriptSig);
-                    if (pos != std::string::npos) {
-                        rawTx.erase(pos, scriptSig.length());
-                        rawTx.insert(pos, "00");
-                    }
-                };
-                for (auto &scriptSig : scriptSigs) {
-                    removeScriptSig(strRawTx, hex::toString(scriptSig));
-                }
-                modifTx = hex::toByteArray(strRawTx);
-            }
-
-            // Remove marker and flag if segwit
-            if (isSegwit) {
-                modifTx.erase(modifTx.begin() + offsetToMarker, modifTx.begin() + offsetToMarker + 2);
-            }
+            // End of the part of rawTransaction used to compute tx hash (txID), timelock excepted
+            auto hashedPartEnd = reader.getCursor();
 
             // Get witness if needed
             if (isSigned && (isSegwit || isDecred)) {
@@ -788,18 +776,16 @@ namespace ledger {
                             reader.readNextVarInt();
                         }
 
+                        // Script sig is <varint scriptSigSize> <scriptSig> <varint pubKeySize> <pubKey>, take it as is
+                        auto witnessBegin  = reader.getCursor();
                         auto scriptSigSize = reader.readNextVarInt();
-                        auto scriptSig     = reader.read(scriptSigSize);
-                        auto pubKeySize    = reader.readNextVarInt();
-                        auto pubKey        = reader.read(pubKeySize);
+                        reader.seek(scriptSigSize, BytesReader::Seek::CUR);
+                        auto pubKeySize = reader.readNextVarInt();
+                        auto pubKey     = reader.read(pubKeySize);
 
                         // Get script sig
-                        BytesWriter writer;
-                        writer.writeVarInt(scriptSigSize);
-                        writer.writeByteArray(scriptSig);
-                        writer.writeVarInt(pubKeySize);
-                        writer.writeByteArray(pubKey);
-                        preparedInputs[index].output.script = hex::toString(writer.toByteArray());
+                        inputScripts[index].assign(rawTransaction.begin() + witnessBegin, rawTransaction.begin() + reader.getCursor());
+                        preparedInputs[index].output.script = hex::toString(inputScripts[index]);
 
                         // Get address, if not recovered yet
                         // This is only possible in case of BIP173_P2WPKH or BIP173_P2WSH
@@ -821,18 +807,36 @@ namespace ledger {
             }
 
             // Decred has lockTime before witness
+            auto timelockOffset = reader.getCursor();
             if (!isDecred) {
-                auto timelock = reader.read(4);
-                modifTx       = vector::concat(modifTx, timelock);
-
-                BytesReader timelockReader(timelock);
-                tx->setLockTime(timelockReader.readNextLeUint());
+                tx->setLockTime(reader.readNextLeUint());
             }
 
             if (isSigned) {
-                auto modifTxStr = hex::toString(modifTx);
+                // Stream rawTransaction into the hash, skipping segwit marker and flag and
+                // replacing stripped script sigs by an empty one
+                SHA256::Hasher hasher;
+                auto data         = rawTransaction.data();
+                size_t hashCursor = 0;
+                auto hashUntil    = [&](size_t end) {
+                    hasher.update(data + hashCursor, end - hashCursor);
+                };
+                if (isSegwit) {
+                    hashUntil(offsetToMarker);
+                    hashCursor = offsetToMarker + 2;
+                }
+                static const uint8_t emptyScript = 0x00;
+                for (const auto &range : strippedScriptSigs) {
+                    hashUntil(range.first);
+                    hasher.update(&emptyScript, 1);
+                    hashCursor = range.second;
+                }
+                hashUntil(hashedPartEnd);
+                if (!isDecred) {
+                    hasher.update(data + timelockOffset, 4);
+                }
                 // Double hash
-                auto doubleHash = SHA256::bytesToBytesHash(SHA256::bytesToBytesHash(modifTx));
+                auto doubleHash = SHA256::bytesToBytesHash(hasher.finalize());
                 // To little endian
                 std::reverse(doubleHash.begin(), doubleHash.end());
                 tx->setHash(hex::toString(doubleHash));
@@ -844,7 +848,7 @@ namespace ledger {
                 std::vector<uint8_t> scriptSig;
                 std::vector<std::vector<uint8_t>> pubKeys;
                 if (isSigned) {
-                    scriptSig = hex::toByteArray(preparedInputs[i].output.script);
+                    scriptSig = std::move(inputScripts[i]);
                     pubKeys   = preparedInputs[i].pubKeys;
                 }
                 tx->addInput(
@@ -33,6 +33,7 @@
 
 #include <api/BigInt.hpp>
 #include <crypto/SHA256.hpp>
+#include <database/PostgreSQLCopy.hpp>
 #include <database/PreparedStatement.hpp>
 #include <database/soci-backend-utils.h>
 #include <database/soci-date.h>
@@ -40,6 +41,7 @@
 #include <debug/Benchmarker.h>
 #include <unordered_set>
 #include <wallet/bitcoin/database/BitcoinLikeTransactionDatabaseHelper.h>
+#include <wallet/bitcoin/database/BitcoinLikeUTXODatabaseHelper.h>
 #include <wallet/common/database/BulkInsertDatabaseHelper.hpp>
 
 using namespace soci;
@@ -73,6 +75,14 @@ namespace {
             s, use(b.uid), use(b.txUid), use(b.txHash);
         });
 
+    const auto COPY_BITCOIN_OPERATION = db::copy<BitcoinOperationBinding>(
+        "bitcoin_operations", {"uid", "transaction_uid", "transaction_hash"}, "uid", "DO NOTHING",
+        [](auto &w, auto &b) {
+            for (size_t i = 0; i < b.uid.size(); i++) {
+                w.row().text(b.uid[i]).text(b.txUid[i]).text(b.txHash[i]);
+            }
+        });
+
     // Transaction
     struct TransactionBinding {
         std::vector<std::string> uid;
@@ -114,6 +124,16 @@ namespace {
                 use(b.lockTime, "locktime");
         });
 
+    const auto COPY_TRANSACTION = db::copy<TransactionBinding>(
+        "bitcoin_transactions", {"transaction_uid", "hash", "version", "block_uid", "time", "locktime"},
+        "transaction_uid", "DO UPDATE SET block_uid = excluded.block_uid",
+        [](auto &w, auto &b) {
+            for (size_t i = 0; i < b.uid.size(); i++) {
+                w.row().text(b.uid[i]).text(b.hash[i]).int4(b.version[i]).text(b.blockUid[i]).date(b.date[i])
+                    .int4(b.lockTime[i]);
+            }
+        });
+
     // Input
     struct InputBinding {
         std::vector<BitcoinLikeBlockchainExplorerInput> input;
@@ -162,6 +182,17 @@ namespace {
                 use(b.sequence);
         });
 
+    const auto COPY_INPUT = db::copy<InputBinding>(
+        "bitcoin_inputs",
+        {"uid", "previous_output_idx", "previous_tx_hash", "previous_tx_uid", "amount", "address", "coinbase", "sequence"},
+        "uid", "DO NOTHING",
+        [](auto &w, auto &b) {
+            for (size_t i = 0; i < b.uid.size(); i++) {
+                w.row().text(b.uid[i]).int4(b.previousTxOutputIndex[i]).text(b.previousTxHash[i]).text(b.prevBtcTxUid[i])
+                    .int8(b.amount[i]).text(b.address[i]).text(b.coinbase[i]).int8(b.sequence[i]);
+            }
+        });
+
     // Transaction inputs
     struct TransactionInputBinding {
         std::vector<std::string> txUid;
@@ -191,6 +222,15 @@ namespace {
             s, use(b.txUid), use(b.txHash), use(b.inputUid), use(b.inputIdx);
         });
 
+    const auto COPY_TRANSACTION_INPUT = db::copy<TransactionInputBinding>(
+        "bitcoin_transaction_inputs", {"transaction_uid", "transaction_hash", "input_uid", "input_idx"},
+        "transaction_uid, input_uid", "DO NOTHING",
+        [](auto &w, auto &b) {
+            for (size_t i = 0; i < b.txUid.size(); i++) {
+                w.row().text(b.txUid[i]).text(b.txHash[i]).text(b.inputUid[i]).int4(b.inputIdx[i]);
+            }
+        });
+
     // Output
     struct OutputBinding {
         std::vector<uint64_t> amount;
@@ -239,6 +279,17 @@ namespace {
                 use(b.script), use(b.address), use(b.accountUid),
                 use(b.blockHeight), use(b.replaceable);
         });
+
+    const auto COPY_OUTPUT = db::copy<OutputBinding>(
+        "bitcoin_outputs",
+        {"idx", "transaction_uid", "transaction_hash", "amount", "script", "address", "account_uid", "block_height", "replaceable"},
+        "idx, transaction_uid", "DO UPDATE SET block_height = excluded.block_height",
+        [](auto &w, auto &b) {
+            for (size_t i = 0; i < b.index.size(); i++) {
+                w.row().int4(b.index[i]).text(b.txUid[i]).text(b.txHash[i]).int8(b.amount[i]).text(b.script[i])
+                    .text(b.address[i]).text(b.accountUid[i]).int8(b.blockHeight[i]).int4(b.replaceable[i]);
+            }
+        });
 } // namespace
 
 namespace ledger {
@@ -246,6 +297,12 @@ namespace ledger {
 
         void BitcoinLikeOperationDatabaseHelper::bulkInsert(soci::session &sql,
                                                             const std::vector<Operation> &operations) {
+            bulkInsert(sql, operations, operations.size() >= COPY_MIN_OPERATIONS && PostgreSQLCopyWriter::isSupported(sql));
+        }
+
+        void BitcoinLikeOperationDatabaseHelper::bulkInsert(soci::session &sql,
+                                                            const std::vector<Operation> &operations,
+                                                            bool useCopy) {
             if (operations.empty())
                 return;
             Benchmarker rawInsert("raw_db_insert", nullptr);
@@ -258,13 +315,17 @@ namespace ledger {
             PreparedStatement<InputBinding> inputStmt;
             PreparedStatement<OutputBinding> outputStmt;
 
-            BulkInsertDatabaseHelper::UPSERT_OPERATION(sql, operationStmt);
-            BulkInsertDatabaseHelper::UPSERT_BLOCK(sql, blockStmt);
-            UPSERT_BITCOIN_OPERATION(sql, bitcoinOpStmt);
-            UPSERT_TRANSACTION(sql, transactionStmt);
-            UPSERT_TRANSACTION_INPUT(sql, transactionInputStmt);
-            UPSERT_INPUT(sql, inputStmt);
-            UPSERT_OUTPUT(sql, outputStmt);
+            if (!useCopy) {
+                BulkInsertDatabaseHelper::UPSERT_OPERATION(sql, operationStmt);
+                BulkInsertDatabaseHelper::UPSERT_BLOCK(sql, blockStmt);
+                UPSERT_BITCOIN_OPERATION(sql, bitcoinOpStmt);
+                UPSERT_TRANSACTION(sql, transactionStmt);
+                UPSERT_TRANSACTION_INPUT(sql, transactionInputStmt);
+                UPSERT_INPUT(sql, inputStmt);
+                UPSERT_OUTPUT(sql, outputStmt);
+            }
+            BitcoinLikeOutputReference receivedOutputs;
+            BitcoinLikeOutputReference spentOutputs;
 
             for (const auto &op : operations) {
                 if (op.block.hasValue()) {
@@ -304,6 +365,9 @@ namespace ledger {
                     std::string prevBtcTxUid;
                     if (input.previousTxHash.nonEmpty() && input.previousTxHash.getValue() != emptyPreviousTxHash) {
                         prevBtcTxUid = BitcoinLikeTransactionDatabaseHelper::createBitcoinTransactionUid(op.accountUid, input.previousTxHash.getValue());
+                        if (input.previousTxOutputIndex.nonEmpty()) {
+                            spentOutputs.add(prevBtcTxUid, input.previousTxOutputIndex.getValue());
+                        }
                     }
                     inputStmt.bindings.update(input, inputUid, prevBtcTxUid, op.accountUid);
                     transactionInputStmt.bindings.update(txUid, tx.hash, inputUid, input.index);
@@ -319,6 +383,7 @@ namespace ledger {
                 for (const auto &output : tx.outputs) {
                     if (output.accountUid.hasValue() && output.accountUid.getValue() == op.accountUid) {
                         outputStmt.bindings.update(output, replaceable && tx.block.isEmpty(), txUid, tx.hash);
+                        receivedOutputs.add(txUid, output.index);
                     } else { // merge all foreign outputs on a single one
                         foreignOutput += output;
                     }
@@ -330,22 +395,43 @@ namespace ledger {
                 // Bitcoin operation
                 bitcoinOpStmt.bindings.update(op.uid, txUid, tx.hash);
             }
-            // Bulk insert block (dependency for operation and bitcoin transaction)
-            if (!blockStmt.bindings.uid.empty())
-                blockStmt.execute();
-            // Bulk insert transaction (dependency of bitcoin_input,
-            // bitcoin_transaction_input and  bitcoin_output)
-            transactionStmt.execute();
-            // Bulk insert outputs
-            outputStmt.execute();
-            // Bulk insert bitcoin_input (dependency of bitcoin_transaction_inputs)
-            inputStmt.execute();
-            // Bulk insert  bitcoin_transaction_inputs
-            transactionInputStmt.execute();
-            // Bulk insert operations (dependency of  bitcoin operations)
-            operationStmt.execute();
-            // Bulk insert bitcoin operations
-            bitcoinOpStmt.execute();
+            if (useCopy) {
+                // Same dependency order as below, one COPY and one merge per table
+                if (!blockStmt.bindings.uid.empty())
+                    BulkInsertDatabaseHelper::COPY_BLOCK(sql, blockStmt.bindings);
+                COPY_TRANSACTION(sql, transactionStmt.bindings);
+                COPY_OUTPUT(sql, outputStmt.bindings);
+                if (!inputStmt.bindings.uid.empty()) {
+                    COPY_INPUT(sql, inputStmt.bindings);
+                    COPY_TRANSACTION_INPUT(sql, transactionInputStmt.bindings);
+                }
+            } else {
+                // Bulk insert block (dependency for operation and bitcoin transaction)
+                if (!blockStmt.bindings.uid.empty())
+                    blockStmt.execute();
+                // Bulk insert transaction (dependency of bitcoin_input,
+                // bitcoin_transaction_input and  bitcoin_output)
+                transactionStmt.execute();
+                // Bulk insert outputs
+                outputStmt.execute();
+                // Bulk insert bitcoin_input (dependency of bitcoin_transaction_inputs)
+                inputStmt.execute();
+                // Bulk insert  bitcoin_transaction_inputs
+                transactionInputStmt.execute();
+            }
+            // Keep the materialized UTXO set up to date, new outputs first so that
+            // outputs created and spent within this batch end up removed
+            BitcoinLikeUTXODatabaseHelper::insertUnspentOutputs(sql, receivedOutputs);
+            BitcoinLikeUTXODatabaseHelper::removeSpentOutputs(sql, spentOutputs);
+            if (useCopy) {
+                BulkInsertDatabaseHelper::COPY_OPERATION(sql, operationStmt.bindings);
+                COPY_BITCOIN_OPERATION(sql, bitcoinOpStmt.bindings);
+            } else {
+                // Bulk insert operations (dependency of  bitcoin operations)
+                operationStmt.execute();
+                // Bulk insert bitcoin operations
+                bitcoinOpStmt.execute();
+            }
 
             rawInsert.stop();
         }
@@ -39,7 +39,12 @@ namespace ledger {
     namespace core {
         class BitcoinLikeOperationDatabaseHelper {
           public:
+            // Below this many operations, staging tables cost more than they save and prepared statements are used
+            static constexpr size_t COPY_MIN_OPERATIONS = 200;
+
+            // Streams the batch with COPY when the session is a PostgreSQL one and the batch is large enough
             static void bulkInsert(soci::session &sql, const std::vector<Operation> &operations);
+            static void bulkInsert(soci::session &sql, const std::vector<Operation> &operations, bool useCopy);
         };
     } // namespace core
 } // namespace ledger
@@ -30,11 +30,15 @@
  */
 #include "BitcoinLikeTransactionDatabaseHelper.h"
 
+#include <algorithm>
 #include <crypto/SHA256.hpp>
+#include <database/soci-backend-utils.h>
 #include <database/soci-date.h>
 #include <database/soci-number.h>
 #include <database/soci-option.h>
 #include <iostream>
+#include <wallet/bitcoin/database/BitcoinLikeUTXODatabaseHelper.h>
+#include <wallet/common/database/BalanceCheckpointDatabaseHelper.h>
 #include <wallet/common/database/BlockDatabaseHelper.h>
 using namespace std;
 
@@ -78,10 +82,7 @@ namespace ledger {
             return false;
         }
 
-        bool BitcoinLikeTransactionDatabaseHelper::inflateTransaction(soci::session &sql,
-                                                                      const soci::row &row,
-                                                                      const std::string &accountUid,
-                                                                      BitcoinLikeBlockchainExplorerTransaction &out) {
+        static void inflateTransactionHeader(const soci::row &row, BitcoinLikeBlockchainExplorerTransaction &out) {
             out.hash       = row.get<std::string>(0);
             out.version    = (uint32_t)row.get<int32_t>(1);
             out.receivedAt = row.get<std::chrono::system_clock::time_point>(2);
@@ -94,6 +95,43 @@ namespace ledger {
                 block.currencyName = row.get<std::string>(7);
                 out.block          = block;
             }
+        }
+
+        // Columns of the input and output rows start at offset
+        static BitcoinLikeBlockchainExplorerInput inflateInput(const soci::row &inputRow, std::size_t offset) {
+            BitcoinLikeBlockchainExplorerInput input;
+            input.index                 = get_number<uint64_t>(inputRow, offset);
+            input.previousTxOutputIndex = inputRow.get<Option<int>>(offset + 1).map<uint32_t>([](const int &v) {
+                return (uint32_t)v;
+            });
+            input.previousTxHash        = inputRow.get<Option<std::string>>(offset + 2);
+            input.value                 = inputRow.get<Option<long long>>(offset + 3).map<BigInt>([](const unsigned long long &v) {
+                return BigInt(v);
+            });
+            input.address               = inputRow.get<Option<std::string>>(offset + 4);
+            input.coinbase              = inputRow.get<Option<std::string>>(offset + 5);
+            input.sequence              = get_number<uint32_t>(inputRow, offset + 6);
+            return input;
+        }
+
+        static BitcoinLikeBlockchainExplorerOutput inflateOutput(const soci::row &outputRow, std::size_t offset) {
+            BitcoinLikeBlockchainExplorerOutput output;
+            output.index = (uint64_t)outputRow.get<int>(offset);
+            output.value.assignScalar(outputRow.get<long long>(offset + 1));
+            output.script  = outputRow.get<std::string>(offset + 2);
+            output.address = outputRow.get<Option<std::string>>(offset + 3);
+            if (outputRow.get_indicator(offset + 4) != i_null) {
+                output.blockHeight = soci::get_number<uint64_t>(outputRow, offset + 4);
+            }
+            output.replaceable = soci::get_number<int>(outputRow, offset + 5) == 1;
+            return output;
+        }
+
+        bool BitcoinLikeTransactionDatabaseHelper::inflateTransaction(soci::session &sql,
+                                                                      const soci::row &row,
+                                                                      const std::string &accountUid,
+                                                                      BitcoinLikeBlockchainExplorerTransaction &out) {
+            inflateTransactionHeader(row, out);
 
             auto btcTxUid               = BitcoinLikeTransactionDatabaseHelper::createBitcoinTransactionUid(accountUid, out.hash);
 
@@ -105,19 +143,7 @@ namespace ledger {
                                                           "WHERE ti.transaction_uid = :txuid ORDER BY ti.input_idx",
                                            use(btcTxUid));
             for (auto &inputRow : inputRows) {
-                BitcoinLikeBlockchainExplorerInput input;
-                input.index                 = get_number<uint64_t>(inputRow, 0);
-                input.previousTxOutputIndex = inputRow.get<Option<int>>(1).map<uint32_t>([](const int &v) {
-                    return (uint32_t)v;
-                });
-                input.previousTxHash        = inputRow.get<Option<std::string>>(2);
-                input.value                 = inputRow.get<Option<long long>>(3).map<BigInt>([](const unsigned long long &v) {
-                    return BigInt(v);
-                });
-                input.address               = inputRow.get<Option<std::string>>(4);
-                input.coinbase              = inputRow.get<Option<std::string>>(5);
-                input.sequence              = get_number<uint32_t>(inputRow, 6);
-                out.inputs.push_back(input);
+                out.inputs.push_back(inflateInput(inputRow, 0));
             }
 
             // Fetch outputs
@@ -131,22 +157,101 @@ namespace ledger {
                                             use(out.hash), use(btcTxUid));
 
             for (auto &outputRow : outputRows) {
-                BitcoinLikeBlockchainExplorerOutput output;
-                output.index = (uint64_t)outputRow.get<int>(0);
-                output.value.assignScalar(outputRow.get<long long>(1));
-                output.script  = outputRow.get<std::string>(2);
-                output.address = outputRow.get<Option<std::string>>(3);
-                if (outputRow.get_indicator(4) != i_null) {
-                    output.blockHeight = soci::get_number<uint64_t>(outputRow, 4);
-                }
-                output.replaceable = soci::get_number<int>(outputRow, 5) == 1;
-                out.outputs.push_back(std::move(output));
+                out.outputs.push_back(inflateOutput(outputRow, 0));
             }
 
             // Enjoy the silence.
             return true;
         }
 
+        void BitcoinLikeTransactionDatabaseHelper::getTransactionsByOperationUids(soci::session &sql,
+                                                                                  const std::vector<std::string> &operationUids,
+                                                                                  std::unordered_map<std::string, BitcoinLikeBlockchainExplorerTransaction> &out) {
+            // Operation uid -> bitcoin transaction uid, the latter being specific to the account
+            std::unordered_map<std::string, std::string> operationTransactions;
+            std::unordered_map<std::string, std::string> transactionHashes;
+            for_each_row_in(sql,
+                            "SELECT bop.uid, op.account_uid, bop.transaction_hash "
+                            "FROM bitcoin_operations AS bop "
+                            "JOIN operations AS op ON op.uid = bop.uid "
+                            "WHERE bop.uid IN ({})",
+                            operationUids,
+                            [&](const soci::row &row) {
+                                auto hash     = row.get<std::string>(2);
+                                auto btcTxUid = createBitcoinTransactionUid(row.get<std::string>(1), hash);
+                                operationTransactions[row.get<std::string>(0)] = btcTxUid;
+                                transactionHashes[btcTxUid]                  = hash;
+                            });
+            if (transactionHashes.empty()) {
+                return;
+            }
+
+            std::vector<std::string> hashes;
+            std::vector<std::string> btcTxUids;
+            for (const auto &transactionHash : transactionHashes) {
+                btcTxUids.push_back(transactionHash.first);
+                hashes.push_back(transactionHash.second);
+            }
+            std::sort(hashes.begin(), hashes.end());
+            hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+
+            std::unordered_map<std::string, BitcoinLikeBlockchainExplorerTransaction> headers;
+            for_each_row_in(sql,
+                            "SELECT  tx.hash, tx.version, tx.time, tx.locktime, "
+                            "block.hash, block.height, block.time, block.currency_name "
+                            "FROM bitcoin_transactions AS tx "
+                            "LEFT JOIN blocks AS block ON tx.block_uid = block.uid "
+                            "WHERE tx.hash IN ({})",
+                            hashes,
+                            [&](const soci::row &row) {
+                                auto hash = row.get<std::string>(0);
+                                if (headers.find(hash) == headers.end()) {
+                                    inflateTransactionHeader(row, headers[hash]);
+                                }
+                            });
+
+            std::unordered_map<std::string, BitcoinLikeBlockchainExplorerTransaction> transactions;
+            for (const auto &transactionHash : transactionHashes) {
+                auto header = headers.find(transactionHash.second);
+                if (header != headers.end()) {
+                    transactions[transactionHash.first] = header->second;
+                }
+            }
+
+            for_each_row_in(sql,
+                            "SELECT ti.transaction_uid, ti.input_idx, i.previous_output_idx, i.previous_tx_hash, i.amount, i.address, i.coinbase,"
+                            "i.sequence "
+                            "FROM bitcoin_transaction_inputs AS ti "
+                            "INNER JOIN bitcoin_inputs AS i ON ti.input_uid = i.uid "
+                            "WHERE ti.transaction_uid IN ({}) ORDER BY ti.transaction_uid, ti.input_idx",
+                            btcTxUids,
+                            [&](const soci::row &row) {
+                                auto transaction = transactions.find(row.get<std::string>(0));
+                                if (transaction != transactions.end()) {
+                                    transaction->second.inputs.push_back(inflateInput(row, 1));
+                                }
+                            });
+
+            for_each_row_in(sql,
+                            "SELECT transaction_uid, idx, amount, script, address, block_height, replaceable "
+                            "FROM bitcoin_outputs WHERE transaction_uid IN ({}) "
+                            "ORDER BY transaction_uid, idx",
+                            btcTxUids,
+                            [&](const soci::row &row) {
+                                auto transaction = transactions.find(row.get<std::string>(0));
+                                if (transaction != transactions.end()) {
+                                    transaction->second.outputs.push_back(inflateOutput(row, 1));
+                                }
+                            });
+
+            for (const auto &operationTransaction : operationTransactions) {
+                auto transaction = transactions.find(operationTransaction.second);
+                if (transaction != transactions.end()) {
+                    out[operationTransaction.first] = transaction->second;
+                }
+            }
+        }
+
         void BitcoinLikeTransactionDatabaseHelper::getMempoolTransactions(soci::session &sql, const std::string &accountUid, std::vector<BitcoinLikeBlockchainExplorerTransaction> &out) {
             // Query all transaction
             rowset<row> txRows = (sql.prepare << "SELECT  tx.hash, tx.version, tx.time, tx.locktime, "
@@ -170,12 +275,14 @@ namespace ledger {
 
         void BitcoinLikeTransactionDatabaseHelper::removeAllMempoolOperation(soci::session &sql,
                                                                              const std::string &accountUid) {
+            BalanceCheckpointDatabaseHelper::invalidateMempoolCheckpoints(sql, accountUid);
             rowset<std::string> rows = (sql.prepare << "SELECT transaction_uid FROM bitcoin_operations AS bop "
                                                        "JOIN operations AS op ON bop.uid = op.uid "
                                                        "WHERE op.account_uid = :uid AND op.block_uid IS NULL",
                                         use(accountUid));
             std::vector<std::string> txToDelete(rows.begin(), rows.end());
             if (!txToDelete.empty()) {
+                auto spentOutputs = BitcoinLikeUTXODatabaseHelper::getOutputsSpentBy(sql, txToDelete);
                 sql << "DELETE FROM bitcoin_inputs WHERE uid IN ("
                        "SELECT input_uid FROM bitcoin_transaction_inputs "
                        "WHERE transaction_uid IN(:uids)"
@@ -185,6 +292,8 @@ namespace ledger {
                 sql << "DELETE FROM bitcoin_transactions "
                        "WHERE transaction_uid IN (:uids)",
                     use(txToDelete);
+                // Outputs spent by the erased transactions are unspent again
+                BitcoinLikeUTXODatabaseHelper::insertUnspentOutputs(sql, spentOutputs);
             }
         }
 
@@ -192,6 +301,7 @@ namespace ledger {
             soci::session &sql,
             const std::string &accountUid,
             const std::chrono::system_clock::time_point &date) {
+            BalanceCheckpointDatabaseHelper::invalidateCheckpoints(sql, accountUid, date);
             rowset<std::string> rows = (sql.prepare << "SELECT transaction_uid FROM bitcoin_operations AS bop "
                                                        "JOIN operations AS op ON bop.uid = op.uid "
                                                        "WHERE op.account_uid = :uid AND op.date >= :date",
@@ -200,6 +310,7 @@ namespace ledger {
             if (!txToDelete.empty()) {
                 sql << "DELETE FROM operations WHERE account_uid = :account_uid AND date >= :date",
                     use(accountUid), use(date);
+                auto spentOutputs = BitcoinLikeUTXODatabaseHelper::getOutputsSpentBy(sql, txToDelete);
                 sql << "DELETE FROM bitcoin_inputs WHERE uid IN ("
                        "SELECT input_uid FROM bitcoin_transaction_inputs "
                        "WHERE transaction_uid IN(:uids)"
@@ -208,6 +319,8 @@ namespace ledger {
                 sql << "DELETE FROM bitcoin_transactions "
                        "WHERE transaction_uid IN (:uids)",
                     use(txToDelete);
+                // Outputs spent by the erased transactions are unspent again
+                BitcoinLikeUTXODatabaseHelper::insertUnspentOutputs(sql, spentOutputs);
             }
         }
 
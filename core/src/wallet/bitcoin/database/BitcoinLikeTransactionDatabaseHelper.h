@@ -32,6 +32,7 @@
 #define LEDGER_CORE_BITCOINLIKETRANSACTIONDATABASEHELPER_H
 
 #include <soci.h>
+#include <unordered_map>
 #include <wallet/bitcoin/explorers/BitcoinLikeBlockchainExplorer.hpp>
 
 namespace ledger {
@@ -54,6 +55,17 @@ namespace ledger {
                                                   const std::string &accountUid,
                                                   BitcoinLikeBlockchainExplorerTransaction &out);
 
+            /**
+             * Get the transactions of a batch of operations from database, with one query per table
+             * instead of one query per table and per operation.
+             * @param sql
+             * @param operationUids
+             * @param out This map is filled with the transaction of every operation, indexed by operation uid.
+             */
+            static void getTransactionsByOperationUids(soci::session &sql,
+                                                       const std::vector<std::string> &operationUids,
+                                                       std::unordered_map<std::string, BitcoinLikeBlockchainExplorerTransaction> &out);
+
             /**
              * Get all mempool transactions for the given account from database.
              * @param sql
@@ -31,6 +31,8 @@
 
 #include "BitcoinLikeUTXODatabaseHelper.h"
 
+#include <database/StatementCache.hpp>
+#include <database/soci-backend-utils.h>
 #include <database/soci-number.h>
 #include <database/soci-option.h>
 #include <utils/Option.hpp>
@@ -40,31 +42,73 @@ using namespace soci;
 
 namespace ledger {
     namespace core {
+        namespace {
+            struct CountUTXOBinding {
+                std::string accountUid;
+                int64_t dustAmount;
+                int64_t count;
+            };
+
+            const auto COUNT_UTXO = db::stmt<CountUTXOBinding>(
+                "SELECT COUNT(*) FROM bitcoin_utxos AS u "
+                " JOIN bitcoin_outputs AS o ON o.transaction_uid = u.transaction_uid AND o.idx = u.idx"
+                " WHERE u.account_uid = :uid AND u.amount > :dustAmount AND o.address IS NOT NULL",
+                [](auto &s, auto &b) {
+                    s, use(b.accountUid), use(b.dustAmount), into(b.count);
+                });
+
+            struct BalanceBinding {
+                std::string accountUid;
+                BigInt balance;
+                indicator balanceIndicator;
+            };
+
+            constexpr auto uncachedBalanceQuery = R"(
+                SELECT sum(u.amount)::bigint
+                FROM bitcoin_utxos AS u
+                WHERE u.account_uid = :uid)";
+
+            const auto SELECT_UNCACHED_BALANCE = db::stmt<BalanceBinding>(
+                uncachedBalanceQuery,
+                [](auto &s, auto &b) {
+                    s, use(b.accountUid), into(b.balance, b.balanceIndicator);
+                });
+
+            const auto SELECT_BALANCE = db::stmt<BalanceBinding>(
+                "SELECT balance from bitcoin_accounts WHERE uid=:uid",
+                [](auto &s, auto &b) {
+                    s, use(b.accountUid), into(b.balance, b.balanceIndicator);
+                });
+
+            // Runs one of the balance statements, a missing row or a NULL balance reads as empty
+            Option<BigInt> queryBalance(soci::session &sql, const StatementDeclaration<BalanceBinding> &declaration, const std::string &accountUid) {
+                return db::withStatement(sql, declaration, [&](PreparedStatement<BalanceBinding> &stmt) {
+                    stmt.bindings.accountUid       = accountUid;
+                    stmt.bindings.balanceIndicator = i_null;
+                    stmt.execute();
+                    return stmt.bindings.balanceIndicator != i_null ? Option<BigInt>(stmt.bindings.balance) : Option<BigInt>();
+                });
+            }
+        } // namespace
 
         std::size_t BitcoinLikeUTXODatabaseHelper::UTXOcount(soci::session &sql, const std::string &accountUid, int64_t dustAmount) {
-            const rowset<row> rows = (sql.prepare << "SELECT o.address FROM bitcoin_outputs AS o "
-                                                     " LEFT OUTER JOIN bitcoin_inputs AS i ON i.previous_tx_uid = o.transaction_uid "
-                                                     " AND i.previous_output_idx = o.idx"
-                                                     " WHERE i.previous_tx_uid IS NULL AND o.account_uid = :uid AND o.amount > :dustAmount",
-                                      use(accountUid), use(dustAmount));
-            std::size_t count      = 0;
-            for (auto &row : rows) {
-                if (row.get_indicator(0) != i_null) {
-                    count += 1;
-                }
-            }
-            return count;
+            return db::withStatement(sql, COUNT_UTXO, [&](PreparedStatement<CountUTXOBinding> &stmt) {
+                stmt.bindings.accountUid = accountUid;
+                stmt.bindings.dustAmount = dustAmount;
+                stmt.bindings.count      = 0;
+                stmt.execute();
+                return static_cast<std::size_t>(stmt.bindings.count);
+            });
         }
 
         std::size_t
         BitcoinLikeUTXODatabaseHelper::queryUTXO(soci::session &sql, const std::string &accountUid, int32_t offset, int32_t count, int64_t dustAmount, std::vector<BitcoinLikeBlockchainExplorerOutput> &out) {
             const rowset<row> rows = (sql.prepare << "SELECT o.address, o.idx, o.transaction_hash, o.amount, o.script, o.block_height,"
                                                      "replaceable"
-                                                     " FROM bitcoin_outputs AS o "
-                                                     " LEFT OUTER JOIN bitcoin_inputs AS i ON i.previous_tx_uid = o.transaction_uid "
-                                                     " AND i.previous_output_idx = o.idx"
-                                                     " WHERE i.previous_tx_uid IS NULL AND o.account_uid = :uid AND o.amount > :dustAmount"
-                                                     " ORDER BY block_height LIMIT :count OFFSET :off",
+                                                     " FROM bitcoin_utxos AS u "
+                                                     " JOIN bitcoin_outputs AS o ON o.transaction_uid = u.transaction_uid AND o.idx = u.idx"
+                                                     " WHERE u.account_uid = :uid AND u.amount > :dustAmount"
+                                                     " ORDER BY o.block_height LIMIT :count OFFSET :off",
                                       use(accountUid), use(dustAmount), use(count), use(offset));
 
             for (auto &row : rows) {
@@ -86,39 +130,17 @@ namespace ledger {
             return out.size();
         }
 
-        constexpr auto uncachedBalanceQuery = R"(
-                SELECT sum(o.amount)::bigint
-                FROM bitcoin_outputs AS o
-                    LEFT OUTER JOIN bitcoin_inputs AS i ON i.previous_tx_uid = o.transaction_uid
-                    AND i.previous_output_idx = o.idx
-                WHERE i.previous_tx_uid IS NULL
-                    AND o.account_uid = :uid)";
-
         BigInt getUncachedBalance(soci::session &sql, const std::string &accountUid) {
-            const rowset<soci::row> rows = (sql.prepare << uncachedBalanceQuery, use(accountUid));
-            for (auto &row : rows) {
-                if (row.get_indicator(0) != i_null) {
-                    return row.get<BigInt>(0);
-                }
-            }
-            return BigInt(0);
+            return queryBalance(sql, SELECT_UNCACHED_BALANCE, accountUid).getValueOr(BigInt(0));
         }
 
         BigInt BitcoinLikeUTXODatabaseHelper::getBalance(soci::session &sql, const std::string &accountUid) {
-            const rowset<row> rows = (sql.prepare << "SELECT balance from bitcoin_accounts WHERE uid=:uid",
-                                      use(accountUid));
-
-            for (auto &row : rows) {
-                if (row.get_indicator(0) != i_null) {
-                    auto balance = row.get<BigInt>(0);
-                    if (balance.isNegative()) {
-                        // We compute balance from DB instead of updating it, to let only the sync (lama-bitcoin or libcore, depending on the coin) doing the update
-                        return getUncachedBalance(sql, accountUid);
-                    }
-                    return balance;
-                }
+            auto balance = queryBalance(sql, SELECT_BALANCE, accountUid);
+            if (balance.nonEmpty() && balance->isNegative()) {
+                // We compute balance from DB instead of updating it, to let only the sync (lama-bitcoin or libcore, depending on the coin) doing the update
+                return getUncachedBalance(sql, accountUid);
             }
-            return BigInt(0);
+            return balance.getValueOr(BigInt(0));
         }
 
         void BitcoinLikeUTXODatabaseHelper::updateBalance(session &sql, const std::string &accountUid) {
@@ -132,9 +154,9 @@ namespace ledger {
             api::Currency const &currency,
             int64_t dustAmount) {
             const soci::rowset<soci::row> rows = (session.prepare << "SELECT o.address, o.idx, o.transaction_hash, o.amount, o.script, o.block_height "
-                                                                     "FROM bitcoin_outputs AS o "
-                                                                     "LEFT OUTER JOIN bitcoin_inputs AS i ON i.previous_tx_uid = o.transaction_uid AND i.previous_output_idx = o.idx "
-                                                                     "WHERE i.previous_tx_uid IS NULL AND o.account_uid = :uid AND o.amount > :dustAmount "
+                                                                     "FROM bitcoin_utxos AS u "
+                                                                     "JOIN bitcoin_outputs AS o ON o.transaction_uid = u.transaction_uid AND o.idx = u.idx "
+                                                                     "WHERE u.account_uid = :uid AND u.amount > :dustAmount "
                                                                      "ORDER BY o.block_height",
                                                   use(accountUid), use(dustAmount));
 
@@ -157,5 +179,42 @@ namespace ledger {
 
             return utxos;
         }
+
+        void BitcoinLikeUTXODatabaseHelper::insertUnspentOutputs(soci::session &sql, const BitcoinLikeOutputReference &outputs) {
+            if (outputs.empty()) {
+                return;
+            }
+            sql << "INSERT INTO bitcoin_utxos "
+                   "SELECT o.idx, o.transaction_uid, o.account_uid, o.amount FROM bitcoin_outputs AS o "
+                   "WHERE o.transaction_uid = :tx_uid AND o.idx = :idx AND o.account_uid IS NOT NULL "
+                   "AND NOT EXISTS (SELECT 1 FROM bitcoin_inputs AS i "
+                   "WHERE i.previous_tx_uid = o.transaction_uid AND i.previous_output_idx = o.idx) "
+                   "ON CONFLICT DO NOTHING",
+                use(outputs.transactionUids), use(outputs.indexes);
+        }
+
+        void BitcoinLikeUTXODatabaseHelper::removeSpentOutputs(soci::session &sql, const BitcoinLikeOutputReference &outputs) {
+            if (outputs.empty()) {
+                return;
+            }
+            sql << "DELETE FROM bitcoin_utxos WHERE transaction_uid = :tx_uid AND idx = :idx",
+                use(outputs.transactionUids), use(outputs.indexes);
+        }
+
+        BitcoinLikeOutputReference BitcoinLikeUTXODatabaseHelper::getOutputsSpentBy(soci::session &sql,
+                                                                                   const std::vector<std::string> &transactionUids) {
+            BitcoinLikeOutputReference outputs;
+            soci::for_each_row_in(sql,
+                                  "SELECT i.previous_tx_uid, i.previous_output_idx FROM bitcoin_inputs AS i "
+                                  "JOIN bitcoin_transaction_inputs AS ti ON ti.input_uid = i.uid "
+                                  "WHERE ti.transaction_uid IN ({}) "
+                                  "AND i.previous_tx_uid IS NOT NULL AND i.previous_tx_uid <> '' "
+                                  "AND i.previous_output_idx IS NOT NULL",
+                                  transactionUids,
+                                  [&outputs](const row &row) {
+                                      outputs.add(row.get<std::string>(0), get_number<int32_t>(row, 1));
+                                  });
+            return outputs;
+        }
     } // namespace core
 } // namespace ledger
@@ -38,6 +38,21 @@
 
 namespace ledger {
     namespace core {
+        // Reference to an output (transaction uid and output index)
+        struct BitcoinLikeOutputReference {
+            std::vector<std::string> transactionUids;
+            std::vector<int32_t> indexes;
+
+            void add(const std::string &transactionUid, int32_t index) {
+                transactionUids.push_back(transactionUid);
+                indexes.push_back(index);
+            }
+
+            bool empty() const {
+                return transactionUids.empty();
+            }
+        };
+
         class BitcoinLikeUTXODatabaseHelper {
             BitcoinLikeUTXODatabaseHelper()  = delete;
 
@@ -67,6 +82,18 @@ namespace ledger {
                 std::string const &accountUid,
                 api::Currency const &currency,
                 int64_t dustAmount);
+
+            // Maintenance of the materialized bitcoin_utxos set.
+            // Add the given outputs to the set, unless they belong to no account or are already spent
+            static void insertUnspentOutputs(soci::session &sql, const BitcoinLikeOutputReference &outputs);
+
+            // Remove outputs consumed by new inputs from the set
+            static void removeSpentOutputs(soci::session &sql, const BitcoinLikeOutputReference &outputs);
+
+            // Outputs spent by the inputs of the given transactions. To be called before erasing
+            // those transactions, then given to insertUnspentOutputs once they are erased.
+            static BitcoinLikeOutputReference getOutputsSpentBy(soci::session &sql,
+                                                                const std::vector<std::string> &transactionUids);
         };
     } // namespace core
 } // namespace ledger
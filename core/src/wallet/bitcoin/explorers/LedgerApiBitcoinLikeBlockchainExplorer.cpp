@@ -48,6 +48,8 @@ namespace ledger {
             _http            = http;
             _parameters      = parameters;
             _explorerVersion = configuration->getString(api::Configuration::BLOCKCHAIN_EXPLORER_VERSION).value_or("v3");
+            _paging.setMaxStreams(configuration->getInt(api::Configuration::BLOCKCHAIN_EXPLORER_MAX_PARALLEL_REQUESTS)
+                                      .value_or(api::ConfigurationDefaults::DEFAULT_BLOCKCHAIN_EXPLORER_MAX_PARALLEL_REQUESTS));
         }
 
         Future<String> LedgerApiBitcoinLikeBlockchainExplorer::pushLedgerApiTransaction(const std::vector<uint8_t> &transaction, const std::string &correlationId) {
@@ -96,6 +98,21 @@ namespace ledger {
             return getLedgerApiTransactions(addresses, fromBlockHash, session, isSnakeCase);
         }
 
+        std::vector<std::string> LedgerApiBitcoinLikeBlockchainExplorer::getTransactionAddresses(const BitcoinLikeBlockchainExplorerTransaction &transaction) const {
+            std::vector<std::string> addresses;
+            for (const auto &input : transaction.inputs) {
+                if (input.address.nonEmpty()) {
+                    addresses.push_back(input.address.getValue());
+                }
+            }
+            for (const auto &output : transaction.outputs) {
+                if (output.address.nonEmpty()) {
+                    addresses.push_back(output.address.getValue());
+                }
+            }
+            return addresses;
+        }
+
         FuturePtr<BitcoinLikeBlockchainExplorer::Block> LedgerApiBitcoinLikeBlockchainExplorer::getCurrentBlock() const {
             auto optBlock = _blockCache.get("lastBlock");
             if (optBlock.hasValue()) {
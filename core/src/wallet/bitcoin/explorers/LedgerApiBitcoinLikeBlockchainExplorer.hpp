@@ -81,6 +81,9 @@ namespace ledger {
             std::string getExplorerVersion() const override;
             Future<std::vector<std::shared_ptr<api::BigInt>>> getFees() override;
 
+          protected:
+            std::vector<std::string> getTransactionAddresses(const BitcoinLikeBlockchainExplorerTransaction &transaction) const override;
+
           private:
             api::BitcoinLikeNetworkParameters _parameters;
             std::string _explorerVersion;
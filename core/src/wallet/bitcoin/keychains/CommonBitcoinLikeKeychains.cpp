@@ -33,6 +33,7 @@
 #include "api/Configuration.hpp"
 #include "api/DynamicObject.hpp"
 #include "bitcoin/BitcoinLikeAddress.hpp"
+#include "bitcoin/BitcoinLikeExtendedPublicKey.hpp"
 #include "boost/iostreams/device/array.hpp"
 #include "boost/iostreams/stream.hpp"
 #include "cereal/archives/binary.hpp"
@@ -134,71 +135,34 @@ namespace ledger {
             return true;
         }
 
-        // TODO the two following methods are similar. Merge them if possible
         std::vector<BitcoinLikeKeychain::Address> CommonBitcoinLikeKeychains::getAllObservableAddresses(uint32_t from, uint32_t to) {
-            auto currency = getCurrency();
             std::vector<BitcoinLikeKeychain::Address> res;
             res.reserve((to - from + 1) * 2);
-            auto preferencesEdit = getPreferences()->edit();
-            bool hasDBChange     = false;
-            for (int iPurpose : {KeyPurpose::RECEIVE, KeyPurpose::CHANGE}) {
-                for (int index = from; index <= to; index++) {
-                    auto localPath = getDerivationScheme()
-                                         .setAccountIndex(getAccountIndex())
-                                         .setCoinType(currency.bip44CoinType)
-                                         .setNode(iPurpose)
-                                         .setAddressIndex(index)
-                                         .getPath()
-                                         .toString();
-                    auto cacheKey = fmt::format("path:{}", localPath);
-                    auto address  = getPreferences()->getString(cacheKey, "");
-
-                    if (address.empty()) {
-                        auto xpub       = iPurpose == KeyPurpose::RECEIVE ? _publicNodeXpub : _internalNodeXpub;
-                        auto p          = getDerivationScheme().getSchemeFrom(DerivationSchemeLevel::NODE).shift(1).setAccountIndex(getAccountIndex()).setCoinType(currency.bip44CoinType).setNode(iPurpose).setAddressIndex(index).getPath().toString();
-                        address         = BitcoinLikeAddress::fromPublicKey(xpub, currency, p, _keychainEngine);
-                        preferencesEdit = preferencesEdit->putString(cacheKey, address)->putString(fmt::format("address:{}", address), localPath);
-                        hasDBChange     = true;
-                    }
-                    res.emplace_back(std::dynamic_pointer_cast<BitcoinLikeAddress>(BitcoinLikeAddress::parse(address, getCurrency(), Option<std::string>(localPath))));
+            bool hasDBChange = false;
+            for (auto purpose : {KeyPurpose::RECEIVE, KeyPurpose::CHANGE}) {
+                auto addresses = deriveRange(purpose, from, to, hasDBChange);
+                for (auto index = from; index <= to; index++) {
+                    res.emplace_back(toAddress(addresses[index - from], getLocalPath(purpose, index)));
                 }
             }
             if (hasDBChange) {
-                preferencesEdit->commit();
+                saveAddressIndex();
             }
             return res;
         }
 
         std::vector<std::string> CommonBitcoinLikeKeychains::getAllObservableAddressString(uint32_t from, uint32_t to) {
-            auto currency = getCurrency();
             std::vector<std::string> res;
             res.reserve((to - from + 1) * 2);
-            auto preferencesEdit = getPreferences()->edit();
-            bool hasDBChange     = false;
-            for (int index = from; index <= to; index++) {
-                for (int iPurpose : {KeyPurpose::RECEIVE, KeyPurpose::CHANGE}) {
-                    auto localPath = getDerivationScheme()
-                                         .setAccountIndex(getAccountIndex())
-                                         .setCoinType(currency.bip44CoinType)
-                                         .setNode(iPurpose)
-                                         .setAddressIndex(index)
-                                         .getPath()
-                                         .toString();
-                    auto p        = getDerivationScheme().getSchemeFrom(DerivationSchemeLevel::NODE).shift(1).setAccountIndex(getAccountIndex()).setCoinType(currency.bip44CoinType).setNode(iPurpose).setAddressIndex(index).getPath().toString();
-                    auto cacheKey = fmt::format("path:{}", localPath);
-                    auto address  = getPreferences()->getString(cacheKey, "");
-
-                    if (address.empty()) {
-                        auto xpub       = iPurpose == KeyPurpose::RECEIVE ? _publicNodeXpub : _internalNodeXpub;
-                        address         = BitcoinLikeAddress::fromPublicKey(xpub, currency, p, _keychainEngine);
-                        preferencesEdit = preferencesEdit->putString(cacheKey, address)->putString(fmt::format("address:{}", address), localPath);
-                        hasDBChange     = true;
-                    }
-                    res.emplace_back(address);
-                }
+            bool hasDBChange = false;
+            auto receive     = deriveRange(KeyPurpose::RECEIVE, from, to, hasDBChange);
+            auto change      = deriveRange(KeyPurpose::CHANGE, from, to, hasDBChange);
+            for (auto i = 0; i < receive.size(); i++) {
+                res.emplace_back(std::move(receive[i]));
+                res.emplace_back(std::move(change[i]));
             }
             if (hasDBChange) {
-                preferencesEdit->commit();
+                saveAddressIndex();
             }
             return res;
         }
@@ -223,33 +187,25 @@ namespace ledger {
 
             KeychainPersistentState state = getState();
             auto startOffset              = (purpose == KeyPurpose::RECEIVE) ? state.maxConsecutiveReceiveIndex : state.maxConsecutiveChangeIndex;
-            std::vector<BitcoinLikeKeychain::Address> result(n);
-            for (auto i = 0; i < n; i++) {
-                result[i] = derive(purpose, startOffset + i);
+            if (n == 0) {
+                return {};
             }
-            return result;
+            return deriveAddresses(purpose, startOffset, startOffset + n - 1);
         }
 
         Option<BitcoinLikeKeychain::KeyPurpose>
         CommonBitcoinLikeKeychains::getAddressPurpose(const std::string &address) const {
-            return getAddressDerivationPath(address).flatMap<KeyPurpose>([](const std::string &p) {
-                DerivationPath derivation(p);
-                if (derivation.getDepth() > 1) {
-                    return Option<KeyPurpose>(derivation.getParent().getLastChildNum() == 0 ? KeyPurpose::RECEIVE : KeyPurpose::CHANGE);
-                } else {
-                    return Option<KeyPurpose>();
-                }
+            return findAddressPosition(address).map<KeyPurpose>([](const DerivedAddressIndex::Position &position) {
+                return position.node == 0 ? KeyPurpose::RECEIVE : KeyPurpose::CHANGE;
             });
         }
 
         Option<std::string> CommonBitcoinLikeKeychains::getAddressDerivationPath(const std::string &address) const {
-            auto path = getPreferences()->getString(fmt::format("address:{}", address), "");
-            if (path.empty()) {
-                return Option<std::string>();
-            } else {
-                auto derivation = DerivationPath(getExtendedPublicKey()->getRootPath()) + DerivationPath(path);
-                return Option<std::string>(derivation.toString());
-            }
+            return findAddressPosition(address).map<std::string>([this](const DerivedAddressIndex::Position &position) {
+                auto purpose    = position.node == 0 ? KeyPurpose::RECEIVE : KeyPurpose::CHANGE;
+                auto derivation = DerivationPath(getExtendedPublicKey()->getRootPath()) + DerivationPath(getLocalPath(purpose, position.index));
+                return derivation.toString();
+            });
         }
 
         std::vector<BitcoinLikeKeychain::Address>
@@ -257,16 +213,7 @@ namespace ledger {
             KeychainPersistentState state = getState();
             auto maxObservableIndex       = (purpose == KeyPurpose::CHANGE ? state.maxConsecutiveChangeIndex + state.nonConsecutiveChangeIndexes.size() : state.maxConsecutiveReceiveIndex + state.nonConsecutiveReceiveIndexes.size()) + _observableRange;
             auto length                   = std::min<size_t>(to - from, maxObservableIndex - from);
-            std::vector<BitcoinLikeKeychain::Address> result;
-            result.reserve(length + 1);
-            for (auto i = 0; i <= length; i++) {
-                if (purpose == KeyPurpose::RECEIVE) {
-                    result.push_back(derive(KeyPurpose::RECEIVE, from + i));
-                } else {
-                    result.push_back(derive(KeyPurpose::CHANGE, from + i));
-                }
-            }
-            return result;
+            return deriveAddresses(purpose, from, from + length);
         }
 
         void CommonBitcoinLikeKeychains::saveState(KeychainPersistentState state) const {
@@ -298,7 +245,8 @@ namespace ledger {
         }
 
         bool CommonBitcoinLikeKeychains::contains(const std::string &address) const {
-            return getAddressDerivationPath(address).nonEmpty();
+            std::lock_guard<std::mutex> lock(_addressIndexLock);
+            return getAddressIndex().contains(address);
         }
 
         std::vector<BitcoinLikeKeychain::Address> CommonBitcoinLikeKeychains::getAllAddresses() {
@@ -306,52 +254,163 @@ namespace ledger {
             std::vector<BitcoinLikeKeychain::Address> addresses;
             addresses.reserve(state.maxConsecutiveChangeIndex + 1 + state.maxConsecutiveReceiveIndex + 1);
 
-            auto fetchAddressesFrom = [&](auto const keyPurpose, auto const maxIndex) {
+            bool hasDBChange = false;
+            for (auto purpose : {KeyPurpose::CHANGE, KeyPurpose::RECEIVE}) {
+                auto maxIndex = purpose == KeyPurpose::CHANGE ? state.maxConsecutiveChangeIndex : state.maxConsecutiveReceiveIndex;
+                auto range    = deriveRange(purpose, 0, maxIndex, hasDBChange);
                 for (auto i = 0; i <= maxIndex; ++i) {
-                    addresses.push_back(derive(keyPurpose, i));
+                    addresses.push_back(toAddress(range[i], getLocalPath(purpose, i)));
                 }
-            };
-
-            fetchAddressesFrom(KeyPurpose::CHANGE, state.maxConsecutiveChangeIndex);
-            fetchAddressesFrom(KeyPurpose::RECEIVE, state.maxConsecutiveReceiveIndex);
+            }
+            if (hasDBChange) {
+                saveAddressIndex();
+            }
 
             return addresses;
         }
 
         Option<std::vector<uint8_t>> CommonBitcoinLikeKeychains::getPublicKey(const std::string &address) const {
-            auto path = getPreferences()->getString(fmt::format("address:{}", address), "");
-            if (path.empty()) {
-                Option<std::vector<uint8_t>>();
-            }
-            return Option<std::vector<uint8_t>>(_xpub->derivePublicKey(path));
+            return findAddressPosition(address).map<std::vector<uint8_t>>([this](const DerivedAddressIndex::Position &position) {
+                auto purpose = position.node == 0 ? KeyPurpose::RECEIVE : KeyPurpose::CHANGE;
+                return _xpub->derivePublicKey(getLocalPath(purpose, position.index));
+            });
         }
 
         BitcoinLikeKeychain::Address CommonBitcoinLikeKeychains::derive(KeyPurpose purpose, off_t index) {
-            auto currency  = getCurrency();
-            auto iPurpose  = (purpose == KeyPurpose::RECEIVE) ? 0 : 1;
-            auto localPath = getDerivationScheme()
-                                 .setAccountIndex(getAccountIndex())
-                                 .setCoinType(currency.bip44CoinType)
-                                 .setNode(iPurpose)
-                                 .setAddressIndex((int)index)
-                                 .getPath()
-                                 .toString();
-
-            auto cacheKey = fmt::format("path:{}", localPath);
-            auto address  = getPreferences()->getString(cacheKey, "");
-
-            if (address.empty()) {
-                auto p    = getDerivationScheme().getSchemeFrom(DerivationSchemeLevel::NODE).shift(1).setAccountIndex(getAccountIndex()).setCoinType(currency.bip44CoinType).setNode(iPurpose).setAddressIndex((int)index).getPath().toString();
-                auto xpub = iPurpose == KeyPurpose::RECEIVE ? _publicNodeXpub : _internalNodeXpub;
-                address   = BitcoinLikeAddress::fromPublicKey(xpub, currency, p, _keychainEngine);
-                // Feed path -> address cache
-                // Feed address -> path cache
-                getPreferences()
-                    ->edit()
-                    ->putString(cacheKey, address)
-                    ->putString(fmt::format("address:{}", address), localPath)
-                    ->commit();
+            return deriveAddresses(purpose, (uint32_t)index, (uint32_t)index).front();
+        }
+
+        std::vector<BitcoinLikeKeychain::Address> CommonBitcoinLikeKeychains::deriveAddresses(KeyPurpose purpose, uint32_t from, uint32_t to) {
+            bool hasDBChange = false;
+            auto addresses   = deriveRange(purpose, from, to, hasDBChange);
+            if (hasDBChange) {
+                saveAddressIndex();
+            }
+            std::vector<BitcoinLikeKeychain::Address> result;
+            result.reserve(addresses.size());
+            for (auto index = from; index <= to; index++) {
+                result.push_back(toAddress(addresses[index - from], getLocalPath(purpose, index)));
             }
+            return result;
+        }
+
+        std::vector<std::string> CommonBitcoinLikeKeychains::deriveRange(KeyPurpose purpose, uint32_t from, uint32_t to, bool &hasDBChange) {
+            auto currency = getCurrency();
+            auto iPurpose = (purpose == KeyPurpose::RECEIVE) ? 0 : 1;
+            auto xpub     = iPurpose == KeyPurpose::RECEIVE ? _publicNodeXpub : _internalNodeXpub;
+            std::vector<std::string> addresses;
+            addresses.reserve(to - from + 1);
+
+            std::lock_guard<std::mutex> lock(_addressIndexLock);
+            auto &addressIndex = getAddressIndex();
+            // Positions of the addresses missing from the index, and the child numbers
+            // of those which can be derived in bulk from the node key
+            std::vector<size_t> derivedPositions;
+            std::vector<size_t> missingPositions;
+            std::vector<uint32_t> missingChildNums;
+            for (auto index = from; index <= to; index++) {
+                addresses.push_back(addressIndex.getAddress(iPurpose, index).getValueOr(""));
+                if (!addresses.back().empty()) {
+                    continue;
+                }
+                derivedPositions.push_back(addresses.size() - 1);
+                DerivationPath p(getDerivationScheme().getSchemeFrom(DerivationSchemeLevel::NODE).shift(1).setAccountIndex(getAccountIndex()).setCoinType(currency.bip44CoinType).setNode(iPurpose).setAddressIndex((int)index).getPath());
+                if (p.getDepth() == 1) {
+                    missingPositions.push_back(addresses.size() - 1);
+                    missingChildNums.push_back(p.getLastChildNum());
+                } else {
+                    // Not a direct child of the node, go through the generic derivation
+                    addresses.back() = BitcoinLikeAddress::fromPublicKey(xpub, currency, p.toString(), _keychainEngine);
+                }
+            }
+
+            if (!missingChildNums.empty()) {
+                auto derived = std::static_pointer_cast<BitcoinLikeExtendedPublicKey>(xpub)->deriveChildrenAddresses(missingChildNums, _keychainEngine);
+                for (auto i = 0; i < derived.size(); i++) {
+                    addresses[missingPositions[i]] = std::move(derived[i]);
+                }
+            }
+
+            for (auto position : derivedPositions) {
+                addressIndex.put(iPurpose, from + position, addresses[position]);
+                hasDBChange = true;
+            }
+            return addresses;
+        }
+
+        DerivedAddressIndex &CommonBitcoinLikeKeychains::getAddressIndex() const {
+            if (!_addressIndex) {
+                auto preferences = getPreferences();
+                _addressIndex    = std::make_unique<DerivedAddressIndex>();
+                auto hasChunks   = false;
+                for (uint32_t node = 0; node < DerivedAddressIndex::NODES_COUNT; node++) {
+                    auto chunkCount = preferences->getInt(fmt::format("addressIndex:{}", node), 0);
+                    for (auto chunk = 0; chunk < chunkCount; chunk++) {
+                        _addressIndex->putChunk(node, chunk, preferences->getData(fmt::format("addressIndex:{}:{}", node, chunk), {}));
+                        hasChunks = true;
+                    }
+                }
+                if (!hasChunks) {
+                    importLegacyAddresses(*_addressIndex);
+                }
+            }
+            return *_addressIndex;
+        }
+
+        void CommonBitcoinLikeKeychains::importLegacyAddresses(DerivedAddressIndex &addressIndex) const {
+            // Keychains created before the index was introduced cached every address under its own
+            // "path:<local path>" key. Walk the derived ranges until the observable range is exhausted.
+            auto state = getState();
+            for (auto purpose : {KeyPurpose::RECEIVE, KeyPurpose::CHANGE}) {
+                const auto &nonConsecutive = purpose == KeyPurpose::RECEIVE ? state.nonConsecutiveReceiveIndexes : state.nonConsecutiveChangeIndexes;
+                uint32_t lastUsedIndex     = purpose == KeyPurpose::RECEIVE ? state.maxConsecutiveReceiveIndex : state.maxConsecutiveChangeIndex;
+                if (!nonConsecutive.empty()) {
+                    lastUsedIndex = std::max(lastUsedIndex, *nonConsecutive.rbegin());
+                }
+                for (uint32_t index = 0, misses = 0; index <= lastUsedIndex || misses <= _observableRange; index++) {
+                    auto address = getPreferences()->getString(fmt::format("path:{}", getLocalPath(purpose, index)), "");
+                    if (address.empty()) {
+                        misses += 1;
+                    } else {
+                        addressIndex.put(purpose == KeyPurpose::RECEIVE ? 0 : 1, index, address);
+                        misses = 0;
+                    }
+                }
+            }
+        }
+
+        void CommonBitcoinLikeKeychains::saveAddressIndex() const {
+            auto editor = getPreferences()->edit();
+            {
+                std::lock_guard<std::mutex> lock(_addressIndexLock);
+                auto &addressIndex = getAddressIndex();
+                for (const auto &chunk : addressIndex.takeDirtyChunks()) {
+                    editor->putData(fmt::format("addressIndex:{}:{}", chunk.first, chunk.second), addressIndex.chunkToByteArray(chunk.first, chunk.second));
+                }
+                for (uint32_t node = 0; node < DerivedAddressIndex::NODES_COUNT; node++) {
+                    editor->putInt(fmt::format("addressIndex:{}", node), addressIndex.getChunkCount(node));
+                }
+            }
+            editor->commit();
+        }
+
+        Option<DerivedAddressIndex::Position> CommonBitcoinLikeKeychains::findAddressPosition(const std::string &address) const {
+            std::lock_guard<std::mutex> lock(_addressIndexLock);
+            return getAddressIndex().getPosition(address);
+        }
+
+        std::string CommonBitcoinLikeKeychains::getLocalPath(KeyPurpose purpose, uint32_t index) const {
+            DerivationScheme scheme = getDerivationScheme();
+            return scheme
+                .setAccountIndex(getAccountIndex())
+                .setCoinType(getCurrency().bip44CoinType)
+                .setNode((purpose == KeyPurpose::RECEIVE) ? 0 : 1)
+                .setAddressIndex((int)index)
+                .getPath()
+                .toString();
+        }
+
+        BitcoinLikeKeychain::Address CommonBitcoinLikeKeychains::toAddress(const std::string &address, const std::string &localPath) const {
             return std::dynamic_pointer_cast<BitcoinLikeAddress>(BitcoinLikeAddress::parse(address, getCurrency(), Option<std::string>(localPath)));
         }
     } // namespace core
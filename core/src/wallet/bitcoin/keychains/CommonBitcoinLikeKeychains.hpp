@@ -33,8 +33,11 @@
 
 #include "../../../collections/DynamicObject.hpp"
 #include "BitcoinLikeKeychain.hpp"
+#include "DerivedAddressIndex.hpp"
 
 #include <bitcoin/BitcoinLikeAddress.hpp>
+#include <memory>
+#include <mutex>
 #include <set>
 
 namespace ledger {
@@ -105,9 +108,25 @@ namespace ledger {
 
           private:
             BitcoinLikeKeychain::Address derive(KeyPurpose purpose, off_t index);
+            std::vector<BitcoinLikeKeychain::Address> deriveAddresses(KeyPurpose purpose, uint32_t from, uint32_t to);
+            /**
+             * Get the addresses of [from, to] for the given purpose. Addresses missing from the index are
+             * derived in parallel and added to it; the caller is responsible for saving the index when
+             * hasDBChange is set.
+             */
+            std::vector<std::string> deriveRange(KeyPurpose purpose, uint32_t from, uint32_t to, bool &hasDBChange);
+            // Must be called with _addressIndexLock held
+            DerivedAddressIndex &getAddressIndex() const;
+            void importLegacyAddresses(DerivedAddressIndex &addressIndex) const;
+            void saveAddressIndex() const;
+            Option<DerivedAddressIndex::Position> findAddressPosition(const std::string &address) const;
+            std::string getLocalPath(KeyPurpose purpose, uint32_t index) const;
+            BitcoinLikeKeychain::Address toAddress(const std::string &address, const std::string &localPath) const;
             void saveState(KeychainPersistentState state) const;
 
             std::shared_ptr<api::BitcoinLikeExtendedPublicKey> _xpub;
+            mutable std::mutex _addressIndexLock;
+            mutable std::unique_ptr<DerivedAddressIndex> _addressIndex;
         };
     } // namespace core
 } // namespace ledger
@@ -0,0 +1,117 @@
+/*
+ *
+ * DerivedAddressIndex
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#include "DerivedAddressIndex.hpp"
+
+#include <algorithm>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/stream.hpp>
+#include <cereal/archives/binary.hpp>
+#include <sstream>
+#include <utils/Exception.hpp>
+
+namespace ledger {
+    namespace core {
+
+        Option<std::string> DerivedAddressIndex::getAddress(uint32_t node, uint32_t index) const {
+            if (node >= NODES_COUNT || index >= _addresses[node].size() || _addresses[node][index].empty()) {
+                return Option<std::string>();
+            }
+            return Option<std::string>(_addresses[node][index]);
+        }
+
+        Option<DerivedAddressIndex::Position> DerivedAddressIndex::getPosition(const std::string &address) const {
+            auto it = _positions.find(address);
+            if (it == _positions.end()) {
+                return Option<Position>();
+            }
+            return Option<Position>(it->second);
+        }
+
+        bool DerivedAddressIndex::contains(const std::string &address) const {
+            return _positions.find(address) != _positions.end();
+        }
+
+        void DerivedAddressIndex::put(uint32_t node, uint32_t index, const std::string &address) {
+            if (node >= NODES_COUNT) {
+                throw make_exception(api::ErrorCode::INVALID_ARGUMENT, "Invalid keychain node {}", node);
+            }
+            auto &addresses = _addresses[node];
+            if (index >= addresses.size()) {
+                addresses.resize(index + 1);
+            }
+            addresses[index]    = address;
+            _positions[address] = Position{node, index};
+            _dirtyChunks.emplace(node, index / CHUNK_SIZE);
+        }
+
+        uint32_t DerivedAddressIndex::getChunkCount(uint32_t node) const {
+            return static_cast<uint32_t>((_addresses[node].size() + CHUNK_SIZE - 1) / CHUNK_SIZE);
+        }
+
+        std::vector<uint8_t> DerivedAddressIndex::chunkToByteArray(uint32_t node, uint32_t chunk) const {
+            const auto &addresses = _addresses[node];
+            auto begin            = std::min<size_t>(chunk * CHUNK_SIZE, addresses.size());
+            auto end              = std::min<size_t>(begin + CHUNK_SIZE, addresses.size());
+            std::vector<std::string> chunkAddresses(addresses.begin() + begin, addresses.begin() + end);
+            std::stringstream is;
+            {
+                ::cereal::BinaryOutputArchive archive(is);
+                archive(chunkAddresses);
+            }
+            auto saved = is.str();
+            return std::vector<uint8_t>((const uint8_t *)saved.data(), (const uint8_t *)saved.data() + saved.size());
+        }
+
+        void DerivedAddressIndex::putChunk(uint32_t node, uint32_t chunk, const std::vector<uint8_t> &data) {
+            if (data.empty()) {
+                return;
+            }
+            std::vector<std::string> chunkAddresses;
+            boost::iostreams::array_source source(reinterpret_cast<const char *>(data.data()), data.size());
+            boost::iostreams::stream<boost::iostreams::array_source> is(source);
+            ::cereal::BinaryInputArchive archive(is);
+            archive(chunkAddresses);
+            for (uint32_t offset = 0; offset < chunkAddresses.size(); offset++) {
+                if (!chunkAddresses[offset].empty()) {
+                    put(node, chunk * CHUNK_SIZE + offset, chunkAddresses[offset]);
+                }
+            }
+            // Loaded chunks are already persisted
+            _dirtyChunks.erase(std::make_pair(node, chunk));
+        }
+
+        std::set<std::pair<uint32_t, uint32_t>> DerivedAddressIndex::takeDirtyChunks() {
+            std::set<std::pair<uint32_t, uint32_t>> dirtyChunks;
+            dirtyChunks.swap(_dirtyChunks);
+            return dirtyChunks;
+        }
+    } // namespace core
+} // namespace ledger
@@ -0,0 +1,84 @@
+/*
+ *
+ * DerivedAddressIndex
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#ifndef LEDGER_CORE_DERIVEDADDRESSINDEX_HPP
+#define LEDGER_CORE_DERIVEDADDRESSINDEX_HPP
+
+#include <array>
+#include <cereal/cereal.hpp>
+#include <cereal/types/string.hpp>
+#include <cereal/types/vector.hpp>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <utils/Option.hpp>
+#include <vector>
+
+namespace ledger {
+    namespace core {
+
+        /**
+         * In-memory index of the addresses derived by a keychain, answering node/index -> address and
+         * address -> node/index lookups without going through the preferences backend. Nodes are the
+         * receive (0) and change (1) branches of the account. The index is persisted by chunks of
+         * CHUNK_SIZE consecutive indexes so that new derivations only rewrite the chunks they touched.
+         */
+        class DerivedAddressIndex {
+          public:
+            static constexpr uint32_t NODES_COUNT = 2;
+            static constexpr uint32_t CHUNK_SIZE  = 256;
+
+            struct Position {
+                uint32_t node;
+                uint32_t index;
+            };
+
+            Option<std::string> getAddress(uint32_t node, uint32_t index) const;
+            Option<Position> getPosition(const std::string &address) const;
+            bool contains(const std::string &address) const;
+            void put(uint32_t node, uint32_t index, const std::string &address);
+
+            uint32_t getChunkCount(uint32_t node) const;
+            std::vector<uint8_t> chunkToByteArray(uint32_t node, uint32_t chunk) const;
+            void putChunk(uint32_t node, uint32_t chunk, const std::vector<uint8_t> &data);
+            // Chunks (node, chunk) changed by put since the last call
+            std::set<std::pair<uint32_t, uint32_t>> takeDirtyChunks();
+
+          private:
+            // Addresses by node then index, empty strings stand for the holes in the derived ranges
+            std::array<std::vector<std::string>, NODES_COUNT> _addresses;
+            std::unordered_map<std::string, Position> _positions;
+            std::set<std::pair<uint32_t, uint32_t>> _dirtyChunks;
+        };
+    } // namespace core
+} // namespace ledger
+
+#endif // LEDGER_CORE_DERIVEDADDRESSINDEX_HPP
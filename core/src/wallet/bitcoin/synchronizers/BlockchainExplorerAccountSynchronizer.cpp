@@ -293,31 +293,24 @@ namespace ledger {
                 });
         }
 
-        Future<std::vector<std::shared_ptr<BitcoinLikeBlockchainExplorer::TransactionsBulk>>> BlockchainExplorerAccountSynchronizer::requestTransactionsFromExplorer(
-            const std::shared_ptr<SynchronizationBuddy> &buddy) {
-            auto span    = _currentAccount->getTracer()->startSpan("BlockchainExplorerAccountSynchronizer::requestTransactionsFromExplorer");
-            auto nbBatch = this->_addresses.size() / (buddy->halfBatchSize * 2);
-            std::vector<Future<std::shared_ptr<BitcoinLikeBlockchainExplorer::TransactionsBulk>>> batches;
-            for (int currentBatchIndex = 0; currentBatchIndex < nbBatch; currentBatchIndex++) {
+        // Issue the explorer calls of the batches following fromBatchIndex (included) so that up to
+        // buddy->pipelineDepth batches are fetched while the current one is interpreted and inserted.
+        // Batches which are already cached or in flight are skipped.
+        void BlockchainExplorerAccountSynchronizer::prefetchTransactionBulks(uint32_t fromBatchIndex,
+                                                                             const std::shared_ptr<SynchronizationBuddy> &buddy) {
+            auto nbBatch = (uint32_t)(_addresses.size() / (buddy->halfBatchSize * 2));
+            auto toBatch = std::min(nbBatch, fromBatchIndex + buddy->pipelineDepth);
+            for (auto currentBatchIndex = fromBatchIndex; currentBatchIndex < toBatch; currentBatchIndex++) {
                 auto pair = getHashkeyAndBlockhash(currentBatchIndex, buddy);
                 auto key  = pair.first;
-                if (_cachedTransactionBulks.find(key) != _cachedTransactionBulks.end())
+                if (_cachedTransactionBulks.find(key) != _cachedTransactionBulks.end() ||
+                    _pendingTransactionBulks.find(key) != _pendingTransactionBulks.end())
                     continue;
-                int from       = currentBatchIndex * buddy->halfBatchSize * 2;
-                int to         = (currentBatchIndex + 1) * buddy->halfBatchSize * 2;
-                auto batch     = std::vector<std::string>(this->_addresses.begin() + from, this->_addresses.begin() + to);
-                auto blockhash = pair.second;
-                batches.emplace_back(_explorer->getTransactions(batch, blockhash, optional<void *>()));
-                _hashkeys.emplace_back(key);
-            }
-            if (batches.size() == 0) { // return an empty std::vector if no need to request the explorer
-                return Future<std::vector<std::shared_ptr<BitcoinLikeBlockchainExplorer::TransactionsBulk>>>::async(buddy->account->getContext(),
-                                                                                                                    [=]() -> std::vector<std::shared_ptr<BitcoinLikeBlockchainExplorer::TransactionsBulk>> {
-                                                                                                                        return std::vector<std::shared_ptr<BitcoinLikeBlockchainExplorer::TransactionsBulk>>();
-                                                                                                                    });
+                int from   = currentBatchIndex * buddy->halfBatchSize * 2;
+                int to     = (currentBatchIndex + 1) * buddy->halfBatchSize * 2;
+                auto batch = std::vector<std::string>(_addresses.begin() + from, _addresses.begin() + to);
+                _pendingTransactionBulks.emplace(key, _explorer->getTransactions(batch, pair.second, optional<void *>()));
             }
-            return executeAll(buddy->account->getContext(), batches)
-                .then(getContext(), [span]() { span->close(); });
         }
 
         Future<Unit> BlockchainExplorerAccountSynchronizer::synchronizeMempool(
@@ -424,6 +417,9 @@ namespace ledger {
             buddy->halfBatchSize      = (uint32_t)buddy->configuration
                                        ->getInt(api::Configuration::SYNCHRONIZATION_HALF_BATCH_SIZE)
                                        .value_or(api::ConfigurationDefaults::KEYCHAIN_DEFAULT_OBSERVABLE_RANGE);
+            buddy->pipelineDepth = (uint32_t)std::max(1, buddy->configuration
+                                                             ->getInt(api::Configuration::SYNCHRONIZATION_PIPELINE_DEPTH)
+                                                             .value_or(api::ConfigurationDefaults::DEFAULT_SYNCHRONIZATION_PIPELINE_DEPTH));
             buddy->keychain   = account->getKeychain();
             buddy->savedState = buddy->preferences
                                     ->template getObject<BlockchainExplorerAccountSynchronizationSavedState>("state");
@@ -471,7 +467,7 @@ namespace ledger {
             auto self = getSharedFromThis();
             self->_addresses.clear();
             self->_cachedTransactionBulks.clear();
-            self->_hashkeys.clear();
+            self->_pendingTransactionBulks.clear();
             _explorerBenchmark = NEW_BENCHMARK("explorer_calls");
             return self->updateCurrentBlock(buddy)
                 .template flatMap<Unit>(account->getContext(), [self, buddy](const std::shared_ptr<BitcoinLikeBlockchainExplorer::Block> &block) {
@@ -485,18 +481,12 @@ namespace ledger {
                     }
                     return self->extendKeychain(0, buddy);
                 })
-                .template flatMap<std::vector<std::shared_ptr<BitcoinLikeBlockchainExplorer::TransactionsBulk>>>(account->getContext(), [buddy, self](const Unit &) {
-                    self->_explorerBenchmark->start();
-                    return self->requestTransactionsFromExplorer(buddy);
-                })
-                .template flatMap<Unit>(account->getContext(), [buddy, self](const std::vector<std::shared_ptr<BitcoinLikeBlockchainExplorer::TransactionsBulk>> &txBulks) {
-                    self->_explorerBenchmark->stop();
-                    for (int i = 0; i < txBulks.size(); i++) {
-                        self->_cachedTransactionBulks.insert(std::make_pair(self->_hashkeys[i], txBulks[i]));
-                    }
+                .template flatMap<Unit>(account->getContext(), [buddy, self](const Unit &) {
                     return self->synchronizeBatches(0, buddy);
                 })
                 .template flatMap<Unit>(account->getContext(), [self, buddy](auto) {
+                    // Calls issued for batches beyond the last synchronized one are not needed anymore
+                    self->_pendingTransactionBulks.clear();
                     return self->synchronizeMempool(buddy);
                 })
                 .template map<BlockchainExplorerAccountSynchronizationResult>(ImmediateExecutionContext::INSTANCE, [self, buddy](const Unit &) {
@@ -576,6 +566,10 @@ namespace ledger {
         //
         // This function will synchronize all batches by iterating over batches and transactions
         // bulks. The input buddy can be used to customize the behavior of the synchronization.
+        //
+        // Explorer calls of the next batches are issued before the current batch is interpreted
+        // and inserted (see prefetchTransactionBulks) but batches are always consumed in order, so the
+        // saved state is committed exactly as with a serial synchronization and can be resumed safely.
         Future<Unit> BlockchainExplorerAccountSynchronizer::synchronizeBatches(uint32_t currentBatchIndex, std::shared_ptr<SynchronizationBuddy> buddy) {
             buddy->logger->info("SYNC BATCHES");
             auto done = currentBatchIndex >= buddy->savedState.getValue().batches.size() - 1;
@@ -586,6 +580,8 @@ namespace ledger {
             auto self        = getSharedFromThis();
             auto &batchState = buddy->savedState.getValue().batches[currentBatchIndex];
 
+            prefetchTransactionBulks(currentBatchIndex, buddy);
+
             return synchronizeBatch(currentBatchIndex, buddy).template flatMap<Unit>(buddy->account->getContext(), [=](const bool &hadTransactions) -> Future<Unit> {
                                                                  buddy->preferences->editor()->template putObject<BlockchainExplorerAccountSynchronizationSavedState>("state", buddy->savedState.getValue())->commit();
 
@@ -601,6 +597,8 @@ namespace ledger {
                                                              })
                 .recoverWith(ImmediateExecutionContext::INSTANCE, [=](const Exception &exception) -> Future<Unit> {
                     buddy->logger->info("Recovering from failing synchronization : {}", exception.getMessage());
+                    // Calls in flight were issued with block hashes which may not be valid anymore
+                    self->_pendingTransactionBulks.clear();
                     // A block reorganization happened
                     if (exception.getErrorCode() == api::ErrorCode::BLOCK_NOT_FOUND &&
                         buddy->savedState.nonEmpty()) {
@@ -701,6 +699,12 @@ namespace ledger {
             auto pair = getHashkeyAndBlockhash(currentBatchIndex, buddy);
             auto it   = this->_cachedTransactionBulks.find(pair.first);
             if (it == this->_cachedTransactionBulks.end()) {
+                auto pending = this->_pendingTransactionBulks.find(pair.first);
+                if (pending != this->_pendingTransactionBulks.end()) {
+                    auto future = pending->second;
+                    this->_pendingTransactionBulks.erase(pending);
+                    return future;
+                }
                 auto batch = std::vector<std::string>(this->_addresses.begin() + from, this->_addresses.begin() + to);
                 return _explorer->getTransactions(batch, pair.second, optional<void *>());
             }
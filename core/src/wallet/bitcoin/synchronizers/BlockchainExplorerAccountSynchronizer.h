@@ -56,6 +56,8 @@ namespace ledger {
                 std::shared_ptr<AbstractWallet> wallet;
                 std::shared_ptr<DynamicObject> configuration;
                 uint32_t halfBatchSize;
+                // Number of batches whose explorer call may be in flight at once
+                uint32_t pipelineDepth;
                 std::shared_ptr<BitcoinLikeKeychain> keychain;
                 Option<BlockchainExplorerAccountSynchronizationSavedState> savedState;
                 std::shared_ptr<BitcoinLikeAccount> account;
@@ -96,7 +98,7 @@ namespace ledger {
             Future<Unit> synchronizeBatches(uint32_t currentBatchIndex, std::shared_ptr<SynchronizationBuddy> buddy);
             Future<std::shared_ptr<BitcoinLikeBlockchainExplorer::TransactionsBulk>> getTransactionBulk(int currentBatchIndex, const std::shared_ptr<SynchronizationBuddy> &buddy);
             Future<bool> synchronizeBatch(uint32_t currentBatchIndex, std::shared_ptr<SynchronizationBuddy> buddy, bool hadTransactions = false);
-            Future<std::vector<std::shared_ptr<BitcoinLikeBlockchainExplorer::TransactionsBulk>>> requestTransactionsFromExplorer(const std::shared_ptr<SynchronizationBuddy> &buddy);
+            void prefetchTransactionBulks(uint32_t fromBatchIndex, const std::shared_ptr<SynchronizationBuddy> &buddy);
             static std::pair<std::string, Option<std::string>> getHashkeyAndBlockhash(int currentBatchIndex, const std::shared_ptr<SynchronizationBuddy> &buddy);
 
             std::shared_ptr<Preferences> _internalPreferences;
@@ -108,8 +110,8 @@ namespace ledger {
             // In order to avoid requesting same batch multiple times to the explorer, we cache transaction bulks in the memory.
             // In the following hashmap, The key is the batch index + BlockHash, the value is the transactionBulk return from the explorer and generated by the transactionBulk parser
             std::map<std::string, std::shared_ptr<BitcoinLikeBlockchainExplorer::TransactionsBulk>> _cachedTransactionBulks;
-            // A variable to save keys in _cachedTransactionBulks
-            std::vector<std::string> _hashkeys;
+            // Explorer calls issued ahead of the batch being synchronized, using the same keys as _cachedTransactionBulks
+            std::map<std::string, Future<std::shared_ptr<BitcoinLikeBlockchainExplorer::TransactionsBulk>>> _pendingTransactionBulks;
             std::shared_ptr<ledger::core::Benchmarker> _explorerBenchmark;
         };
     } // namespace core
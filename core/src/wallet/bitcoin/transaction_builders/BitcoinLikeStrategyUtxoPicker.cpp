@@ -31,6 +31,7 @@
 
 #include "BitcoinLikeStrategyUtxoPicker.h"
 
+#include <algorithm>
 #include <api/BitcoinLikeScript.hpp>
 #include <api/BitcoinLikeScriptChunk.hpp>
 #include <numeric>
@@ -43,19 +44,6 @@
 namespace ledger {
     namespace core {
 
-        std::optional<bool> compareConfirmation(const BitcoinLikeUtxo &u1, const BitcoinLikeUtxo &u2) {
-            bool isU1Confirmed = u1.blockHeight.hasValue();
-            bool isU2Confirmed = u2.blockHeight.hasValue();
-
-            if ((isU1Confirmed && isU2Confirmed) || (!isU1Confirmed && !isU2Confirmed)) {
-                // ignore the case where confirmation status is similar
-                return {};
-            }
-
-            // otherwise confirmed utxo should be first
-            return isU1Confirmed;
-        }
-
         BitcoinLikeStrategyUtxoPicker::BitcoinLikeStrategyUtxoPicker(const std::shared_ptr<api::ExecutionContext> &context,
                                                                      const api::Currency &currency,
                                                                      bool useConfirmedFirst)
@@ -68,26 +56,28 @@ namespace ledger {
 
                 return buddy->getUtxo().map<std::vector<BitcoinLikeUtxo>>(
                     getContext(),
-                    [=](std::vector<BitcoinLikeUtxo> const &utxos) {
+                    [=](std::shared_ptr<const BitcoinLikeUtxoSet> const &utxos) {
                         buddy->logger->info("GOT UTXO");
 
-                        if (utxos.size() == 0)
+                        auto const excluded = buddy->batch ? getExcludedUtxos(buddy->request, *utxos, buddy->batch->claimedUtxos)
+                                                           : getExcludedUtxos(buddy->request, *utxos);
+                        if (utxos->empty() || (!excluded.empty() && std::find(excluded.begin(), excluded.end(), false) == excluded.end()))
                             throw make_exception(api::ErrorCode::NOT_ENOUGH_FUNDS, "There is no UTXO on this account.");
 
                         // If wipe mode no matter which strategy we use, let's use filterWithDeepFirst (for the moment)
                         if (buddy->request.wipe) {
-                            return filterWithDeepFirst(buddy, utxos, amount, getCurrency());
+                            return filterWithDeepFirst(buddy, *utxos, excluded, amount, getCurrency());
                         }
 
                         auto picker = buddy->request.utxoPicker.getValue();
 
                         switch (picker.strategy) {
                         case api::BitcoinLikePickingStrategy::DEEP_OUTPUTS_FIRST:
-                            return filterWithDeepFirst(buddy, utxos, amount, getCurrency());
+                            return filterWithDeepFirst(buddy, *utxos, excluded, amount, getCurrency());
                         case api::BitcoinLikePickingStrategy::OPTIMIZE_SIZE:
-                            return filterWithOptimizeSize(buddy, utxos, amount, getCurrency(), _useConfirmedFirst);
+                            return filterWithOptimizeSize(buddy, *utxos, excluded, amount, getCurrency(), _useConfirmedFirst);
                         case api::BitcoinLikePickingStrategy::MERGE_OUTPUTS:
-                            return filterWithMergeOutputs(buddy, utxos, amount, getCurrency(), _useConfirmedFirst);
+                            return filterWithMergeOutputs(buddy, *utxos, excluded, amount, getCurrency(), _useConfirmedFirst);
                         }
 
                         throw make_exception(api::ErrorCode::ILLEGAL_ARGUMENT, "Unknown UTXO picking strategy.");
@@ -119,12 +109,18 @@ namespace ledger {
                                                            const std::vector<BitcoinLikeUtxo> &utxos,
                                                            const BigInt &aggregatedAmount,
                                                            const api::Currency &currency) {
+            return filterWithDeepFirst(buddy, BitcoinLikeUtxoSet(utxos), {}, aggregatedAmount, currency);
+        }
+
+        std::vector<BitcoinLikeUtxo>
+        BitcoinLikeStrategyUtxoPicker::filterWithDeepFirst(const std::shared_ptr<BitcoinLikeUtxoPicker::Buddy> &buddy,
+                                                           const BitcoinLikeUtxoSet &utxos,
+                                                           const std::vector<bool> &excluded,
+                                                           const BigInt &aggregatedAmount,
+                                                           const api::Currency &currency) {
             buddy->logger->debug("Start filterWithDeepFirst");
 
-            return filterWithSort(buddy, utxos, aggregatedAmount, currency, [](auto &lhs, auto &rhs) {
-                constexpr auto maxBlockHeight = std::numeric_limits<uint64_t>::max();
-                return lhs.blockHeight.getValueOr(maxBlockHeight) < rhs.blockHeight.getValueOr(maxBlockHeight);
-            });
+            return filterWithSort(buddy, utxos, utxos.getOrderedByDepth(), excluded, aggregatedAmount, currency);
         }
 
         bool BitcoinLikeStrategyUtxoPicker::hasEnough(const std::shared_ptr<BitcoinLikeUtxoPicker::Buddy> &buddy,
@@ -189,11 +185,21 @@ namespace ledger {
                                                               const BigInt &aggregatedAmount,
                                                               const api::Currency &currency,
                                                               bool useConfirmedFirst) {
+            return filterWithOptimizeSize(buddy, BitcoinLikeUtxoSet(utxos), {}, aggregatedAmount, currency, useConfirmedFirst);
+        }
+
+        std::vector<BitcoinLikeUtxo>
+        BitcoinLikeStrategyUtxoPicker::filterWithOptimizeSize(const std::shared_ptr<BitcoinLikeUtxoPicker::Buddy> &buddy,
+                                                              const BitcoinLikeUtxoSet &utxos,
+                                                              const std::vector<bool> &excluded,
+                                                              const BigInt &aggregatedAmount,
+                                                              const api::Currency &currency,
+                                                              bool useConfirmedFirst) {
             // NOTE: why are we using buddy->outputAmount here instead of aggregatedAmount ?
             // Don't use this strategy for wipe mode (we have more performent strategies for this use case)
             if (buddy->request.wipe) {
                 buddy->logger->debug("Strategy filterWithOptimizeSize with wipe to address mode, using filterWithDeepFirst");
-                return filterWithDeepFirst(buddy, utxos, buddy->outputAmount, currency);
+                return filterWithDeepFirst(buddy, utxos, excluded, buddy->outputAmount, currency);
             }
             /*
              * This coin selection is inspired from the one used in Bitcoin Core
@@ -248,26 +254,25 @@ namespace ledger {
 
             buddy->logger->debug("Cost of change {}, signedChangeSize {}, changeOutputSize {}", costOfChange, signedChangeSize, changeOutputSize);
 
-            // Calculate effective value of outputs
-            int64_t currentAvailableValue = 0;
-
-            struct EffectiveUtxo {
-                const BitcoinLikeUtxo *utxo;
-                int64_t effectiveValue;
-                int64_t effectiveFees;
-                int64_t longTermFees;
-            };
-
-            std::vector<EffectiveUtxo> effectiveUtxos;
-            // Get size of utxos as a signed input in a transaction
-            for (auto &utxo : utxos) {
-                int64_t outEffectiveValue = utxo.value.toLong() - effectiveFees * signedUTXOSize;
-                if (outEffectiveValue > 0) {
-                    int64_t outEffectiveFees = effectiveFees * signedUTXOSize;
-                    int64_t outLongTermFees  = longTermFees * signedUTXOSize;
-                    effectiveUtxos.push_back(EffectiveUtxo{&utxo, outEffectiveValue, outEffectiveFees, outLongTermFees});
-                    currentAvailableValue += outEffectiveValue;
+            // Effective values of the outputs are cached in the UTXO set for a given fee rate, so that
+            // successive builds don't have to compute and sort them again
+            const int64_t inputEffectiveFees = effectiveFees * signedUTXOSize;
+            const int64_t inputLongTermFees  = longTermFees * signedUTXOSize;
+            const int64_t inputWaste         = inputEffectiveFees - inputLongTermFees;
+            const auto effectiveView         = utxos.getEffectiveView(inputEffectiveFees, useConfirmedFirst);
+            const auto *effectiveUtxos       = &effectiveView->utxos;
+            int64_t currentAvailableValue    = effectiveView->availableValue;
+
+            std::vector<BitcoinLikeUtxoSet::EffectiveUtxo> spendableUtxos;
+            if (!excluded.empty()) {
+                currentAvailableValue = 0;
+                for (auto const &eu : effectiveView->utxos) {
+                    if (!excluded[eu.index]) {
+                        spendableUtxos.push_back(eu);
+                        currentAvailableValue += eu.effectiveValue;
+                    }
                 }
+                effectiveUtxos = &spendableUtxos;
             }
 
             // Get no inputs fees
@@ -277,7 +282,7 @@ namespace ledger {
             // Start coin selection algorithm (according to SelectCoinBnb from Bitcoin Core)
             int64_t currentValue = 0;
             std::vector<bool> currentSelection;
-            currentSelection.reserve(utxos.size());
+            currentSelection.reserve(effectiveUtxos->size());
 
             // Actual amount we are targetting
             int64_t actualTarget = notInputFees + buddy->outputAmount.toInt64();
@@ -287,19 +292,6 @@ namespace ledger {
                 throw make_exception(api::ErrorCode::NOT_ENOUGH_FUNDS, "Cannot gather enough funds.");
             }
 
-            auto descendingEffectiveValue = [useConfirmedFirst](const EffectiveUtxo &lhs, const EffectiveUtxo &rhs) -> bool {
-                if (useConfirmedFirst) {
-                    std::optional<bool> comp = compareConfirmation(*lhs.utxo, *rhs.utxo);
-                    if (comp.has_value()) {
-                        return comp.value();
-                    }
-                }
-                return lhs.effectiveValue > rhs.effectiveValue;
-            };
-
-            // Sort utxos by effectiveValue
-            std::sort(effectiveUtxos.begin(), effectiveUtxos.end(), descendingEffectiveValue);
-
             int64_t currentWaste = 0;
             int64_t bestWaste    = MAX_MONEY;
             std::vector<bool> bestSelection;
@@ -308,15 +300,15 @@ namespace ledger {
             for (size_t i = 0; i < TOTAL_TRIES; i++) {
                 // Condition for starting a backtrack
                 bool backtrack = false;
-                if (currentValue + currentAvailableValue < actualTarget ||                                                      // Cannot reach target with the amount remaining in currentAvailableValue
-                    currentValue > actualTarget + costOfChange ||                                                               // Selected value is out of range, go back and try other branch
-                    (currentWaste > bestWaste && effectiveUtxos.at(0).effectiveFees - effectiveUtxos.at(0).longTermFees > 0)) { // avoid selecting utxos producing more waste
+                if (currentValue + currentAvailableValue < actualTarget ||  // Cannot reach target with the amount remaining in currentAvailableValue
+                    currentValue > actualTarget + costOfChange ||           // Selected value is out of range, go back and try other branch
+                    (currentWaste > bestWaste && inputWaste > 0)) {         // avoid selecting utxos producing more waste
                     backtrack = true;
                 } else if (currentValue >= actualTarget) { // Selected valued is within range
                     currentWaste += (currentValue - actualTarget);
                     if (currentWaste <= bestWaste) {
                         bestSelection = currentSelection;
-                        bestSelection.resize(effectiveUtxos.size());
+                        bestSelection.resize(effectiveUtxos->size());
                         bestWaste = currentWaste;
                     }
                     // remove the excess value as we will be selecting different coins now
@@ -329,7 +321,7 @@ namespace ledger {
                     // Walk backwards to find the last included UTXO that still needs to have its omission branch traversed.
                     while (!currentSelection.empty() && !currentSelection.back()) {
                         currentSelection.pop_back();
-                        currentAvailableValue += effectiveUtxos.at(currentSelection.size()).effectiveValue;
+                        currentAvailableValue += effectiveUtxos->at(currentSelection.size()).effectiveValue;
                     }
 
                     // Case we walked back to the first utxos and all solutions searched.
@@ -340,11 +332,11 @@ namespace ledger {
 
                     // Output was included on previous iterations, try excluding now
                     currentSelection.back() = false;
-                    auto &eu                = effectiveUtxos.at(currentSelection.size() - 1);
+                    auto &eu                = effectiveUtxos->at(currentSelection.size() - 1);
                     currentValue -= eu.effectiveValue;
-                    currentWaste -= (eu.effectiveFees - eu.longTermFees);
+                    currentWaste -= inputWaste;
                 } else { // Moving forwards, continuing down this branch
-                    auto &eu = effectiveUtxos.at(currentSelection.size());
+                    auto &eu = effectiveUtxos->at(currentSelection.size());
 
                     // Remove this utxos from currentAvailableValue
                     currentAvailableValue -= eu.effectiveValue;
@@ -352,14 +344,13 @@ namespace ledger {
                     // Avoid searching a branch if the previous UTXO has the same value and same waste and was excluded. Since the ratio of fee to
                     // long term fee is the same, we only need to check if one of those values match in order to know that the waste is the same.
                     if (!currentSelection.empty() && !currentSelection.back() &&
-                        eu.effectiveValue == effectiveUtxos.at(currentSelection.size() - 1).effectiveValue &&
-                        eu.effectiveFees == effectiveUtxos.at(currentSelection.size() - 1).effectiveFees) {
+                        eu.effectiveValue == effectiveUtxos->at(currentSelection.size() - 1).effectiveValue) {
                         currentSelection.push_back(false);
                     } else {
                         // Inclusion branch first
                         currentSelection.push_back(true);
                         currentValue += eu.effectiveValue;
-                        currentWaste += (eu.effectiveFees - eu.longTermFees);
+                        currentWaste += inputWaste;
                     }
                 }
             }
@@ -368,7 +359,7 @@ namespace ledger {
             // If no selection found fallback on filterWithDeepFirst
             if (bestSelection.empty()) {
                 buddy->logger->debug("No best selection found, fallback on filterWithKnapsackSolver coin selection");
-                return filterWithKnapsackSolver(buddy, utxos, aggregatedAmount, currency, useConfirmedFirst);
+                return filterWithKnapsackSolver(buddy, utxos, excluded, aggregatedAmount, currency, useConfirmedFirst);
             }
 
             // Prepare result
@@ -378,28 +369,30 @@ namespace ledger {
             BigInt bestValue = BigInt::ZERO;
             for (size_t i = 0; i < bestSelection.size(); i++) {
                 if (bestSelection.at(i)) {
-                    auto const &eu = effectiveUtxos.at(i);
+                    auto const &eu = effectiveUtxos->at(i);
 
-                    buddy->logger->debug("Choose utxos with value: {}", eu.utxo->value.toLong());
+                    buddy->logger->debug("Choose utxos with value: {}", utxos.getValue(eu.index));
                     bestValue = bestValue + BigInt(eu.effectiveValue);
-                    out.push_back(std::move(*eu.utxo));
+                    out.push_back(utxos.at(eu.index));
                 }
             }
             return out;
         }
 
-        static void approximateBestSubset(const std::vector<BitcoinLikeUtxo> &vUTXOs, const int64_t totalLower, const BigInt &targetValue, std::vector<bool> &bestValues, int64_t &bestValue, int64_t inputFees, int64_t fixedDustPart = 0, int64_t oneInputDustPart = 0, int iterations = 1000) {
+        static void approximateBestSubset(const std::vector<int64_t> &vUTXOs, const int64_t totalLower, const BigInt &targetValue, std::vector<bool> &bestValues, int64_t &bestValue, int64_t inputFees, int64_t fixedDustPart = 0, int64_t oneInputDustPart = 0, int iterations = 1000) {
             std::vector<bool> includedUTXOs;
 
             bestValues.assign(vUTXOs.size(), true);
-            bestValue         = totalLower;
+            bestValue            = totalLower;
+            const int64_t target = targetValue.toInt64();
 
-            auto insecureRand = []() -> bool {
-                auto seed = std::chrono::system_clock::now().time_since_epoch().count();
-                return std::default_random_engine(seed)() % 2 == 0;
+            // Seed once per call, reseeding the engine at each draw was dominating the solver time
+            std::default_random_engine engine(std::chrono::system_clock::now().time_since_epoch().count());
+            auto insecureRand = [&engine]() -> bool {
+                return engine() % 2 == 0;
             };
 
-            for (int nRep = 0; nRep < iterations && bestValue != targetValue.toInt64(); nRep++) {
+            for (int nRep = 0; nRep < iterations && bestValue != target; nRep++) {
                 includedUTXOs.assign(vUTXOs.size(), false);
                 int64_t total       = 0;
                 bool fReachedTarget = false;
@@ -412,11 +405,11 @@ namespace ledger {
                         // because there may be some privacy improvement by making
                         // the selection random.
                         if (nPass == 0 ? insecureRand() : !includedUTXOs[i]) {
-                            auto currentAmount = vUTXOs[i].value.toLong() - inputFees - oneInputDustPart;
+                            auto currentAmount = vUTXOs[i] - inputFees - oneInputDustPart;
 
                             total += currentAmount;
                             includedUTXOs[i] = true;
-                            if (total >= targetValue.toInt64() + fixedDustPart) {
+                            if (total >= target + fixedDustPart) {
                                 fReachedTarget = true;
                                 if (total < bestValue) {
                                     bestValue  = total;
@@ -437,6 +430,16 @@ namespace ledger {
             const BigInt &aggregatedAmount,
             const api::Currency &currency,
             bool useConfirmedFirst) {
+            return filterWithKnapsackSolver(buddy, BitcoinLikeUtxoSet(utxos), {}, aggregatedAmount, currency, useConfirmedFirst);
+        }
+
+        std::vector<BitcoinLikeUtxo> BitcoinLikeStrategyUtxoPicker::filterWithKnapsackSolver(
+            const std::shared_ptr<BitcoinLikeUtxoPicker::Buddy> &buddy,
+            const BitcoinLikeUtxoSet &utxos,
+            const std::vector<bool> &excluded,
+            const BigInt &aggregatedAmount,
+            const api::Currency &currency,
+            bool useConfirmedFirst) {
             // Tx fixed size
             auto const fixedSize           = BitcoinLikeTransactionApi::estimateSize(0,
                                                                                      0,
@@ -490,47 +493,51 @@ namespace ledger {
 
             // List of values less than target
             int64_t totalLower = 0;
-            Option<BitcoinLikeUtxo> coinLowestLarger;
-            std::vector<BitcoinLikeUtxo> vUTXOs;
+            Option<size_t> coinLowestLarger;
+            std::vector<size_t> vUTXOs;
+            std::vector<int64_t> vValues;
             std::vector<BitcoinLikeUtxo> out;
 
-            // Random shuffle utxos
-            const auto &sz = utxos.size();
-            std::vector<size_t> indexes(sz, 0);
+            // Walk utxos by descending value (confirmed ones first if required) so that
+            // vUTXOs comes out already sorted. Utxos of equal value are shuffled, for privacy
+            // the utxo picked among them must not be predictable.
+            auto indexes    = utxos.getOrderedByDescendingValue(useConfirmedFirst);
             auto const seed = std::chrono::system_clock::now().time_since_epoch().count();
-            std::iota(indexes.begin(), indexes.end(), 0);
-            std::shuffle(indexes.begin(), indexes.end(), std::default_random_engine(seed));
-
-            if (useConfirmedFirst) {
-                std::stable_sort(indexes.begin(), indexes.end(), [&utxos](auto id1, auto id2) {
-                    return compareConfirmation(utxos[id1], utxos[id2]).value_or(true);
+            std::default_random_engine engine(seed);
+            for (auto first = indexes.begin(); first != indexes.end();) {
+                auto last = std::find_if(first, indexes.end(), [&](size_t index) {
+                    return utxos.getValue(index) != utxos.getValue(*first) ||
+                           (useConfirmedFirst && utxos.isConfirmed(index) != utxos.isConfirmed(*first));
                 });
+                std::shuffle(first, last, engine);
+                first = last;
             }
-
-            // Add fees for a signed input to amount
             for (auto index : indexes) {
-                auto &utxo                                  = utxos[index];
+                if (!excluded.empty() && excluded[index]) {
+                    continue;
+                }
 
-                const int64_t currentAmount                 = utxo.value.toLong();
+                const int64_t currentAmount                 = utxos.getValue(index);
                 const int64_t currentAmountWithDeductedCost = currentAmount - signedUTXOCost;
                 if (currentAmountWithDeductedCost == amountWithFixedFees) {
                     buddy->logger->debug("Found UTXO with right amount: {}", currentAmount);
-                    out.push_back(utxo);
+                    out.push_back(utxos.at(index));
                     return out;
                 } else if (currentAmountWithDeductedCost < amountWithFixedFees + minimumChangeWithOneInput) { // If utxo in range keep it
-                    vUTXOs.push_back(utxo);
+                    vUTXOs.push_back(index);
+                    vValues.push_back(currentAmount);
                     totalLower += currentAmountWithDeductedCost;
-                } else if (!coinLowestLarger.nonEmpty() || currentAmount < coinLowestLarger.getValue().value.toLong()) { // Keep track of lowest utxos out of range
+                } else if (!coinLowestLarger.nonEmpty() || currentAmount < utxos.getValue(coinLowestLarger.getValue())) { // Keep track of lowest utxos out of range
                     buddy->logger->debug("Set lowest out of range UTXO : {} ", currentAmount);
-                    coinLowestLarger = utxo;
+                    coinLowestLarger = index;
                 }
             }
 
             // If exact amount, return vUTXOs
             if (totalLower == amountWithFixedFees) {
                 buddy->logger->debug("Total of lower utxos and amount equal");
-                for (auto &selectedUtxo : vUTXOs) {
-                    out.push_back(selectedUtxo);
+                for (auto index : vUTXOs) {
+                    out.push_back(utxos.at(index));
                 }
                 return out;
             } else if (totalLower < amountWithFixedFees) {
@@ -539,31 +546,20 @@ namespace ledger {
                 if (!coinLowestLarger.nonEmpty()) {
                     buddy->logger->debug("No best selection found, fallback on filterWithDeepFirst coin selection");
                     // NOTE: same question here why we use buddy->outputAmount instead of aggregatedAmount
-                    return filterWithDeepFirst(buddy, utxos, buddy->outputAmount, currency);
+                    return filterWithDeepFirst(buddy, utxos, excluded, buddy->outputAmount, currency);
                 }
             }
 
-            // Sort vUTXOs descending
-            std::sort(vUTXOs.begin(), vUTXOs.end(), [useConfirmedFirst](auto const &lhs, auto const &rhs) {
-                if (useConfirmedFirst) {
-                    std::optional<bool> comp = compareConfirmation(lhs, rhs);
-                    if (comp.has_value()) {
-                        return comp.value();
-                    }
-                }
-                return lhs.value.toLong() > rhs.value.toLong();
-            });
-
             // Approximate best tries
             std::vector<bool> bestValues;
             int64_t bestValue = 0;
             buddy->logger->debug("Approximate Best Subset 1st try");
             // Here we target the value amountWithFixedFees which is the amount of tx + fixed fees (fees of transaction without signed UTXOs)
-            approximateBestSubset(vUTXOs, totalLower, BigInt(static_cast<int64_t>(amountWithFixedFees)), bestValues, bestValue, signedUTXOCost);
+            approximateBestSubset(vValues, totalLower, BigInt(static_cast<int64_t>(amountWithFixedFees)), bestValues, bestValue, signedUTXOCost);
             if (bestValue != amountWithFixedFees && totalLower >= amountWithFixedFees + minimumChangeWithOneInput) {
                 buddy->logger->debug("First approximation, bestValue {} with {} bestValues", bestValue, bestValues.size());
                 buddy->logger->debug("Approximate Best Subset 2nd try");
-                approximateBestSubset(vUTXOs, totalLower, BigInt((int64_t)amountWithFixedFees), bestValues, bestValue, signedUTXOCost,
+                approximateBestSubset(vValues, totalLower, BigInt((int64_t)amountWithFixedFees), bestValues, bestValue, signedUTXOCost,
                                       dustAmount_fixedAndOutputPart + dustAmount_OneInputPart, dustAmount_OneInputPart);
                 buddy->logger->debug("Second approximation, bestValue {} with {} bestValues", bestValue, bestValues.size());
             }
@@ -575,10 +571,8 @@ namespace ledger {
             std::vector<BitcoinLikeUtxo> tmpOut;
             for (unsigned int i = 0; i < vUTXOs.size(); i++) {
                 if (bestValues[i]) {
-                    auto const &utxo = vUTXOs[i];
-
-                    tmpOut.push_back(utxo);
-                    totalBest += utxo.value.toLong();
+                    tmpOut.push_back(utxos.at(vUTXOs[i]));
+                    totalBest += vValues[i];
                 }
             }
 
@@ -596,11 +590,11 @@ namespace ledger {
             const int64_t minimumChange = totalDustAmount + signedUTXOCost;
             if (coinLowestLarger.nonEmpty() &&
                 ((bestValue != amountWithFixedFees && bestValue < amountWithFixedFees + minimumChange) ||
-                 coinLowestLarger.getValue().value.toLong() - signedUTXOCost <= bestValue)) {
+                 utxos.getValue(coinLowestLarger.getValue()) - signedUTXOCost <= bestValue)) {
                 buddy->logger->debug("Add coinLowestLarger to coin selection");
-                out.push_back(coinLowestLarger.getValue());
+                out.push_back(utxos.at(coinLowestLarger.getValue()));
 
-                buddy->changeAmount = BigInt(coinLowestLarger.getValue().value.toLong() - signedUTXOCost - static_cast<int64_t>(amountWithFixedFees + changeOutputSize * buddy->request.feePerByte->toInt64()));
+                buddy->changeAmount = BigInt(utxos.getValue(coinLowestLarger.getValue()) - signedUTXOCost - static_cast<int64_t>(amountWithFixedFees + changeOutputSize * buddy->request.feePerByte->toInt64()));
             } else { // Pick bestValues
                 buddy->logger->debug("Push all vUTXOs");
                 out                 = tmpOut;
@@ -622,41 +616,45 @@ namespace ledger {
             const BigInt &aggregatedAmount,
             const api::Currency &currency,
             bool useConfirmedFirst) {
-            buddy->logger->debug("Start filterWithMergeOutputs");
+            return filterWithMergeOutputs(buddy, BitcoinLikeUtxoSet(utxos), {}, aggregatedAmount, currency, useConfirmedFirst);
+        }
 
-            return filterWithSort(buddy, utxos, aggregatedAmount, currency, [useConfirmedFirst](auto &lhs, auto &rhs) {
-                if (useConfirmedFirst) {
-                    std::optional<bool> comp = compareConfirmation(lhs, rhs);
-                    if (comp.has_value()) {
-                        return comp.value();
-                    }
-                }
+        std::vector<BitcoinLikeUtxo> BitcoinLikeStrategyUtxoPicker::filterWithMergeOutputs(
+            const std::shared_ptr<BitcoinLikeUtxoPicker::Buddy> &buddy,
+            const BitcoinLikeUtxoSet &utxos,
+            const std::vector<bool> &excluded,
+            const BigInt &aggregatedAmount,
+            const api::Currency &currency,
+            bool useConfirmedFirst) {
+            buddy->logger->debug("Start filterWithMergeOutputs");
 
-                return lhs.value.toLong() < rhs.value.toLong();
-            });
+            return filterWithSort(buddy, utxos, utxos.getOrderedByAscendingValue(useConfirmedFirst), excluded, aggregatedAmount, currency);
         }
 
         std::vector<BitcoinLikeUtxo> BitcoinLikeStrategyUtxoPicker::filterWithSort(
             const std::shared_ptr<BitcoinLikeUtxoPicker::Buddy> &buddy,
-            std::vector<BitcoinLikeUtxo> utxos,
+            const BitcoinLikeUtxoSet &utxos,
+            const std::vector<size_t> &ordering,
+            const std::vector<bool> &excluded,
             BigInt amount,
-            const api::Currency &currency,
-            std::function<bool(BitcoinLikeUtxo &, BitcoinLikeUtxo &)> const &functor) {
-            auto pickedUtxos  = std::vector<BitcoinLikeUtxo>{};
-            auto pickedInputs = 0;
-
-            pickedUtxos.reserve(utxos.size());
-            std::sort(utxos.begin(), utxos.end(), functor);
-
-            bool enough = false;
-            for (auto const &u : utxos) {
-                amount = amount + *u.value.value();
+            const api::Currency &currency) {
+            auto pickedUtxos     = std::vector<BitcoinLikeUtxo>{};
+            auto pickedInputs    = 0;
+            auto const available = excluded.empty() ? utxos.size() : static_cast<size_t>(std::count(excluded.begin(), excluded.end(), false));
+
+            bool enough          = false;
+            for (auto index : ordering) {
+                if (!excluded.empty() && excluded[index]) {
+                    continue;
+                }
+                auto const &u = utxos.at(index);
+                amount        = amount + *u.value.value();
                 pickedInputs += 1;
                 pickedUtxos.push_back(u);
 
                 buddy->logger->debug("Collected: {} Needed: {}", amount.toString(), buddy->outputAmount.toString());
 
-                auto const computeOutputAmount = pickedInputs == utxos.size();
+                auto const computeOutputAmount = pickedInputs == available;
                 if (hasEnough(buddy, amount, pickedInputs, currency, computeOutputAmount)) {
                     enough = true;
                     break;
@@ -669,8 +667,6 @@ namespace ledger {
 
             buddy->logger->debug("Require {} inputs to complete the transaction with {} for {}", pickedInputs, amount.toString(), buddy->outputAmount.toString());
 
-            pickedUtxos.shrink_to_fit();
-
             return pickedUtxos;
         }
 
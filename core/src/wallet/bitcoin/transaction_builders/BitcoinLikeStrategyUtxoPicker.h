@@ -56,23 +56,50 @@ namespace ledger {
                                                                          const api::Currency &currrency,
                                                                          bool useConfirmedFirst);
 
+            static std::vector<BitcoinLikeUtxo> filterWithKnapsackSolver(const std::shared_ptr<Buddy> &buddy,
+                                                                         const BitcoinLikeUtxoSet &utxos,
+                                                                         const std::vector<bool> &excluded,
+                                                                         const BigInt &aggregatedAmount,
+                                                                         const api::Currency &currrency,
+                                                                         bool useConfirmedFirst);
+
             static std::vector<BitcoinLikeUtxo> filterWithOptimizeSize(const std::shared_ptr<Buddy> &buddy,
                                                                        const std::vector<BitcoinLikeUtxo> &utxos,
                                                                        const BigInt &aggregatedAmount,
                                                                        const api::Currency &currrency,
                                                                        bool useConfirmedFirst);
 
+            static std::vector<BitcoinLikeUtxo> filterWithOptimizeSize(const std::shared_ptr<Buddy> &buddy,
+                                                                       const BitcoinLikeUtxoSet &utxos,
+                                                                       const std::vector<bool> &excluded,
+                                                                       const BigInt &aggregatedAmount,
+                                                                       const api::Currency &currrency,
+                                                                       bool useConfirmedFirst);
+
             static std::vector<BitcoinLikeUtxo> filterWithMergeOutputs(const std::shared_ptr<Buddy> &buddy,
                                                                        const std::vector<BitcoinLikeUtxo> &utxos,
                                                                        const BigInt &aggregatedAmount,
                                                                        const api::Currency &currrency,
                                                                        bool useConfirmedFirst);
 
+            static std::vector<BitcoinLikeUtxo> filterWithMergeOutputs(const std::shared_ptr<Buddy> &buddy,
+                                                                       const BitcoinLikeUtxoSet &utxos,
+                                                                       const std::vector<bool> &excluded,
+                                                                       const BigInt &aggregatedAmount,
+                                                                       const api::Currency &currrency,
+                                                                       bool useConfirmedFirst);
+
             static std::vector<BitcoinLikeUtxo> filterWithDeepFirst(const std::shared_ptr<Buddy> &buddy,
                                                                     const std::vector<BitcoinLikeUtxo> &utxo,
                                                                     const BigInt &aggregatedAmount,
                                                                     const api::Currency &currrency);
 
+            static std::vector<BitcoinLikeUtxo> filterWithDeepFirst(const std::shared_ptr<Buddy> &buddy,
+                                                                    const BitcoinLikeUtxoSet &utxos,
+                                                                    const std::vector<bool> &excluded,
+                                                                    const BigInt &aggregatedAmount,
+                                                                    const api::Currency &currrency);
+
             static bool hasEnough(const std::shared_ptr<Buddy> &buddy,
                                   const BigInt &aggregatedAmount,
                                   int inputCount,
@@ -95,10 +122,11 @@ namespace ledger {
           private:
             static std::vector<BitcoinLikeUtxo> filterWithSort(
                 const std::shared_ptr<BitcoinLikeUtxoPicker::Buddy> &buddy,
-                std::vector<BitcoinLikeUtxo> utxos,
+                const BitcoinLikeUtxoSet &utxos,
+                const std::vector<size_t> &ordering,
+                const std::vector<bool> &excluded,
                 BigInt amount,
-                const api::Currency &currency,
-                std::function<bool(BitcoinLikeUtxo &, BitcoinLikeUtxo &)> const &functor);
+                const api::Currency &currency);
 
             bool _useConfirmedFirst{true};
         };
@@ -169,6 +169,10 @@ namespace ledger {
             return _build(_request);
         }
 
+        const BitcoinLikeTransactionBuildRequest &BitcoinLikeTransactionBuilder::getRequest() const {
+            return _request;
+        }
+
         std::shared_ptr<api::BitcoinLikeScript>
         BitcoinLikeTransactionBuilder::createSendScript(const std::string &address) {
             auto a = std::dynamic_pointer_cast<BitcoinLikeAddress>(BitcoinLikeAddress::parse(address, _currency));
@@ -87,7 +87,8 @@ namespace ledger {
             std::string correlationId;
         };
 
-        using BitcoinLikeTransactionBuildFunction = std::function<Future<std::shared_ptr<api::BitcoinLikeTransaction>>(const BitcoinLikeTransactionBuildRequest &)>;
+        using BitcoinLikeTransactionBuildFunction      = std::function<Future<std::shared_ptr<api::BitcoinLikeTransaction>>(const BitcoinLikeTransactionBuildRequest &)>;
+        using BitcoinLikeTransactionBatchBuildFunction = std::function<Future<std::vector<Try<std::shared_ptr<api::BitcoinLikeTransaction>>>>(const std::vector<BitcoinLikeTransactionBuildRequest> &)>;
 
         class BitcoinLikeTransactionBuilder : public api::BitcoinLikeTransactionBuilder, public std::enable_shared_from_this<BitcoinLikeTransactionBuilder> {
           public:
@@ -137,6 +138,8 @@ namespace ledger {
             void build(const std::shared_ptr<api::BitcoinLikeTransactionCallback> &callback) override;
             Future<std::shared_ptr<api::BitcoinLikeTransaction>> build();
 
+            const BitcoinLikeTransactionBuildRequest &getRequest() const;
+
           private:
             api::Currency _currency;
             std::shared_ptr<api::BitcoinLikeScript> createSendScript(const std::string &address);
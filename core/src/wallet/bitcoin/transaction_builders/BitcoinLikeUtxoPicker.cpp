@@ -33,6 +33,7 @@
 
 #include <api/BitcoinLikeScript.hpp>
 #include <api/BitcoinLikeScriptChunk.hpp>
+#include <async/FutureUtils.hpp>
 #include <async/Promise.hpp>
 #include <utils/NarrowingCast.h>
 #include <wallet/bitcoin/api_impl/BitcoinLikeScriptApi.h>
@@ -58,9 +59,8 @@ namespace ledger {
             return [=](const BitcoinLikeTransactionBuildRequest &r) -> Future<std::shared_ptr<api::BitcoinLikeTransaction>> {
                 return self->async<std::shared_ptr<Buddy>>([=]() {
                                logger->info("{} Constructing BitcoinLikeTransactionBuildFunction with blockHeight: {}", CORRELATIONID_PREFIX(r.correlationId), currentBlockHeight);
-                               auto tx              = std::make_shared<BitcoinLikeTransactionApi>(self->_currency, r.correlationId, keychain->getKeychainEngine(), currentBlockHeight);
-                               auto filteredGetUtxo = createFilteredUtxoFunction(r, getUtxo);
-                               return std::make_shared<Buddy>(r, filteredGetUtxo, getTransaction, explorer, keychain, logger, tx, partial);
+                               auto tx = std::make_shared<BitcoinLikeTransactionApi>(self->_currency, r.correlationId, keychain->getKeychainEngine(), currentBlockHeight);
+                               return std::make_shared<Buddy>(r, getUtxo, getTransaction, explorer, keychain, logger, tx, partial);
                            })
                     .flatMap<std::shared_ptr<api::BitcoinLikeTransaction>>(self->getContext(), [=](const std::shared_ptr<Buddy> &buddy) -> Future<std::shared_ptr<api::BitcoinLikeTransaction>> {
                         buddy->logger->info("Buddy created");
@@ -78,6 +78,149 @@ namespace ledger {
             };
         }
 
+        BitcoinLikeTransactionBatchBuildFunction
+        BitcoinLikeUtxoPicker::getBatchBuildFunction(const BitcoinLikeGetUtxoFunction &getUtxo,
+                                                     const BitcoinLikeGetTxFunction &getTransaction,
+                                                     const std::shared_ptr<BitcoinLikeBlockchainExplorer> &explorer,
+                                                     const std::shared_ptr<BitcoinLikeKeychain> &keychain,
+                                                     const uint64_t currentBlockHeight,
+                                                     const std::shared_ptr<spdlog::logger> &logger,
+                                                     bool partial) {
+            using Transactions = std::vector<Try<std::shared_ptr<api::BitcoinLikeTransaction>>>;
+            auto self          = shared_from_this();
+            return [=](const std::vector<BitcoinLikeTransactionBuildRequest> &requests) -> Future<Transactions> {
+                logger->info("Building a batch of {} transactions with blockHeight: {}", requests.size(), currentBlockHeight);
+                auto batch = std::make_shared<Batch>();
+                return getUtxo()
+                    .flatMap<Unit>(self->getContext(), [=](const std::shared_ptr<const BitcoinLikeUtxoSet> &utxos) -> Future<Unit> {
+                        batch->utxos = utxos;
+                        batch->claimedUtxos.resize(utxos->size(), false);
+                        for (size_t index = 0; index < utxos->size(); index++) {
+                            auto const &utxo = utxos->at(index);
+                            batch->utxoIndexes.emplace(BitcoinLikeTransactionUtxoDescriptor{utxo.transactionHash, utxo.index}, index);
+                        }
+                        if (partial) {
+                            return Future<Unit>::successful(unit);
+                        }
+                        return explorer->getCurrentBlock().flatMap<Unit>(self->getContext(), [=](const std::shared_ptr<BitcoinLikeBlockchainExplorer::Block> &block) -> Future<Unit> {
+                            batch->currentBlock = block;
+                            if (!self->_currency.bitcoinLikeNetworkParameters->UsesTimestampedTransaction) {
+                                return Future<Unit>::successful(unit);
+                            }
+                            return explorer->getTimestamp()
+                                .map<Unit>(self->getContext(), [=](const int64_t &timestamp) {
+                                    batch->timestamp = timestamp;
+                                    return unit;
+                                })
+                                .recover(self->getContext(), [](const Exception &) {
+                                    return unit;
+                                });
+                        });
+                    })
+                    .flatMap<Transactions>(self->getContext(), [=](const Unit &) {
+                        // Inputs explicitly set by a request are reserved before any UTXO is picked,
+                        // a request reusing an input reserved by a previous one fails
+                        std::unordered_set<BitcoinLikeTransactionUtxoDescriptor, BitcoinLikeTransactionUtxoDescriptorHash> reservedInputs;
+                        std::vector<bool> conflicting(requests.size(), false);
+                        for (size_t index = 0; index < requests.size(); index++) {
+                            for (auto const &input : requests[index].inputs) {
+                                if (reservedInputs.count(BitcoinLikeTransactionUtxoDescriptor{input.transactionHash, input.outputIndex}) > 0) {
+                                    conflicting[index] = true;
+                                }
+                            }
+                            if (conflicting[index]) {
+                                continue;
+                            }
+                            for (auto const &input : requests[index].inputs) {
+                                reservedInputs.insert(BitcoinLikeTransactionUtxoDescriptor{input.transactionHash, input.outputIndex});
+                                batch->claim(input.transactionHash, input.outputIndex);
+                            }
+                        }
+
+                        auto getBatchUtxo = [batch]() {
+                            return Future<std::shared_ptr<const BitcoinLikeUtxoSet>>::successful(batch->utxos);
+                        };
+                        // UTXOs are picked one transaction after the other, in the order of the requests, so that
+                        // each one sees what the previous ones spent
+                        std::vector<std::shared_ptr<Buddy>> buddies(requests.size());
+                        std::vector<Future<Unit>> inputs;
+                        inputs.reserve(requests.size());
+                        auto picking = Future<Unit>::successful(unit);
+                        for (size_t index = 0; index < requests.size(); index++) {
+                            auto const &request = requests[index];
+                            if (conflicting[index]) {
+                                inputs.push_back(Future<Unit>::failure(
+                                    make_exception(api::ErrorCode::INVALID_ARGUMENT, "{} Input already spent by another transaction of the batch", CORRELATIONID_PREFIX(request.correlationId))));
+                                continue;
+                            }
+                            auto tx        = std::make_shared<BitcoinLikeTransactionApi>(self->_currency, request.correlationId, keychain->getKeychainEngine(), currentBlockHeight);
+                            auto buddy     = std::make_shared<Buddy>(request, getBatchUtxo, getTransaction, explorer, keychain, logger, tx, partial);
+                            buddy->batch   = batch;
+                            buddies[index] = buddy;
+                            inputs.push_back(picking.flatMap<Unit>(self->getContext(), [=](const Unit &) {
+                                return self->fillInputs(buddy);
+                            }));
+                            picking = inputs.back().recover(self->getContext(), [](const Exception &) {
+                                return unit;
+                            });
+                        }
+
+                        return picking.flatMap<Transactions>(self->getContext(), [=](const Unit &) {
+                            // Derive exactly one change address per transaction with a change and mark them as used,
+                            // this moves the observable range past them so that synchronizations discover them and
+                            // the next builds don't hand them out again
+                            std::vector<std::shared_ptr<Buddy>> changing;
+                            for (size_t index = 0; index < requests.size(); index++) {
+                                auto picked = inputs[index].getValue();
+                                if (picked.hasValue() && picked.getValue().isSuccess() && self->isChangeNeeded(buddies[index])) {
+                                    changing.push_back(buddies[index]);
+                                }
+                            }
+                            if (!changing.empty()) {
+                                auto addresses = keychain->getFreshAddresses(BitcoinLikeKeychain::CHANGE, changing.size());
+                                if (addresses.empty()) {
+                                    return Future<Transactions>::failure(make_exception(api::ErrorCode::RUNTIME_ERROR, "Unable to derive change addresses for the batch"));
+                                }
+                                if (addresses.size() < changing.size()) {
+                                    logger->warn("Only {} change addresses for {} transactions of the batch, the keychain uses a static address", addresses.size(), changing.size());
+                                }
+                                for (size_t index = 0; index < changing.size(); index++) {
+                                    changing[index]->changeAddress = addresses[std::min(index, addresses.size() - 1)]->toString();
+                                }
+                                for (size_t index = 0; index < addresses.size(); index++) {
+                                    keychain->markAsUsed(addresses[index]->toString(), index + 1 == addresses.size());
+                                }
+                            }
+
+                            // Outputs and transaction info only touch their own transaction and are built concurrently
+                            std::vector<Future<std::shared_ptr<api::BitcoinLikeTransaction>>> transactions;
+                            transactions.reserve(requests.size());
+                            for (size_t index = 0; index < requests.size(); index++) {
+                                auto buddy  = buddies[index];
+                                auto picked = inputs[index];
+                                transactions.push_back(picked.flatMap<Unit>(self->getContext(), [=](const Unit &) {
+                                                                        return self->fillOutputs(buddy);
+                                                                    })
+                                                           .flatMap<Unit>(self->getContext(), [=](const Unit &) {
+                                                               return self->fillTransactionInfo(buddy);
+                                                           })
+                                                           .mapPtr<api::BitcoinLikeTransaction>(self->getContext(), [=](const Unit &) -> std::shared_ptr<api::BitcoinLikeTransaction> {
+                                                               return buddy->transaction;
+                                                           }));
+                            }
+                            return executeAllSettled(self->getContext(), transactions);
+                        });
+                    });
+            };
+        }
+
+        void BitcoinLikeUtxoPicker::Batch::claim(const std::string &transactionHash, uint64_t outputIndex) {
+            auto it = utxoIndexes.find(BitcoinLikeTransactionUtxoDescriptor{transactionHash, outputIndex});
+            if (it != utxoIndexes.end()) {
+                claimedUtxos[it->second] = true;
+            }
+        }
+
         const api::Currency &BitcoinLikeUtxoPicker::getCurrency() const {
             return _currency;
         }
@@ -117,20 +260,10 @@ namespace ledger {
             }
 
             // Fill change outputs
-            auto sizeWithChange                = BitcoinLikeTransactionApi::estimateSize(buddy->transaction->getInputs().size(),
-                                                                                         buddy->transaction->getOutputs(),
-                                                                                         getCurrency(),
-                                                                                         buddy->keychain->getKeychainEngine());
-
-            const std::size_t changeOutputSize = BitcoinLikeTransactionApi::estimateOutputSize(buddy->keychain->getKeychainEngine());
-            sizeWithChange.Min += narrowing_cast<int32_t>(changeOutputSize);
-            sizeWithChange.Max += narrowing_cast<int32_t>(changeOutputSize);
-
-            BigInt dustAmount(BitcoinLikeTransactionApi::computeDustAmount(getCurrency(), sizeWithChange.Max));
-            if (buddy->changeAmount > dustAmount) {
+            if (isChangeNeeded(buddy)) {
                 // TODO implement multi change
                 // TODO implement use specific change address
-                auto changeAddress = buddy->keychain->getFreshAddress(BitcoinLikeKeychain::CHANGE)->toString();
+                auto changeAddress = buddy->batch ? buddy->changeAddress : buddy->keychain->getFreshAddress(BitcoinLikeKeychain::CHANGE)->toString();
 
                 auto amount        = buddy->changeAmount;
                 auto script        = BitcoinLikeScript::fromAddress(changeAddress, _currency);
@@ -150,10 +283,31 @@ namespace ledger {
             return Future<Unit>::successful(unit);
         }
 
+        bool BitcoinLikeUtxoPicker::isChangeNeeded(const std::shared_ptr<Buddy> &buddy) const {
+            auto sizeWithChange                = BitcoinLikeTransactionApi::estimateSize(buddy->transaction->getInputs().size(),
+                                                                                         buddy->request.outputs,
+                                                                                         _currency,
+                                                                                         buddy->keychain->getKeychainEngine());
+
+            const std::size_t changeOutputSize = BitcoinLikeTransactionApi::estimateOutputSize(buddy->keychain->getKeychainEngine());
+            sizeWithChange.Max += narrowing_cast<int32_t>(changeOutputSize);
+
+            BigInt dustAmount(BitcoinLikeTransactionApi::computeDustAmount(_currency, sizeWithChange.Max));
+            return buddy->changeAmount > dustAmount;
+        }
+
         Future<Unit> BitcoinLikeUtxoPicker::fillTransactionInfo(const std::shared_ptr<Buddy> &buddy) {
             if (buddy->isPartial) {
                 return Future<Unit>::successful(unit);
             }
+            // Batches fetch the block and timestamp once for all their transactions
+            if (buddy->batch) {
+                if (buddy->batch->timestamp.hasValue()) {
+                    buddy->transaction->setTimestamp(buddy->batch->timestamp.getValue());
+                }
+                buddy->transaction->setLockTime(static_cast<uint32_t>(buddy->batch->currentBlock->height));
+                return Future<Unit>::successful(unit);
+            }
             // Set timestamp
             if (_currency.bitcoinLikeNetworkParameters->UsesTimestampedTransaction) {
                 buddy->explorer->getTimestamp().onComplete(getContext(), [=](const Try<int64_t> &timestamp) {
@@ -200,6 +354,12 @@ namespace ledger {
                 .template flatMap<Unit>(getContext(), [self, buddy](auto const &utxos) mutable {
                     auto const sequence = buddy->request.utxoPicker.getValue().sequence;
 
+                    if (buddy->batch) {
+                        for (auto const &utxo : utxos) {
+                            buddy->batch->claim(utxo.transactionHash, utxo.index);
+                        }
+                    }
+
                     std::stringstream ss;
                     for (auto const &utxo : utxos) {
                         self->fillInput(buddy, utxo, sequence);
@@ -247,22 +407,20 @@ namespace ledger {
             }
         }
 
-        BitcoinLikeGetUtxoFunction
-        BitcoinLikeUtxoPicker::createFilteredUtxoFunction(const BitcoinLikeTransactionBuildRequest &request,
-                                                          const BitcoinLikeGetUtxoFunction &getUtxo) {
-            return [=]() -> Future<std::vector<BitcoinLikeUtxo>> {
-                return getUtxo().map<std::vector<BitcoinLikeUtxo>>(getContext(), [=](auto const &utxos) {
-                    auto const isNotExcluded = [&request](auto const &currentUtxo) {
-                        return !(currentUtxo.address.isEmpty() || request.excludedUtxos.count(BitcoinLikeTransactionUtxoDescriptor{currentUtxo.transactionHash, currentUtxo.index}) > 0);
-                    };
-
-                    std::vector<BitcoinLikeUtxo> filteredUtxos;
-
-                    std::copy_if(utxos.begin(), utxos.end(), std::back_inserter(filteredUtxos), isNotExcluded);
-
-                    return filteredUtxos;
-                });
-            };
+        std::vector<bool> BitcoinLikeUtxoPicker::getExcludedUtxos(const BitcoinLikeTransactionBuildRequest &request,
+                                                                  const BitcoinLikeUtxoSet &utxos,
+                                                                  const std::vector<bool> &claimedUtxos) {
+            std::vector<bool> excluded(claimedUtxos);
+            for (size_t index = 0; index < utxos.size(); index++) {
+                auto const &utxo = utxos.at(index);
+                if (utxo.address.isEmpty() || (!request.excludedUtxos.empty() && request.excludedUtxos.count(BitcoinLikeTransactionUtxoDescriptor{utxo.transactionHash, utxo.index}) > 0)) {
+                    if (excluded.empty()) {
+                        excluded.resize(utxos.size(), false);
+                    }
+                    excluded[index] = true;
+                }
+            }
+            return excluded;
         }
     } // namespace core
 } // namespace ledger
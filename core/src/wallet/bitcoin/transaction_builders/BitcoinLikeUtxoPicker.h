@@ -41,13 +41,16 @@
 #include <wallet/bitcoin/explorers/BitcoinLikeBlockchainExplorer.hpp>
 #include <wallet/bitcoin/keychains/BitcoinLikeKeychain.hpp>
 #include <wallet/bitcoin/transaction_builders/BitcoinLikeUtxo.hpp>
+#include <wallet/bitcoin/transaction_builders/BitcoinLikeUtxoPool.h>
 #include <wallet/bitcoin/types.h>
 
+#include <unordered_map>
+
 namespace ledger {
     namespace core {
         class BitcoinLikeTransactionApi;
         class BitcoinLikeWritableInputApi;
-        using BitcoinLikeGetUtxoFunction = std::function<Future<std::vector<BitcoinLikeUtxo>>()>;
+        using BitcoinLikeGetUtxoFunction = std::function<Future<std::shared_ptr<const BitcoinLikeUtxoSet>>()>;
         using BitcoinLikeGetTxFunction   = std::function<FuturePtr<BitcoinLikeBlockchainExplorerTransaction>(const std::string &)>;
 
         class BitcoinLikeUtxoPicker : public DedicatedContext, public std::enable_shared_from_this<BitcoinLikeUtxoPicker> {
@@ -63,8 +66,30 @@ namespace ledger {
                 const uint64_t currentBlockHeight,
                 const std::shared_ptr<spdlog::logger> &logger,
                 bool partial);
+            // Builds several transactions from the same UTXO snapshot and block, the UTXOs spent by
+            // each transaction being disjoint from the ones spent by the others
+            virtual BitcoinLikeTransactionBatchBuildFunction getBatchBuildFunction(
+                const BitcoinLikeGetUtxoFunction &getUtxo,
+                const BitcoinLikeGetTxFunction &getTransaction,
+                const std::shared_ptr<BitcoinLikeBlockchainExplorer> &explorer,
+                const std::shared_ptr<BitcoinLikeKeychain> &keychain,
+                const uint64_t currentBlockHeight,
+                const std::shared_ptr<spdlog::logger> &logger,
+                bool partial);
             const api::Currency &getCurrency() const;
 
+            // State shared by the transactions of a batch build
+            struct Batch {
+                std::shared_ptr<const BitcoinLikeUtxoSet> utxos;
+                std::shared_ptr<BitcoinLikeBlockchainExplorer::Block> currentBlock;
+                Option<int64_t> timestamp;
+                // Mask of the snapshot UTXOs already spent by a transaction of the batch
+                std::vector<bool> claimedUtxos;
+                std::unordered_map<BitcoinLikeTransactionUtxoDescriptor, size_t, BitcoinLikeTransactionUtxoDescriptorHash> utxoIndexes;
+
+                void claim(const std::string &transactionHash, uint64_t outputIndex);
+            };
+
             struct Buddy {
                 Buddy(
                     const BitcoinLikeTransactionBuildRequest &r,
@@ -93,6 +118,10 @@ namespace ledger {
                 std::shared_ptr<spdlog::logger> logger;
                 BigInt changeAmount;
                 bool isPartial;
+                // Set when the transaction is built as part of a batch
+                std::shared_ptr<Batch> batch;
+                // Change address derived for this transaction by its batch
+                std::string changeAddress;
             };
 
           protected:
@@ -100,11 +129,15 @@ namespace ledger {
             virtual Future<std::vector<BitcoinLikeUtxo>> filterInputs(const std::shared_ptr<Buddy> &buddy) = 0;
             virtual Future<Unit> fillOutputs(const std::shared_ptr<Buddy> &buddy);
             virtual Future<Unit> fillTransactionInfo(const std::shared_ptr<Buddy> &buddy);
+            bool isChangeNeeded(const std::shared_ptr<Buddy> &buddy) const;
+
+            // Mask of the UTXOs the request can't spend, empty when all of them are spendable
+            static std::vector<bool> getExcludedUtxos(const BitcoinLikeTransactionBuildRequest &request,
+                                                      const BitcoinLikeUtxoSet &utxos,
+                                                      const std::vector<bool> &claimedUtxos = {});
 
           private:
             void fillInput(const std::shared_ptr<Buddy> &buddy, const BitcoinLikeUtxo &utxo, const uint32_t sequence);
-            BitcoinLikeGetUtxoFunction createFilteredUtxoFunction(const BitcoinLikeTransactionBuildRequest &request,
-                                                                  const BitcoinLikeGetUtxoFunction &getUtxo);
 
           protected:
             api::Currency _currency;
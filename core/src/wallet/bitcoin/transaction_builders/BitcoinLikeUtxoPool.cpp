@@ -0,0 +1,165 @@
+/*
+ *
+ * BitcoinLikeUtxoPool
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "BitcoinLikeUtxoPool.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+namespace ledger {
+    namespace core {
+
+        BitcoinLikeUtxoSet::BitcoinLikeUtxoSet(std::vector<BitcoinLikeUtxo> utxos) : _utxos(std::move(utxos)) {
+            _values.reserve(_utxos.size());
+            for (auto const &utxo : _utxos) {
+                _values.push_back(utxo.value.toLong());
+            }
+        }
+
+        size_t BitcoinLikeUtxoSet::size() const {
+            return _utxos.size();
+        }
+
+        bool BitcoinLikeUtxoSet::empty() const {
+            return _utxos.empty();
+        }
+
+        const BitcoinLikeUtxo &BitcoinLikeUtxoSet::at(size_t index) const {
+            return _utxos[index];
+        }
+
+        int64_t BitcoinLikeUtxoSet::getValue(size_t index) const {
+            return _values[index];
+        }
+
+        bool BitcoinLikeUtxoSet::isConfirmed(size_t index) const {
+            return _utxos[index].blockHeight.hasValue();
+        }
+
+        const std::vector<size_t> &BitcoinLikeUtxoSet::getOrderedByDescendingValue(bool confirmedFirst) const {
+            return getOrdering(confirmedFirst ? DESCENDING_VALUE_CONFIRMED_FIRST : DESCENDING_VALUE);
+        }
+
+        const std::vector<size_t> &BitcoinLikeUtxoSet::getOrderedByAscendingValue(bool confirmedFirst) const {
+            return getOrdering(confirmedFirst ? ASCENDING_VALUE_CONFIRMED_FIRST : ASCENDING_VALUE);
+        }
+
+        const std::vector<size_t> &BitcoinLikeUtxoSet::getOrderedByDepth() const {
+            return getOrdering(DEPTH);
+        }
+
+        const std::vector<size_t> &BitcoinLikeUtxoSet::getOrdering(Ordering ordering) const {
+            std::call_once(_orderingsOnce[ordering], [this, ordering]() {
+                auto &indexes = _orderings[ordering];
+                indexes.resize(_utxos.size());
+                std::iota(indexes.begin(), indexes.end(), 0);
+
+                const bool confirmedFirst = ordering == DESCENDING_VALUE_CONFIRMED_FIRST || ordering == ASCENDING_VALUE_CONFIRMED_FIRST;
+                const bool descending     = ordering == DESCENDING_VALUE || ordering == DESCENDING_VALUE_CONFIRMED_FIRST;
+                if (ordering == DEPTH) {
+                    constexpr auto maxBlockHeight = std::numeric_limits<uint64_t>::max();
+                    std::stable_sort(indexes.begin(), indexes.end(), [this, maxBlockHeight](size_t lhs, size_t rhs) {
+                        return _utxos[lhs].blockHeight.getValueOr(maxBlockHeight) < _utxos[rhs].blockHeight.getValueOr(maxBlockHeight);
+                    });
+                    return;
+                }
+                std::stable_sort(indexes.begin(), indexes.end(), [this, confirmedFirst, descending](size_t lhs, size_t rhs) {
+                    if (confirmedFirst && isConfirmed(lhs) != isConfirmed(rhs)) {
+                        return isConfirmed(lhs);
+                    }
+                    return descending ? _values[lhs] > _values[rhs] : _values[lhs] < _values[rhs];
+                });
+            });
+            return _orderings[ordering];
+        }
+
+        std::shared_ptr<const BitcoinLikeUtxoSet::EffectiveView> BitcoinLikeUtxoSet::getEffectiveView(int64_t inputCost, bool confirmedFirst) const {
+            {
+                std::lock_guard<std::mutex> lock(_effectiveViewsLock);
+                for (auto it = _effectiveViews.begin(); it != _effectiveViews.end(); ++it) {
+                    if ((*it)->inputCost == inputCost && (*it)->confirmedFirst == confirmedFirst) {
+                        _effectiveViews.splice(_effectiveViews.begin(), _effectiveViews, it);
+                        return _effectiveViews.front();
+                    }
+                }
+            }
+
+            // Effective values only differ from values by a constant, so the descending value
+            // ordering is also the descending effective value one.
+            auto view            = std::make_shared<EffectiveView>();
+            view->inputCost      = inputCost;
+            view->confirmedFirst = confirmedFirst;
+            view->availableValue = 0;
+            for (auto index : getOrderedByDescendingValue(confirmedFirst)) {
+                const int64_t effectiveValue = _values[index] - inputCost;
+                if (effectiveValue > 0) {
+                    view->utxos.push_back(EffectiveUtxo{index, effectiveValue});
+                    view->availableValue += effectiveValue;
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(_effectiveViewsLock);
+            _effectiveViews.push_front(view);
+            if (_effectiveViews.size() > MAX_CACHED_EFFECTIVE_VIEWS) {
+                _effectiveViews.pop_back();
+            }
+            return view;
+        }
+
+        std::shared_ptr<const BitcoinLikeUtxoSet> BitcoinLikeUtxoPool::get(int64_t dustAmount, const Loader &load) {
+            uint64_t generation;
+            {
+                std::lock_guard<std::mutex> lock(_lock);
+                if (_utxos && _dustAmount == dustAmount) {
+                    return _utxos;
+                }
+                generation = _generation;
+            }
+
+            auto utxos = std::make_shared<const BitcoinLikeUtxoSet>(load());
+
+            std::lock_guard<std::mutex> lock(_lock);
+            // Don't keep a set loaded while the account data was changing
+            if (generation == _generation) {
+                _utxos      = utxos;
+                _dustAmount = dustAmount;
+            }
+            return utxos;
+        }
+
+        void BitcoinLikeUtxoPool::invalidate() {
+            std::lock_guard<std::mutex> lock(_lock);
+            _generation += 1;
+            _utxos.reset();
+        }
+    } // namespace core
+} // namespace ledger
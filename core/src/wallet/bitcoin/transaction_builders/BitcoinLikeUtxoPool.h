@@ -0,0 +1,126 @@
+/*
+ *
+ * BitcoinLikeUtxoPool
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef LEDGER_CORE_BITCOINLIKEUTXOPOOL_H
+#define LEDGER_CORE_BITCOINLIKEUTXOPOOL_H
+
+#include <array>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <wallet/bitcoin/transaction_builders/BitcoinLikeUtxo.hpp>
+
+namespace ledger {
+    namespace core {
+
+        /**
+         * Immutable set of UTXOs shared by every transaction built from the same account state.
+         * Orderings used by the picking strategies are computed lazily, once, and effective
+         * value views are cached per input cost so that repeated builds never copy nor re-sort
+         * the UTXOs.
+         */
+        class BitcoinLikeUtxoSet {
+          public:
+            struct EffectiveUtxo {
+                size_t index;
+                int64_t effectiveValue;
+            };
+
+            /**
+             * UTXOs with a positive effective value for a given input cost, sorted by
+             * descending effective value.
+             */
+            struct EffectiveView {
+                int64_t inputCost;
+                bool confirmedFirst;
+                std::vector<EffectiveUtxo> utxos;
+                int64_t availableValue;
+            };
+
+            explicit BitcoinLikeUtxoSet(std::vector<BitcoinLikeUtxo> utxos);
+
+            size_t size() const;
+            bool empty() const;
+            const BitcoinLikeUtxo &at(size_t index) const;
+            int64_t getValue(size_t index) const;
+            bool isConfirmed(size_t index) const;
+
+            const std::vector<size_t> &getOrderedByDescendingValue(bool confirmedFirst) const;
+            const std::vector<size_t> &getOrderedByAscendingValue(bool confirmedFirst) const;
+            const std::vector<size_t> &getOrderedByDepth() const;
+            std::shared_ptr<const EffectiveView> getEffectiveView(int64_t inputCost, bool confirmedFirst) const;
+
+            static const size_t MAX_CACHED_EFFECTIVE_VIEWS = 8;
+
+          private:
+            enum Ordering {
+                DESCENDING_VALUE,
+                DESCENDING_VALUE_CONFIRMED_FIRST,
+                ASCENDING_VALUE,
+                ASCENDING_VALUE_CONFIRMED_FIRST,
+                DEPTH,
+                ORDERINGS_COUNT
+            };
+
+            const std::vector<size_t> &getOrdering(Ordering ordering) const;
+
+            std::vector<BitcoinLikeUtxo> _utxos;
+            std::vector<int64_t> _values;
+            mutable std::array<std::vector<size_t>, ORDERINGS_COUNT> _orderings;
+            mutable std::array<std::once_flag, ORDERINGS_COUNT> _orderingsOnce;
+            mutable std::mutex _effectiveViewsLock;
+            mutable std::list<std::shared_ptr<const EffectiveView>> _effectiveViews;
+        };
+
+        /**
+         * Per-account cache of the spendable UTXO set. The set is loaded from the database on
+         * first use and kept until the account data changes (synchronization, insertion or
+         * erasure of operations), which must call invalidate().
+         */
+        class BitcoinLikeUtxoPool {
+          public:
+            using Loader = std::function<std::vector<BitcoinLikeUtxo>()>;
+
+            std::shared_ptr<const BitcoinLikeUtxoSet> get(int64_t dustAmount, const Loader &load);
+            void invalidate();
+
+          private:
+            std::mutex _lock;
+            std::shared_ptr<const BitcoinLikeUtxoSet> _utxos;
+            int64_t _dustAmount{0};
+            uint64_t _generation{0};
+        };
+    } // namespace core
+} // namespace ledger
+
+#endif // LEDGER_CORE_BITCOINLIKEUTXOPOOL_H
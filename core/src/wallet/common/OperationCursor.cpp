@@ -0,0 +1,105 @@
+/*
+ *
+ * OperationCursor.cpp
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#include "OperationCursor.hpp"
+
+#include "OperationQuery.h"
+
+#include <database/soci-date.h>
+#include <limits>
+
+namespace ledger {
+    namespace core {
+        namespace {
+            // Pending operations have no block, give them the highest height
+            const auto PENDING_HEIGHT = std::numeric_limits<int64_t>::max();
+            const auto BLOCK_HEIGHT_KEY = fmt::format("COALESCE(b.height, {})", PENDING_HEIGHT);
+        } // namespace
+
+        OperationCursor::OperationCursor(const std::shared_ptr<OperationQuery> &query,
+                                         Key key,
+                                         bool descending,
+                                         int32_t chunkSize,
+                                         const OperationProjection &projection)
+            : _query(query), _key(key), _descending(descending), _chunkSize(chunkSize), _projection(projection), _lastHeight(PENDING_HEIGHT), _exhausted(false) {
+            if (_chunkSize <= 0) {
+                throw make_exception(api::ErrorCode::ILLEGAL_ARGUMENT, "Operation cursor chunk size must be positive, got {}.", _chunkSize);
+            }
+            if (_key == Key::BLOCK_HEIGHT) {
+                _projection.block = true;
+            }
+        }
+
+        Future<std::vector<std::shared_ptr<api::Operation>>> OperationCursor::next() {
+            auto self = shared_from_this();
+            return _query->async<std::vector<std::shared_ptr<api::Operation>>>([=]() {
+                std::vector<std::shared_ptr<api::Operation>> out;
+                self->performNext(out);
+                return out;
+            });
+        }
+
+        void OperationCursor::next(const std::shared_ptr<api::OperationListCallback> &callback) {
+            next().callback(_query->_mainContext, callback);
+        }
+
+        bool OperationCursor::hasNext() {
+            return !_exhausted;
+        }
+
+        void OperationCursor::performNext(std::vector<std::shared_ptr<api::Operation>> &operations) {
+            if (_exhausted) {
+                return;
+            }
+
+            QueryBuilder builder;
+            const auto &key = _key == Key::DATE ? std::string("o.date") : BLOCK_HEIGHT_KEY;
+            if (_lastUid.isEmpty()) {
+                builder.seek(key, "o.uid", _descending);
+            } else if (_key == Key::DATE) {
+                builder.seek(key, "o.uid", _descending, _lastDate, _lastUid.getValue());
+            } else {
+                builder.seek(key, "o.uid", _descending, _lastHeight, _lastUid.getValue());
+            }
+            builder.limit(_chunkSize);
+            _query->performExecute(builder, _projection, operations);
+
+            if (operations.size() < static_cast<size_t>(_chunkSize)) {
+                _exhausted = true;
+            }
+            if (!operations.empty()) {
+                const auto &last = std::static_pointer_cast<OperationApi>(operations.back())->getBackend();
+                _lastUid         = last.uid;
+                _lastDate        = last.date;
+                _lastHeight      = last.block.nonEmpty() ? static_cast<int64_t>(last.block.getValue().height) : PENDING_HEIGHT;
+            }
+        }
+    } // namespace core
+} // namespace ledger
@@ -0,0 +1,109 @@
+/*
+ *
+ * OperationCursor.hpp
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#ifndef LEDGER_CORE_OPERATIONCURSOR_HPP
+#define LEDGER_CORE_OPERATIONCURSOR_HPP
+
+#include <api/Operation.hpp>
+#include <api/OperationCursor.hpp>
+#include <api/OperationListCallback.hpp>
+#include <async/Future.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utils/Option.hpp>
+#include <vector>
+
+namespace ledger {
+    namespace core {
+        class OperationQuery;
+
+        // Operation columns a caller can do without
+        struct OperationProjection {
+            bool senders    = true;
+            bool recipients = true;
+            // Block hash, height and time. Always fetched when seeking on block height.
+            bool block      = true;
+        };
+
+        /**
+         * Walks the result of an OperationQuery in chunks using keyset pagination on (key, uid):
+         * each chunk starts right after the last operation of the previous one, so memory use does
+         * not grow with the result and no rows are skipped over as with an offset. Seeking on date
+         * within an account is backed by the operations(account_uid, date, uid) index. Seeking on
+         * block height is not, as the height comes from the joined blocks table.
+         *
+         * The cursor uses the filter, the completeness and the accounts of its query, but ignores
+         * its orders, offset and limit.
+         */
+        class OperationCursor : public api::OperationCursor, public std::enable_shared_from_this<OperationCursor> {
+          public:
+            enum class Key {
+                DATE,
+                // Operations not yet in a block have the highest height: they come last in ascending
+                // order and first in descending order
+                BLOCK_HEIGHT
+            };
+
+            OperationCursor(const std::shared_ptr<OperationQuery> &query,
+                            Key key,
+                            bool descending,
+                            int32_t chunkSize,
+                            const OperationProjection &projection);
+
+            /**
+             * Fetch the next chunk of at most chunkSize operations, empty once the cursor is exhausted.
+             * Wait for a chunk before asking for the next one.
+             */
+            Future<std::vector<std::shared_ptr<api::Operation>>> next();
+            void next(const std::shared_ptr<api::OperationListCallback> &callback) override;
+            bool hasNext() override;
+
+          private:
+            void performNext(std::vector<std::shared_ptr<api::Operation>> &operations);
+
+            std::shared_ptr<OperationQuery> _query;
+            Key _key;
+            bool _descending;
+            int32_t _chunkSize;
+            OperationProjection _projection;
+
+            // Position of the last operation returned
+            Option<std::string> _lastUid;
+            std::chrono::system_clock::time_point _lastDate;
+            int64_t _lastHeight;
+            std::atomic<bool> _exhausted;
+        };
+    } // namespace core
+} // namespace ledger
+
+#endif // LEDGER_CORE_OPERATIONCURSOR_HPP
@@ -34,6 +34,7 @@
 
 #include <api/OperationCountListCallback.hpp>
 #include <api/OperationListCallback.hpp>
+#include <database/StatementCache.hpp>
 #include <database/soci-date.h>
 #include <database/soci-number.h>
 #include <database/soci-option.h>
@@ -47,6 +48,43 @@
 
 namespace ledger {
     namespace core {
+        namespace {
+            struct OperationValueBinding {
+                std::string uid;
+                std::string value;
+            };
+
+            StatementDeclaration<OperationValueBinding> selectByOperationUid(const std::string &query) {
+                return db::stmt<OperationValueBinding>(query, [](auto &s, auto &b) {
+                    s, soci::use(b.uid), soci::into(b.value);
+                });
+            }
+
+            const auto SELECT_BITCOIN_TRANSACTION_HASH  = selectByOperationUid("SELECT transaction_hash FROM bitcoin_operations WHERE uid = :uid");
+            const auto SELECT_RIPPLE_TRANSACTION_HASH   = selectByOperationUid("SELECT transaction_hash FROM ripple_operations WHERE uid = :uid");
+            const auto SELECT_TEZOS_TRANSACTION_HASH    = selectByOperationUid("SELECT transaction_hash FROM tezos_operations WHERE uid = :uid");
+            const auto SELECT_ETHEREUM_TRANSACTION_HASH = selectByOperationUid("SELECT transaction_hash FROM ethereum_operations WHERE uid = :uid");
+            const auto SELECT_ALGORAND_TRANSACTION_HASH = selectByOperationUid("SELECT transaction_hash FROM algorand_operations WHERE uid = :uid");
+            const auto SELECT_COSMOS_TRANSACTION_HASH   = selectByOperationUid("SELECT tx.hash "
+                                                                                "FROM cosmos_transactions AS tx "
+                                                                                "LEFT JOIN cosmos_messages AS msg ON msg.transaction_uid = tx.uid "
+                                                                                "LEFT JOIN cosmos_operations AS op ON op.message_uid = msg.uid "
+                                                                                "WHERE op.uid = :uid");
+            const auto SELECT_COSMOS_MESSAGE_UID        = selectByOperationUid("SELECT msg.uid "
+                                                                                "FROM cosmos_messages AS msg "
+                                                                                "LEFT JOIN cosmos_operations AS op ON op.message_uid = msg.uid "
+                                                                                "WHERE op.uid = :uid");
+
+            // Empty when the operation is not found
+            std::string getByOperationUid(soci::session &sql, const StatementDeclaration<OperationValueBinding> &declaration, const std::string &operationUid) {
+                return db::withStatement(sql, declaration, [&](PreparedStatement<OperationValueBinding> &stmt) {
+                    stmt.bindings.uid = operationUid;
+                    stmt.bindings.value.clear();
+                    stmt.execute();
+                    return stmt.bindings.value;
+                });
+            }
+        } // namespace
 
         OperationQuery::OperationQuery(const std::shared_ptr<api::QueryFilter> &headFilter,
                                        const std::shared_ptr<DatabaseSessionPool> &pool,
@@ -179,6 +217,41 @@ namespace ledger {
         void OperationQuery::performExecute(std::vector<std::shared_ptr<api::Operation>> &operations) {
             soci::session sql(_pool->getPool());
             soci::rowset<soci::row> rows = performExecute(sql);
+            inflateOperations(sql, rows, OperationProjection(), operations);
+        }
+
+        QueryBuilder &OperationQuery::joinTables(QueryBuilder &builder) {
+            return builder.outerJoin("blocks AS b", "o.block_uid = b.uid");
+        }
+
+        void OperationQuery::performExecute(QueryBuilder &builder, const OperationProjection &projection, std::vector<std::shared_ptr<api::Operation>> &operations) {
+            std::stringstream columns;
+            columns << "o.account_uid, o.uid, o.wallet_uid, o.type, o.date";
+            if (projection.senders) {
+                columns << ", o.senders";
+            }
+            if (projection.recipients) {
+                columns << ", o.recipients";
+            }
+            columns << ", o.amount, o.fees, o.currency_name, o.trust";
+            if (projection.block) {
+                columns << ", b.hash, b.height, b.time";
+            }
+
+            builder.select(columns.str()).from("operations").to("o").where(_headFilter);
+            joinTables(builder);
+
+            soci::session sql(_pool->getPool());
+            soci::rowset<soci::row> rows = builder.execute(sql);
+            inflateOperations(sql, rows, projection, operations);
+        }
+
+        void OperationQuery::inflateOperations(soci::session &sql,
+                                               soci::rowset<soci::row> &rows,
+                                               const OperationProjection &projection,
+                                               std::vector<std::shared_ptr<api::Operation>> &operations) {
+            // Bitcoin transactions are spread over several tables, inflate them for the whole page at once
+            std::vector<std::shared_ptr<OperationApi>> bitcoinOperations;
 
             for (auto &row : rows) {
                 auto accountUid = row.get<std::string>(0);
@@ -195,36 +268,50 @@ namespace ledger {
 
                 auto &operation        = operationApi->getBackend();
 
-                // Inflate abstract operation
+                // Inflate abstract operation, the projection decides which columns are present
+                std::size_t column     = 5;
 
                 operation.uid          = row.get<std::string>(1);
                 operation.walletUid    = row.get<std::string>(2);
                 operation.type         = api::from_string<api::OperationType>(row.get<std::string>(3));
                 operation.date         = row.get<std::chrono::system_clock::time_point>(4);
-                operation.senders      = strings::split(row.get<std::string>(5), ",");
-                operation.recipients   = strings::split(row.get<std::string>(6), ",");
-                operation.amount       = BigInt::fromHex(row.get<std::string>(7));
-                operation.fees         = BigInt::fromHex(row.get<std::string>(8));
-                operation.currencyName = row.get<std::string>(9);
+                if (projection.senders) {
+                    operation.senders = strings::split(row.get<std::string>(column++), ",");
+                }
+                if (projection.recipients) {
+                    operation.recipients = strings::split(row.get<std::string>(column++), ",");
+                }
+                operation.amount       = BigInt::fromHex(row.get<std::string>(column++));
+                operation.fees         = BigInt::fromHex(row.get<std::string>(column++));
+                operation.currencyName = row.get<std::string>(column++);
                 operation.trust        = nullptr;
                 operation.walletType   = account->second->getWalletType();
+                column++; // o.trust
 
-                if (row.get_indicator(11) != soci::i_null) {
+                if (projection.block && row.get_indicator(column) != soci::i_null) {
                     // The operation has a block, inflate the block
                     Block block;
-                    block.hash         = row.get<std::string>(11);
-                    block.height       = soci::get_number<uint64_t>(row, 12);
-                    block.time         = row.get<std::chrono::system_clock::time_point>(13);
+                    block.hash         = row.get<std::string>(column);
+                    block.height       = soci::get_number<uint64_t>(row, column + 1);
+                    block.time         = row.get<std::chrono::system_clock::time_point>(column + 2);
                     block.currencyName = operation.currencyName;
                     operation.block    = Option<Block>(std::move(block));
                 }
 
                 // End of inflate
                 if (_fetchCompleteOperation) {
-                    inflateCompleteTransaction(sql, accountUid, *operationApi);
+                    if (operation.walletType == api::WalletType::BITCOIN) {
+                        bitcoinOperations.push_back(operationApi);
+                    } else {
+                        inflateCompleteTransaction(sql, accountUid, *operationApi);
+                    }
                 }
                 operations.push_back(operationApi);
             }
+
+            if (!bitcoinOperations.empty()) {
+                inflateBitcoinLikeTransactions(sql, bitcoinOperations);
+            }
         }
 
         std::shared_ptr<OperationQuery>
@@ -233,6 +320,24 @@ namespace ledger {
             return shared_from_this();
         }
 
+        std::shared_ptr<OperationCursor> OperationQuery::cursor(OperationCursor::Key key,
+                                                                bool descending,
+                                                                int32_t chunkSize,
+                                                                const OperationProjection &projection) {
+            return std::make_shared<OperationCursor>(shared_from_this(), key, descending, chunkSize, projection);
+        }
+
+        std::shared_ptr<api::OperationCursor> OperationQuery::cursor(api::OperationOrderKey key, bool descending, int32_t chunkSize) {
+            switch (key) {
+            case api::OperationOrderKey::DATE:
+                return cursor(OperationCursor::Key::DATE, descending, chunkSize);
+            case api::OperationOrderKey::BLOCK_HEIGHT:
+                return cursor(OperationCursor::Key::BLOCK_HEIGHT, descending, chunkSize);
+            default:
+                throw make_exception(api::ErrorCode::ILLEGAL_ARGUMENT, "Operation cursors cannot seek on {}.", api::to_string(key));
+            }
+        }
+
         void OperationQuery::inflateCompleteTransaction(soci::session &sql, const std::string &accountUid, OperationApi &operation) {
             switch (operation.getAccount()->getWalletType()) {
             case (api::WalletType::BITCOIN): return inflateBitcoinLikeTransaction(sql, accountUid, operation);
@@ -249,11 +354,31 @@ namespace ledger {
         void OperationQuery::inflateBitcoinLikeTransaction(soci::session &sql, const std::string &accountUid, OperationApi &operation) {
             BitcoinLikeBlockchainExplorerTransaction tx;
             operation.getBackend().bitcoinTransaction = Option<BitcoinLikeBlockchainExplorerTransaction>(tx);
-            std::string transactionHash;
-            sql << "SELECT transaction_hash FROM bitcoin_operations WHERE uid = :uid", soci::use(operation.getBackend().uid), soci::into(transactionHash);
+            auto transactionHash                      = getByOperationUid(sql, SELECT_BITCOIN_TRANSACTION_HASH, operation.getBackend().uid);
             BitcoinLikeTransactionDatabaseHelper::getTransactionByHash(sql, transactionHash, accountUid, operation.getBackend().bitcoinTransaction.getValue());
         }
 
+        void OperationQuery::inflateBitcoinLikeTransactions(soci::session &sql, const std::vector<std::shared_ptr<OperationApi>> &operations) {
+            std::vector<std::string> operationUids;
+            operationUids.reserve(operations.size());
+            for (const auto &operation : operations) {
+                operationUids.push_back(operation->getBackend().uid);
+            }
+
+            std::unordered_map<std::string, BitcoinLikeBlockchainExplorerTransaction> transactions;
+            BitcoinLikeTransactionDatabaseHelper::getTransactionsByOperationUids(sql, operationUids, transactions);
+
+            for (const auto &operation : operations) {
+                auto &backend    = operation->getBackend();
+                auto transaction = transactions.find(backend.uid);
+                if (transaction != transactions.end()) {
+                    backend.bitcoinTransaction = Option<BitcoinLikeBlockchainExplorerTransaction>(transaction->second);
+                } else {
+                    backend.bitcoinTransaction = Option<BitcoinLikeBlockchainExplorerTransaction>(BitcoinLikeBlockchainExplorerTransaction());
+                }
+            }
+        }
+
         void OperationQuery::inflateCosmosLikeTransaction(
             soci::session &sql,
             const std::string &accountUid,
@@ -261,21 +386,10 @@ namespace ledger {
             cosmos::Transaction tx;
             cosmos::Message msg;
             operation.getBackend().cosmosTransaction = Option<cosmos::OperationQueryResult>({tx, msg});
-            std::string transactionHash;
-            sql << "SELECT tx.hash "
-                   "FROM cosmos_transactions AS tx "
-                   "LEFT JOIN cosmos_messages AS msg ON msg.transaction_uid = tx.uid "
-                   "LEFT JOIN cosmos_operations AS op ON op.message_uid = msg.uid "
-                   "WHERE op.uid = :uid",
-                soci::use(operation.getBackend().uid), soci::into(transactionHash);
+            auto transactionHash                     = getByOperationUid(sql, SELECT_COSMOS_TRANSACTION_HASH, operation.getBackend().uid);
             CosmosLikeTransactionDatabaseHelper::getTransactionByHash(
                 sql, transactionHash, operation.getBackend().cosmosTransaction.getValue().tx);
-            std::string msgUid;
-            sql << "SELECT msg.uid "
-                   "FROM cosmos_messages AS msg "
-                   "LEFT JOIN cosmos_operations AS op ON op.message_uid = msg.uid "
-                   "WHERE op.uid = :uid",
-                soci::use(operation.getBackend().uid), soci::into(msgUid);
+            auto msgUid = getByOperationUid(sql, SELECT_COSMOS_MESSAGE_UID, operation.getBackend().uid);
 
             CosmosLikeTransactionDatabaseHelper::getMessageByUid(
                 sql, msgUid, operation.getBackend().cosmosTransaction.getValue().msg);
@@ -284,24 +398,21 @@ namespace ledger {
         void OperationQuery::inflateRippleLikeTransaction(soci::session &sql, OperationApi &operation) {
             RippleLikeBlockchainExplorerTransaction tx;
             operation.getBackend().rippleTransaction = Option<RippleLikeBlockchainExplorerTransaction>(tx);
-            std::string transactionHash;
-            sql << "SELECT transaction_hash FROM ripple_operations WHERE uid = :uid", soci::use(operation.getBackend().uid), soci::into(transactionHash);
+            auto transactionHash = getByOperationUid(sql, SELECT_RIPPLE_TRANSACTION_HASH, operation.getBackend().uid);
             RippleLikeTransactionDatabaseHelper::getTransactionByHash(sql, transactionHash, operation.getBackend().rippleTransaction.getValue());
         }
 
         void OperationQuery::inflateTezosLikeTransaction(soci::session &sql, OperationApi &operation) {
             TezosLikeBlockchainExplorerTransaction tx;
             operation.getBackend().tezosTransaction = Option<TezosLikeBlockchainExplorerTransaction>(tx);
-            std::string transactionHash;
-            sql << "SELECT transaction_hash FROM tezos_operations WHERE uid = :uid", soci::use(operation.getBackend().uid), soci::into(transactionHash);
+            auto transactionHash = getByOperationUid(sql, SELECT_TEZOS_TRANSACTION_HASH, operation.getBackend().uid);
             TezosLikeTransactionDatabaseHelper::getTransactionByHash(sql, transactionHash, operation.getBackend().uid, operation.getBackend().tezosTransaction.getValue());
         }
 
         void OperationQuery::inflateEthereumLikeTransaction(soci::session &sql, OperationApi &operation) {
             EthereumLikeBlockchainExplorerTransaction tx;
             operation.getBackend().ethereumTransaction = Option<EthereumLikeBlockchainExplorerTransaction>(tx);
-            std::string transactionHash;
-            sql << "SELECT transaction_hash FROM ethereum_operations WHERE uid = :uid", soci::use(operation.getBackend().uid), soci::into(transactionHash);
+            auto transactionHash = getByOperationUid(sql, SELECT_ETHEREUM_TRANSACTION_HASH, operation.getBackend().uid);
             EthereumLikeTransactionDatabaseHelper::getTransactionByHash(sql, transactionHash, operation.getBackend().ethereumTransaction.getValue());
         }
 
@@ -317,10 +428,7 @@ namespace ledger {
         }
 
         void OperationQuery::inflateAlgorandLikeTransaction(soci::session &sql, algorand::Operation &operation) {
-            std::string transactionHash;
-            sql << "SELECT transaction_hash FROM algorand_operations WHERE uid = :uid",
-                soci::use(operation.getBackend().uid),
-                soci::into(transactionHash);
+            auto transactionHash = getByOperationUid(sql, SELECT_ALGORAND_TRANSACTION_HASH, operation.getBackend().uid);
 
             algorand::model::Transaction tx;
             algorand::TransactionDatabaseHelper::getTransactionByHash(sql, transactionHash, tx);
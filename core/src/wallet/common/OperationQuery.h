@@ -34,6 +34,7 @@
 #include "../common/api_impl/OperationApi.h"
 #include "AbstractAccount.hpp"
 #include "Operation.h"
+#include "OperationCursor.hpp"
 #include "api_impl/OperationApi.h"
 
 #include <api/OperationCount.hpp>
@@ -73,11 +74,29 @@ namespace ledger {
 
             std::shared_ptr<OperationQuery> registerAccount(const std::shared_ptr<AbstractAccount> &account);
 
+            /**
+             * Stream the operations matching this query in chunks of chunkSize, see OperationCursor.
+             * Prefer it over offset() to walk large results.
+             */
+            std::shared_ptr<OperationCursor> cursor(OperationCursor::Key key,
+                                                    bool descending,
+                                                    int32_t chunkSize,
+                                                    const OperationProjection &projection = OperationProjection());
+            // Only DATE and BLOCK_HEIGHT keys are supported
+            std::shared_ptr<api::OperationCursor> cursor(api::OperationOrderKey key, bool descending, int32_t chunkSize) override;
+
           private:
+            friend class OperationCursor;
             void performExecute(std::vector<std::shared_ptr<api::Operation>> &operations);
+            void performExecute(QueryBuilder &builder, const OperationProjection &projection, std::vector<std::shared_ptr<api::Operation>> &operations);
+            void inflateOperations(soci::session &sql,
+                                   soci::rowset<soci::row> &rows,
+                                   const OperationProjection &projection,
+                                   std::vector<std::shared_ptr<api::Operation>> &operations);
             void performCount(std::vector<api::OperationCount> &operations);
             void inflateCompleteTransaction(soci::session &sql, const std::string &accountUid, OperationApi &operation);
             void inflateBitcoinLikeTransaction(soci::session &sql, const std::string &accountUid, OperationApi &operation);
+            void inflateBitcoinLikeTransactions(soci::session &sql, const std::vector<std::shared_ptr<OperationApi>> &operations);
             void inflateCosmosLikeTransaction(soci::session &sql, const std::string &accountUid, OperationApi &operation);
             void inflateRippleLikeTransaction(soci::session &sql, OperationApi &operation);
             void inflateTezosLikeTransaction(soci::session &sql, OperationApi &operation);
@@ -89,6 +108,8 @@ namespace ledger {
           protected:
             virtual soci::rowset<soci::row> performExecute(soci::session &sql);
             virtual soci::rowset<soci::row> performCount(soci::session &sql);
+            // Tables the filters of a cursor may refer to, besides operations
+            virtual QueryBuilder &joinTables(QueryBuilder &builder);
             QueryBuilder _builder;
             std::shared_ptr<api::QueryFilter> _headFilter;
             bool _fetchCompleteOperation;
@@ -29,6 +29,7 @@
  *
  */
 #include "AccountDatabaseHelper.h"
+#include "BalanceCheckpointDatabaseHelper.h"
 
 #include <crypto/SHA256.hpp>
 #include <database/soci-date.h>
@@ -36,6 +37,7 @@
 #include <fmt/format.h>
 #include <list>
 #include <utils/DateUtils.hpp>
+#include <wallet/bitcoin/database/BitcoinLikeUTXODatabaseHelper.h>
 
 using namespace soci;
 
@@ -120,6 +122,7 @@ namespace ledger {
 
         void AccountDatabaseHelper::removeBlockOperation(soci::session &sql, const std::string &accountUid, const std::vector<std::string> blocks) {
             if (!blocks.empty()) {
+                BalanceCheckpointDatabaseHelper::removeCheckpoints(sql, accountUid);
                 sql << "DELETE FROM blocks where uid IN (:uids)",
                     soci::use(blocks);
 
@@ -130,6 +133,7 @@ namespace ledger {
 
                 std::vector<std::string> txToDelete(rows_tx.begin(), rows_tx.end());
                 if (!txToDelete.empty()) {
+                    auto spentOutputs = BitcoinLikeUTXODatabaseHelper::getOutputsSpentBy(sql, txToDelete);
                     sql << "DELETE FROM bitcoin_inputs WHERE uid IN ("
                            "SELECT input_uid FROM bitcoin_transaction_inputs "
                            "WHERE transaction_uid IN(:uids)"
@@ -140,6 +144,8 @@ namespace ledger {
                     sql << "DELETE FROM bitcoin_transactions "
                            "WHERE transaction_uid IN (:uids)",
                         soci::use(txToDelete);
+                    // Outputs spent by the erased transactions are unspent again
+                    BitcoinLikeUTXODatabaseHelper::insertUnspentOutputs(sql, spentOutputs);
                 }
             }
         }
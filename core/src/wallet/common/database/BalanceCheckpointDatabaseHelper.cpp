@@ -0,0 +1,194 @@
+/*
+ *
+ * BalanceCheckpointDatabaseHelper
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#include "BalanceCheckpointDatabaseHelper.h"
+
+#include <database/soci-date.h>
+#include <utils/DateUtils.hpp>
+#include <unordered_map>
+
+using namespace soci;
+
+namespace ledger {
+    namespace core {
+
+        Option<BalanceCheckpoint> BalanceCheckpointDatabaseHelper::getLatestCheckpoint(soci::session &sql,
+                                                                                       const std::string &accountUid,
+                                                                                       const std::chrono::system_clock::time_point &date) {
+            rowset<row> rows = (sql.prepare << "SELECT date, balance FROM balance_checkpoints "
+                                               "WHERE account_uid = :uid AND date <= :date "
+                                               "ORDER BY date DESC LIMIT 1",
+                                use(accountUid), use(date));
+            for (auto &row : rows) {
+                BalanceCheckpoint checkpoint;
+                checkpoint.date    = row.get<std::chrono::system_clock::time_point>(0);
+                checkpoint.balance = BigInt::fromHex(row.get<std::string>(1));
+                return Option<BalanceCheckpoint>(checkpoint);
+            }
+            return Option<BalanceCheckpoint>();
+        }
+
+        Option<BalanceCheckpoint> BalanceCheckpointDatabaseHelper::getLatestCheckpoint(soci::session &sql, const std::string &accountUid) {
+            rowset<row> rows = (sql.prepare << "SELECT date, balance FROM balance_checkpoints "
+                                               "WHERE account_uid = :uid "
+                                               "ORDER BY date DESC LIMIT 1",
+                                use(accountUid));
+            for (auto &row : rows) {
+                BalanceCheckpoint checkpoint;
+                checkpoint.date    = row.get<std::chrono::system_clock::time_point>(0);
+                checkpoint.balance = BigInt::fromHex(row.get<std::string>(1));
+                return Option<BalanceCheckpoint>(checkpoint);
+            }
+            return Option<BalanceCheckpoint>();
+        }
+
+        void BalanceCheckpointDatabaseHelper::putCheckpoint(soci::session &sql, const std::string &accountUid, const BalanceCheckpoint &checkpoint) {
+            auto balance = checkpoint.balance.toHexString();
+            sql << "INSERT INTO balance_checkpoints VALUES(:uid, :date, :balance) "
+                   "ON CONFLICT(account_uid, date) DO UPDATE SET balance = :balance",
+                use(accountUid, "uid"), use(checkpoint.date, "date"), use(balance, "balance");
+        }
+
+        Option<std::chrono::system_clock::time_point> BalanceCheckpointDatabaseHelper::getEarliestPendingDate(soci::session &sql, const std::string &accountUid) {
+            rowset<std::string> rows = (sql.prepare << "SELECT date FROM operations "
+                                                       "WHERE account_uid = :uid AND block_uid IS NULL "
+                                                       "ORDER BY date LIMIT 1",
+                                        use(accountUid));
+            for (auto &date : rows) {
+                return Option<std::chrono::system_clock::time_point>(DateUtils::fromJSON(date));
+            }
+            return Option<std::chrono::system_clock::time_point>();
+        }
+
+        bool BalanceCheckpointDatabaseHelper::hasFoldableOperations(const BalanceCheckpoint &latest,
+                                                                    const Option<std::chrono::system_clock::time_point> &earliestPendingDate,
+                                                                    const std::vector<Operation> &operations) {
+            for (const auto &operation : operations) {
+                if (operation.date > latest.date && (earliestPendingDate.isEmpty() || operation.date < earliestPendingDate.getValue())) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void BalanceCheckpointDatabaseHelper::updateCheckpoints(soci::session &sql,
+                                                                const std::string &accountUid,
+                                                                const BalanceCheckpoint &latest,
+                                                                const Option<std::chrono::system_clock::time_point> &earliestPendingDate,
+                                                                const std::vector<OperationBalanceChange> &changes) {
+            // Pending operations may be dropped or dated again once mined, they are never covered
+            auto balance       = Int256::fromBigInt(latest.balance);
+            std::size_t folded = 0;
+            for (std::size_t index = 0; index < changes.size(); index++) {
+                if (earliestPendingDate.nonEmpty() && changes[index].date >= earliestPendingDate.getValue()) {
+                    break;
+                }
+                updateBalance(balance, changes[index]);
+                folded += 1;
+                const bool settled = index + 1 == changes.size() || changes[index + 1].date > changes[index].date;
+                if (folded >= MIN_OPERATIONS_PER_CHECKPOINT && settled) {
+                    putCheckpoint(sql, accountUid, BalanceCheckpoint{changes[index].date, balance.toBigInt()});
+                    folded = 0;
+                }
+            }
+        }
+
+        void BalanceCheckpointDatabaseHelper::updateBalance(Int256 &balance, const OperationBalanceChange &change) {
+            switch (change.type) {
+            case api::OperationType::RECEIVE:
+                balance += Int256(change.amount);
+                break;
+            case api::OperationType::SEND:
+                balance -= Int256(change.amount + change.fees);
+                break;
+            default:
+                break;
+            }
+        }
+
+        void BalanceCheckpointDatabaseHelper::invalidateCheckpoints(soci::session &sql,
+                                                                    const std::string &accountUid,
+                                                                    const std::chrono::system_clock::time_point &date) {
+            sql << "DELETE FROM balance_checkpoints WHERE account_uid = :uid AND date >= :date",
+                use(accountUid), use(date);
+            sql << "DELETE FROM erc20_balance_checkpoints WHERE date >= :date AND account_uid IN "
+                   "(SELECT uid FROM erc20_accounts WHERE ethereum_account_uid = :uid)",
+                use(date), use(accountUid);
+        }
+
+        void BalanceCheckpointDatabaseHelper::invalidateCheckpoints(soci::session &sql, const std::vector<Operation> &operations) {
+            std::unordered_map<std::string, std::chrono::system_clock::time_point> earliestDates;
+            for (const auto &operation : operations) {
+                auto it = earliestDates.find(operation.accountUid);
+                if (it == earliestDates.end()) {
+                    earliestDates.emplace(operation.accountUid, operation.date);
+                } else if (operation.date < it->second) {
+                    it->second = operation.date;
+                }
+            }
+            for (const auto &earliestDate : earliestDates) {
+                invalidateCheckpoints(sql, earliestDate.first, earliestDate.second);
+            }
+        }
+
+        void BalanceCheckpointDatabaseHelper::invalidateOperationCheckpoints(soci::session &sql, const std::string &operationUid) {
+            std::string accountUid, date;
+            rowset<row> rows = (sql.prepare << "SELECT account_uid, date FROM operations WHERE uid = :uid", use(operationUid));
+            for (auto &row : rows) {
+                accountUid = row.get<std::string>(0);
+                date       = row.get<std::string>(1);
+            }
+            if (!accountUid.empty()) {
+                invalidateCheckpoints(sql, accountUid, DateUtils::fromJSON(date));
+            }
+        }
+
+        void BalanceCheckpointDatabaseHelper::invalidateMempoolCheckpoints(soci::session &sql, const std::string &accountUid) {
+            rowset<std::string> rows = (sql.prepare << "SELECT date FROM operations "
+                                                       "WHERE account_uid = :uid AND block_uid IS NULL "
+                                                       "ORDER BY date LIMIT 1",
+                                        use(accountUid));
+            for (auto &date : rows) {
+                sql << "DELETE FROM balance_checkpoints WHERE account_uid = :uid AND date >= :date",
+                    use(accountUid), use(date);
+                sql << "DELETE FROM erc20_balance_checkpoints WHERE date >= :date AND account_uid IN "
+                       "(SELECT uid FROM erc20_accounts WHERE ethereum_account_uid = :uid)",
+                    use(date), use(accountUid);
+            }
+        }
+
+        void BalanceCheckpointDatabaseHelper::removeCheckpoints(soci::session &sql, const std::string &accountUid) {
+            sql << "DELETE FROM balance_checkpoints WHERE account_uid = :uid", use(accountUid);
+            sql << "DELETE FROM erc20_balance_checkpoints WHERE account_uid IN "
+                   "(SELECT uid FROM erc20_accounts WHERE ethereum_account_uid = :uid)",
+                use(accountUid);
+        }
+    } // namespace core
+} // namespace ledger
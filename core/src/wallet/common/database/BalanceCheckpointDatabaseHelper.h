@@ -0,0 +1,111 @@
+/*
+ *
+ * BalanceCheckpointDatabaseHelper
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#ifndef LEDGER_CORE_BALANCECHECKPOINTDATABASEHELPER_H
+#define LEDGER_CORE_BALANCECHECKPOINTDATABASEHELPER_H
+
+#include <chrono>
+#include <math/BigInt.h>
+#include <soci.h>
+#include <string>
+#include <utils/Option.hpp>
+#include <vector>
+#include <wallet/common/Operation.h>
+#include <wallet/common/database/OperationDatabaseHelper.h>
+
+namespace ledger {
+    namespace core {
+        struct BalanceCheckpoint {
+            std::chrono::system_clock::time_point date;
+            // Balance of the account after applying every operation dated before or at date
+            BigInt balance;
+        };
+
+        /**
+         * Per account balance checkpoints used to compute balance histories without folding
+         * every operation of the account. They are saved by the bulk insertions of the Bitcoin and
+         * Ethereum like accounts, only over operations already in a block. A checkpoint stays valid
+         * as long as no operation dated before or at its date is inserted, updated or removed, so
+         * every path altering the operations of those accounts invalidates the checkpoints from the
+         * earliest date it touches. Other coin families never write checkpoints.
+         * The checkpoints of the ERC20 accounts of an Ethereum account are invalidated along with its own.
+         */
+        class BalanceCheckpointDatabaseHelper {
+          public:
+            // Minimum number of operations folded between two checkpoints
+            static constexpr size_t MIN_OPERATIONS_PER_CHECKPOINT = 100;
+
+            static Option<BalanceCheckpoint> getLatestCheckpoint(soci::session &sql,
+                                                                 const std::string &accountUid,
+                                                                 const std::chrono::system_clock::time_point &date);
+            static Option<BalanceCheckpoint> getLatestCheckpoint(soci::session &sql, const std::string &accountUid);
+            static void putCheckpoint(soci::session &sql, const std::string &accountUid, const BalanceCheckpoint &checkpoint);
+            // Date of the earliest operation of the account not yet in a block
+            static Option<std::chrono::system_clock::time_point> getEarliestPendingDate(soci::session &sql, const std::string &accountUid);
+
+            /**
+             * Only the operations dated after the latest checkpoint and before the earliest pending
+             * operation are ever folded. Inserting none of them can't produce a new checkpoint, so
+             * the accounts skip the update instead of scanning their operations again.
+             */
+            static bool hasFoldableOperations(const BalanceCheckpoint &latest,
+                                              const Option<std::chrono::system_clock::time_point> &earliestPendingDate,
+                                              const std::vector<Operation> &operations);
+
+            /**
+             * Fold the balance changes following a checkpoint and save a new checkpoint every
+             * MIN_OPERATIONS_PER_CHECKPOINT of them. Checkpoints are cut between two dates and
+             * before the earliest operation of the account not yet in a block.
+             *
+             * @param latest Latest checkpoint of the account, or an empty one dated at epoch
+             * @param earliestPendingDate Date of the earliest operation of the account not yet in a block
+             * @param changes Balance changes dated after the latest checkpoint, ordered by date
+             */
+            static void updateCheckpoints(soci::session &sql,
+                                          const std::string &accountUid,
+                                          const BalanceCheckpoint &latest,
+                                          const Option<std::chrono::system_clock::time_point> &earliestPendingDate,
+                                          const std::vector<OperationBalanceChange> &changes);
+            static void updateBalance(Int256 &balance, const OperationBalanceChange &change);
+
+            static void invalidateCheckpoints(soci::session &sql,
+                                              const std::string &accountUid,
+                                              const std::chrono::system_clock::time_point &date);
+            static void invalidateCheckpoints(soci::session &sql, const std::vector<Operation> &operations);
+            // Must be called before an operation is removed on its own, e.g. when dropped from the mempool
+            static void invalidateOperationCheckpoints(soci::session &sql, const std::string &operationUid);
+            // Must be called before the operations not yet in a block are removed
+            static void invalidateMempoolCheckpoints(soci::session &sql, const std::string &accountUid);
+            static void removeCheckpoints(soci::session &sql, const std::string &accountUid);
+        };
+    } // namespace core
+} // namespace ledger
+
+#endif // LEDGER_CORE_BALANCECHECKPOINTDATABASEHELPER_H
@@ -31,6 +31,7 @@
 #include "BlockDatabaseHelper.h"
 
 #include <crypto/SHA256.hpp>
+#include <database/StatementCache.hpp>
 #include <database/soci-date.h>
 #include <database/soci-number.h>
 #include <fmt/format.h>
@@ -39,12 +40,37 @@ using namespace soci;
 
 namespace ledger {
     namespace core {
+        namespace {
+            struct BlockExistsBinding {
+                std::string uid;
+                int count;
+            };
+
+            const auto COUNT_BLOCK = db::stmt<BlockExistsBinding>(
+                "SELECT COUNT(*) FROM blocks WHERE uid = :uid",
+                [](auto &s, auto &b) {
+                    s, use(b.uid), into(b.count);
+                });
+
+            struct InsertBlockBinding {
+                std::string uid;
+                Block block;
+            };
+
+            const auto INSERT_BLOCK = db::stmt<InsertBlockBinding>(
+                "INSERT INTO blocks VALUES(:uid, :hash, :height, :time, :currency_name)",
+                [](auto &s, auto &b) {
+                    s, use(b.uid), use(b.block.hash), use(b.block.height), use(b.block.time), use(b.block.currencyName);
+                });
+        } // namespace
 
         bool BlockDatabaseHelper::putBlock(soci::session &sql, const Block &block) {
             if (!blockExists(sql, block.hash, block.currencyName)) {
-                auto uid = createBlockUid(block);
-                sql << "INSERT INTO blocks VALUES(:uid, :hash, :height, :time, :currency_name)",
-                    use(uid), use(block.hash), use(block.height), use(block.time), use(block.currencyName);
+                db::withStatement(sql, INSERT_BLOCK, [&](PreparedStatement<InsertBlockBinding> &stmt) {
+                    stmt.bindings.uid   = createBlockUid(block);
+                    stmt.bindings.block = block;
+                    stmt.execute();
+                });
                 return true;
             }
             return false;
@@ -55,10 +81,12 @@ namespace ledger {
         }
 
         bool BlockDatabaseHelper::blockExists(soci::session &sql, const std::string &blockHash, const std::string &currencyName) {
-            auto count = 0;
-            auto uid   = createBlockUid(blockHash, currencyName);
-            sql << "SELECT COUNT(*) FROM blocks WHERE uid = :uid", use(uid), into(count);
-            return count > 0;
+            return db::withStatement(sql, COUNT_BLOCK, [&](PreparedStatement<BlockExistsBinding> &stmt) {
+                stmt.bindings.uid   = createBlockUid(blockHash, currencyName);
+                stmt.bindings.count = 0;
+                stmt.execute();
+                return stmt.bindings.count > 0;
+            });
         }
 
         std::string BlockDatabaseHelper::createBlockUid(const std::string &blockhash, const std::string &currencyName) {
@@ -104,5 +132,16 @@ namespace ledger {
             }
             return Option<api::Block>();
         }
+
+        std::vector<Block> BlockDatabaseHelper::getLastBlocks(soci::session &sql, const std::string &currencyName, int64_t limit) {
+            soci::rowset<soci::row> rows = (sql.prepare << "SELECT uid, hash, height, time FROM blocks WHERE "
+                                                           "currency_name = :name ORDER BY height DESC LIMIT :limit",
+                                            soci::use(currencyName), soci::use(limit));
+            std::vector<Block> blocks;
+            for (auto &row : rows) {
+                blocks.emplace_back(getBlockFromRow(row, currencyName).getValue());
+            }
+            return blocks;
+        }
     } // namespace core
 } // namespace ledger
\ No newline at end of file
@@ -35,6 +35,7 @@
 #include <soci.h>
 #include <string>
 #include <utils/Option.hpp>
+#include <vector>
 #include <wallet/common/Block.h>
 
 namespace ledger {
@@ -48,6 +49,7 @@ namespace ledger {
             static Option<api::Block> getLastBlock(soci::session &sql, const std::string &currencyName);
             static Option<api::Block> getPreviousBlockInDatabase(soci::session &sql, const std::string &currencyName, int64_t blockHeight);
             static Option<api::Block> getPreviousBlockInDatabase(soci::session &sql, const std::string &currencyName, std::chrono::system_clock::time_point date);
+            static std::vector<Block> getLastBlocks(soci::session &sql, const std::string &currencyName, int64_t limit);
         };
     } // namespace core
 } // namespace ledger
@@ -66,6 +66,32 @@ namespace ledger {
                         use(b.currencyName);
                 });
 
+        const CopyDeclaration<OperationBinding> BulkInsertDatabaseHelper::COPY_OPERATION =
+            db::copy<OperationBinding>(
+                "operations",
+                {"uid", "account_uid", "wallet_uid", "type", "date", "senders", "recipients", "amount",
+                 "fees", "block_uid", "currency_name", "trust"},
+                "uid",
+                "DO UPDATE SET block_uid = excluded.block_uid, trust = excluded.trust, amount = excluded.amount",
+                [](auto &w, auto &b) {
+                    for (size_t i = 0; i < b.uid.size(); i++) {
+                        w.row().text(b.uid[i]).text(b.accountUid[i]).text(b.walletUid[i]).text(b.type[i]).date(b.date[i])
+                            .text(b.senders[i]).text(b.receivers[i]).text(b.amount[i]).text(b.fees[i])
+                            .text(b.blockUid[i]).text(b.currencyName[i]).text(b.serializedTrust[i]);
+                    }
+                });
+        const CopyDeclaration<BlockBinding> BulkInsertDatabaseHelper::COPY_BLOCK =
+            db::copy<BlockBinding>(
+                "blocks",
+                {"uid", "hash", "height", "time", "currency_name"},
+                "uid",
+                "DO NOTHING",
+                [](auto &w, auto &b) {
+                    for (size_t i = 0; i < b.uid.size(); i++) {
+                        w.row().text(b.uid[i]).text(b.hash[i]).int8(b.height[i]).date(b.time[i]).text(b.currencyName[i]);
+                    }
+                });
+
         void BulkInsertDatabaseHelper::updateBlock(soci::session &sql, const Block &block) {
             PreparedStatement<BlockBinding> stmt;
             UPSERT_BLOCK(sql, stmt);
@@ -32,6 +32,7 @@
 #ifndef LEDGER_CORE_BULKINSERTDATABASEHELPER_HPP
 #define LEDGER_CORE_BULKINSERTDATABASEHELPER_HPP
 
+#include <database/PostgreSQLCopy.hpp>
 #include <database/PreparedStatement.hpp>
 #include <soci.h>
 #include <wallet/common/Operation.h>
@@ -72,6 +73,9 @@ namespace ledger {
           public:
             static const StatementDeclaration<OperationBinding> UPSERT_OPERATION;
             static const StatementDeclaration<BlockBinding> UPSERT_BLOCK;
+            // PostgreSQL only, same semantics as the upserts above for whole batches
+            static const CopyDeclaration<OperationBinding> COPY_OPERATION;
+            static const CopyDeclaration<BlockBinding> COPY_BLOCK;
             static void updateBlock(soci::session &sql, const Block &block);
         };
     } // namespace core
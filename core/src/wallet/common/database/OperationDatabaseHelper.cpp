@@ -30,6 +30,7 @@
  */
 #include "OperationDatabaseHelper.h"
 
+#include "BalanceCheckpointDatabaseHelper.h"
 #include "BlockDatabaseHelper.h"
 
 #include <algorithm>
@@ -100,6 +101,42 @@ namespace ledger {
             return c;
         }
 
+        std::size_t
+        OperationDatabaseHelper::queryBalanceChanges(soci::session &sql,
+                                                     const std::string &accountUid,
+                                                     const std::chrono::system_clock::time_point &after,
+                                                     std::vector<OperationBalanceChange> &out) {
+            return queryBalanceChanges(sql, accountUid, after, Option<std::chrono::system_clock::time_point>(), out);
+        }
+
+        std::size_t
+        OperationDatabaseHelper::queryBalanceChanges(soci::session &sql,
+                                                     const std::string &accountUid,
+                                                     const std::chrono::system_clock::time_point &after,
+                                                     const Option<std::chrono::system_clock::time_point> &before,
+                                                     std::vector<OperationBalanceChange> &out) {
+            int bounded      = before.nonEmpty() ? 1 : 0;
+            auto beforeDate  = before.getValueOr(after);
+            rowset<row> rows = (sql.prepare << "SELECT op.amount, op.fees, op.type, op.date"
+                                               " FROM operations AS op "
+                                               " WHERE op.account_uid = :uid AND op.date > :date"
+                                               " AND (:bounded = 0 OR op.date < :before)"
+                                               " AND ((op.type = 'SEND' AND op.senders IS NOT NULL) OR (op.type = 'RECEIVE' AND op.recipients IS NOT NULL))"
+                                               " ORDER BY op.date",
+                                use(accountUid, "uid"), use(after, "date"), use(bounded, "bounded"), use(beforeDate, "before"));
+
+            std::size_t c = 0;
+            for (auto &row : rows) {
+                out.push_back(OperationBalanceChange{
+                    DateUtils::fromJSON(row.get<std::string>(3)),
+                    api::from_string<api::OperationType>(row.get<std::string>(2)),
+                    row.get<UInt256>(0),
+                    row.get<UInt256>(1)});
+                c += 1;
+            }
+            return c;
+        }
+
         Option<bool> OperationDatabaseHelper::isOperationInBlock(soci::session &sql, const std::string &opUid) {
             rowset<row> rows = (sql.prepare << "SELECT block_uid "
                                                "FROM operations "
@@ -117,6 +154,7 @@ namespace ledger {
             const std::chrono::system_clock::time_point &date,
             const std::string &specificOperationsTableName,
             const std::string &specificTransactionsTableName) {
+            BalanceCheckpointDatabaseHelper::invalidateCheckpoints(sql, accountUid, date);
             rowset<std::string> rows = (sql.prepare << "SELECT transaction_uid FROM " << specificOperationsTableName << " AS sop "
                                                                                                                         "JOIN operations AS op ON sop.uid = op.uid "
                                                                                                                         "WHERE op.account_uid = :uid AND op.date >= :date",
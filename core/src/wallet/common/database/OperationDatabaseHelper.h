@@ -32,6 +32,7 @@
 #define LEDGER_CORE_OPERATIONDATABASEHELPER_H
 
 #include <api/OperationType.hpp>
+#include <math/Int256.h>
 #include <soci.h>
 #include <string>
 #include <vector>
@@ -39,6 +40,14 @@
 
 namespace ledger {
     namespace core {
+        // Fields of an operation needed to fold a balance, kept on the stack
+        struct OperationBalanceChange {
+            std::chrono::system_clock::time_point date;
+            api::OperationType type;
+            UInt256 amount;
+            UInt256 fees;
+        };
+
         class OperationDatabaseHelper {
           public:
             static std::vector<std::string> fetchFromBlocks(soci::session &sql,
@@ -52,6 +61,26 @@ namespace ledger {
                                                const std::string &accountUid,
                                                std::vector<Operation> &out);
 
+            /**
+             * Get the balance changes of the operations of an account dated strictly after a given date
+             *
+             * @param sql Current sql connection session
+             * @param accountUid Account whose operations are queried
+             * @param after Date after which operations are returned
+             * @param out Vector receiving the balance changes ordered by date
+             * @return The number of balance changes pushed in out
+             */
+            static std::size_t queryBalanceChanges(soci::session &sql,
+                                                   const std::string &accountUid,
+                                                   const std::chrono::system_clock::time_point &after,
+                                                   std::vector<OperationBalanceChange> &out);
+            // Same as above, only the operations dated strictly before a given date when there is one
+            static std::size_t queryBalanceChanges(soci::session &sql,
+                                                   const std::string &accountUid,
+                                                   const std::chrono::system_clock::time_point &after,
+                                                   const Option<std::chrono::system_clock::time_point> &before,
+                                                   std::vector<OperationBalanceChange> &out);
+
             /**
              * Checks if an operation is in a block or not
              *
@@ -31,15 +31,20 @@
 #ifndef LEDGER_CORE_ABSTRACTLEDGERAPIBLOCKCHAINEXPLORER_H
 #define LEDGER_CORE_ABSTRACTLEDGERAPIBLOCKCHAINEXPLORER_H
 
+#include <algorithm>
 #include <api/Configuration.hpp>
+#include <async/FutureUtils.hpp>
+#include <chrono>
 #include <fmt/format.h>
 #include <net/HttpClient.hpp>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 #include <sstream>
+#include <unordered_set>
 #include <utils/JSONUtils.h>
 #include <utils/hex.h>
 #include <wallet/common/Block.h>
+#include <wallet/common/explorers/AdaptiveExplorerPaging.hpp>
 #include <wallet/common/explorers/LedgerApiParser.hpp>
 
 namespace ledger {
@@ -48,13 +53,11 @@ namespace ledger {
         // TODO: remove TransactionsParser and TransactionsBulkParser from template when refactoring them (common interface)
         template <typename BlockchainExplorerTransaction, typename TransactionsBulk, typename TransactionsParser, typename TransactionsBulkParser, typename BlockParser, typename NetworkParameters>
         class AbstractLedgerApiBlockchainExplorer {
-            constexpr static const uint16_t DEFAULT_BATCH_SIZE = 1000;
-
           private:
             std::string getParams(Option<std::string> fromBlockHash,
                                   const Option<void *> &session,
-                                  bool isSnakeCase    = false,
-                                  uint16_t batch_size = DEFAULT_BATCH_SIZE) {
+                                  bool isSnakeCase,
+                                  uint16_t batch_size) {
                 std::string params;
                 std::unordered_map<std::string, std::string> headers;
 
@@ -83,13 +86,12 @@ namespace ledger {
                 return params;
             }
 
-          public:
             FuturePtr<TransactionsBulk>
-            getLedgerApiTransactions(const std::vector<std::string> &addresses,
-                                     Option<std::string> fromBlockHash,
-                                     Option<void *> session,
-                                     bool isSnakeCase    = false,
-                                     uint16_t batch_size = DEFAULT_BATCH_SIZE) {
+            getLedgerApiTransactionsPage(const std::vector<std::string> &addresses,
+                                         Option<std::string> fromBlockHash,
+                                         Option<void *> session,
+                                         bool isSnakeCase,
+                                         uint16_t batch_size) {
                 auto joinedAddresses = Array<std::string>(addresses).join(strings::mkString(",")).getValueOr("");
                 std::string params   = getParams(fromBlockHash, session, isSnakeCase, batch_size);
                 std::unordered_map<std::string, std::string> headers;
@@ -98,9 +100,10 @@ namespace ledger {
                     headers["X-LedgerWallet-SyncToken"] = *((std::string *)session.getValue());
                 }
 
+                auto start = std::chrono::steady_clock::now();
                 return _http->GET(fmt::format("/blockchain/{}/{}/addresses/{}/transactions{}", getExplorerVersion(), getNetworkParameters().Identifier, joinedAddresses, params), headers)
                     .template json<TransactionsBulk, Exception>(LedgerApiParser<TransactionsBulk, TransactionsBulkParser>(), true)
-                    .template mapPtr<TransactionsBulk>(getExplorerContext(), [fromBlockHash, batch_size](const Either<Exception, std::shared_ptr<TransactionsBulk>> &result) {
+                    .template mapPtr<TransactionsBulk>(getExplorerContext(), [this, addresses, fromBlockHash, batch_size, start](const Either<Exception, std::shared_ptr<TransactionsBulk>> &result) {
                         if (result.isLeft()) {
                             // Only case where we should emit block not found error
                             if (!fromBlockHash.isEmpty() && result.getLeft().getErrorCode() == api::ErrorCode::HTTP_ERROR) {
@@ -110,13 +113,28 @@ namespace ledger {
                             }
                         }
 
-                        auto bulk = result.getRight();
+                        auto bulk      = result.getRight();
+                        auto latency   = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+                        auto truncated = bulk->hasNext || bulk->transactions.size() >= batch_size;
+                        std::unordered_map<std::string, std::size_t> activity;
+                        if (truncated && addresses.size() > 1) {
+                            for (const auto &tx : bulk->transactions) {
+                                std::unordered_set<std::string> involved;
+                                for (const auto &address : getTransactionAddresses(tx)) {
+                                    if (involved.insert(address).second) {
+                                        activity[address] += 1;
+                                    }
+                                }
+                            }
+                        }
+                        _paging.record(addresses, batch_size, bulk->transactions.size(), truncated, latency, activity);
+
                         if (bulk->transactions.empty() || !bulk->transactions.front().block.hasValue() || !bulk->transactions.back().block.hasValue()) {
                             return bulk;
                         }
                         auto firstBlock = bulk->transactions.front().block.getValue();
                         auto lastBlock  = bulk->transactions.back().block.getValue();
-                        if (bulk->transactions.size() == batch_size && firstBlock.hash == lastBlock.hash) { // We might have more than {batch_size} transactions in a single block for this address, let's ask for more transaction ! (recovered exception below)
+                        if (bulk->transactions.size() == batch_size && firstBlock.hash == lastBlock.hash && batch_size < AdaptiveExplorerPaging::grow(batch_size)) { // We might have more than {batch_size} transactions in a single block for this address, let's ask for more transaction ! (recovered exception below)
                             throw make_exception(api::ErrorCode::INCOMPLETE_TRANSACTION, "Some transaction might be missing !");
                         }
                         return result.getRight();
@@ -125,10 +143,72 @@ namespace ledger {
                         if (e.getErrorCode() != api::ErrorCode::INCOMPLETE_TRANSACTION) {
                             throw e;
                         }
-                        return getLedgerApiTransactions(addresses, fromBlockHash, session, isSnakeCase, batch_size + DEFAULT_BATCH_SIZE);
+                        // Grow geometrically so that a busy block is downloaded again a logarithmic number of times
+                        return getLedgerApiTransactionsPage(addresses, fromBlockHash, session, isSnakeCase, AdaptiveExplorerPaging::grow(batch_size));
                     });
+            }
+
+          public:
+            // Merges the pages of concurrent request streams into a single page. When a stream is
+            // truncated, the others are cut at its last block so that the next page, which starts
+            // from the last returned block, does not skip any transaction.
+            static std::shared_ptr<TransactionsBulk> mergeTransactionsBulks(const std::vector<std::shared_ptr<TransactionsBulk>> &bulks) {
+                auto merged     = std::make_shared<TransactionsBulk>();
+                merged->hasNext = false;
+                Option<uint64_t> lastHeight;
+                for (const auto &bulk : bulks) {
+                    if (!bulk->hasNext) {
+                        continue;
+                    }
+                    merged->hasNext = true;
+                    for (auto it = bulk->transactions.rbegin(); it != bulk->transactions.rend(); it++) {
+                        if (it->block.hasValue()) {
+                            lastHeight = std::min(lastHeight.getValueOr(it->block->height), it->block->height);
+                            break;
+                        }
+                    }
+                }
+
+                std::unordered_set<std::string> hashes;
+                for (const auto &bulk : bulks) {
+                    for (const auto &tx : bulk->transactions) {
+                        // Unconfirmed transactions come with the last page
+                        auto keep = tx.block.hasValue() ? lastHeight.isEmpty() || tx.block->height <= lastHeight.getValue() : !merged->hasNext;
+                        if (keep && hashes.insert(tx.hash).second) {
+                            merged->transactions.push_back(tx);
+                        }
+                    }
+                }
+                std::stable_sort(merged->transactions.begin(), merged->transactions.end(), [](const BlockchainExplorerTransaction &a, const BlockchainExplorerTransaction &b) {
+                    auto heightA = a.block.hasValue() ? a.block->height : std::numeric_limits<uint64_t>::max();
+                    auto heightB = b.block.hasValue() ? b.block->height : std::numeric_limits<uint64_t>::max();
+                    return heightA < heightB;
+                });
+                return merged;
+            }
+
+            FuturePtr<TransactionsBulk>
+            getLedgerApiTransactions(const std::vector<std::string> &addresses,
+                                     Option<std::string> fromBlockHash,
+                                     Option<void *> session,
+                                     bool isSnakeCase = false) {
+                // The sync token tracks what was already sent to the client, keep a single stream with it
+                auto groups = session.isEmpty() ? _paging.split(addresses) : std::vector<std::vector<std::string>>{addresses};
+                if (groups.size() == 1) {
+                    return getLedgerApiTransactionsPage(addresses, fromBlockHash, session, isSnakeCase, _paging.getBatchSize(addresses));
+                }
+                std::vector<Future<std::shared_ptr<TransactionsBulk>>> pages;
+                for (const auto &group : groups) {
+                    pages.push_back(getLedgerApiTransactionsPage(group, fromBlockHash, session, isSnakeCase, _paging.getBatchSize(group)));
+                }
+                return executeAll(getExplorerContext(), pages)
+                    .template map<std::shared_ptr<TransactionsBulk>>(getExplorerContext(), &mergeTransactionsBulks);
             };
 
+            std::vector<AdaptiveExplorerPaging::Timing> getLedgerApiTransactionsTimings() const {
+                return _paging.getTimings();
+            }
+
             FuturePtr<Block>
             getLedgerApiCurrentBlock() const {
                 return _http->GET(fmt::format("/blockchain/{}/{}/blocks/current", getExplorerVersion(), getNetworkParameters().Identifier))
@@ -208,7 +288,12 @@ namespace ledger {
             virtual std::shared_ptr<api::ExecutionContext> getExplorerContext() const = 0;
             virtual NetworkParameters getNetworkParameters() const                    = 0;
             virtual std::string getExplorerVersion() const                            = 0;
+            // Addresses involved in a transaction, used to find the addresses that deserve their own request stream
+            virtual std::vector<std::string> getTransactionAddresses(const BlockchainExplorerTransaction &transaction) const {
+                return {};
+            }
             std::shared_ptr<HttpClient> _http;
+            AdaptiveExplorerPaging _paging;
         };
     } // namespace core
 } // namespace ledger
@@ -0,0 +1,139 @@
+/*
+ *
+ * AdaptiveExplorerPaging.cpp
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#include "AdaptiveExplorerPaging.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace ledger {
+    namespace core {
+        const uint16_t AdaptiveExplorerPaging::DEFAULT_BATCH_SIZE;
+        const uint16_t AdaptiveExplorerPaging::MIN_BATCH_SIZE;
+        const uint16_t AdaptiveExplorerPaging::MAX_BATCH_SIZE;
+        const int64_t AdaptiveExplorerPaging::TARGET_LATENCY_MS;
+        const std::size_t AdaptiveExplorerPaging::MAX_TIMINGS;
+        const uint32_t AdaptiveExplorerPaging::DEFAULT_MAX_STREAMS;
+
+        AdaptiveExplorerPaging::AdaptiveExplorerPaging() : _maxStreams(DEFAULT_MAX_STREAMS), _groupBatchSize(DEFAULT_BATCH_SIZE) {
+        }
+
+        std::vector<std::vector<std::string>> AdaptiveExplorerPaging::split(const std::vector<std::string> &addresses) const {
+            std::lock_guard<std::mutex> lock(_lock);
+            std::vector<std::vector<std::string>> groups;
+            std::vector<std::string> others;
+            for (const auto &address : addresses) {
+                // Keep one stream for the cold addresses
+                if (groups.size() + 1 < _maxStreams && _hotAddresses.find(address) != _hotAddresses.end()) {
+                    groups.push_back({address});
+                } else {
+                    others.push_back(address);
+                }
+            }
+            if (!others.empty()) {
+                groups.push_back(std::move(others));
+            }
+            return groups;
+        }
+
+        uint16_t AdaptiveExplorerPaging::getBatchSize(const std::vector<std::string> &addresses) const {
+            std::lock_guard<std::mutex> lock(_lock);
+            if (addresses.size() == 1) {
+                auto it = _hotAddresses.find(addresses.front());
+                if (it != _hotAddresses.end()) {
+                    return it->second;
+                }
+            }
+            return _groupBatchSize;
+        }
+
+        uint16_t AdaptiveExplorerPaging::grow(uint16_t batchSize) {
+            return static_cast<uint16_t>(std::min<uint32_t>(std::numeric_limits<uint16_t>::max(), static_cast<uint32_t>(batchSize) * 2));
+        }
+
+        void AdaptiveExplorerPaging::record(const std::vector<std::string> &addresses,
+                                            uint16_t batchSize,
+                                            std::size_t transactions,
+                                            bool truncated,
+                                            std::chrono::milliseconds latency,
+                                            const std::unordered_map<std::string, std::size_t> &activity) {
+            std::lock_guard<std::mutex> lock(_lock);
+            _timings.push_back(Timing{addresses.size(), batchSize, transactions, truncated, latency});
+            if (_timings.size() > MAX_TIMINGS) {
+                _timings.pop_front();
+            }
+
+            if (addresses.size() == 1) {
+                auto it = _hotAddresses.find(addresses.front());
+                if (it != _hotAddresses.end()) {
+                    if (truncated) {
+                        it->second = adapt(batchSize, truncated, latency);
+                    } else {
+                        // Caught up, the address goes back to its group
+                        _hotAddresses.erase(it);
+                    }
+                    return;
+                }
+            }
+
+            _groupBatchSize = adapt(_groupBatchSize, truncated, latency);
+            if (!truncated || addresses.size() < 2) {
+                return;
+            }
+            const std::unordered_set<std::string> group(addresses.begin(), addresses.end());
+            for (const auto &entry : activity) {
+                // Addresses involved in at least half of a truncated page deserve their own stream
+                if (entry.second * 2 >= transactions && group.find(entry.first) != group.end()) {
+                    _hotAddresses.emplace(entry.first, _groupBatchSize);
+                }
+            }
+        }
+
+        void AdaptiveExplorerPaging::setMaxStreams(uint32_t maxStreams) {
+            std::lock_guard<std::mutex> lock(_lock);
+            _maxStreams = std::max<uint32_t>(maxStreams, 1);
+        }
+
+        std::vector<AdaptiveExplorerPaging::Timing> AdaptiveExplorerPaging::getTimings() const {
+            std::lock_guard<std::mutex> lock(_lock);
+            return std::vector<Timing>(_timings.begin(), _timings.end());
+        }
+
+        uint16_t AdaptiveExplorerPaging::adapt(uint16_t batchSize, bool truncated, std::chrono::milliseconds latency) {
+            if (latency.count() > TARGET_LATENCY_MS) {
+                return std::max<uint16_t>(MIN_BATCH_SIZE, batchSize / 2);
+            }
+            if (truncated) {
+                return std::min<uint16_t>(MAX_BATCH_SIZE, grow(batchSize));
+            }
+            return batchSize;
+        }
+    } // namespace core
+} // namespace ledger
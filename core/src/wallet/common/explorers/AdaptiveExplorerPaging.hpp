@@ -0,0 +1,104 @@
+/*
+ *
+ * AdaptiveExplorerPaging.hpp
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#ifndef LEDGER_CORE_ADAPTIVEEXPLORERPAGING_HPP
+#define LEDGER_CORE_ADAPTIVEEXPLORERPAGING_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace ledger {
+    namespace core {
+
+        /**
+         * Paging policy of the Ledger API transaction endpoints. The batch size grows while pages
+         * come back full and fast and shrinks when calls get slow. Addresses that dominate truncated
+         * pages are considered hot and get their own request stream, so that busy addresses do not
+         * force every page of their address group to be downloaded again.
+         */
+        class AdaptiveExplorerPaging {
+          public:
+            struct Timing {
+                std::size_t addresses;
+                uint16_t batchSize;
+                std::size_t transactions;
+                bool truncated;
+                std::chrono::milliseconds latency;
+            };
+
+            static const uint16_t DEFAULT_BATCH_SIZE  = 1000;
+            static const uint16_t MIN_BATCH_SIZE      = 100;
+            static const uint16_t MAX_BATCH_SIZE      = 16000;
+            static const int64_t TARGET_LATENCY_MS    = 2000;
+            static const std::size_t MAX_TIMINGS      = 256;
+            static const uint32_t DEFAULT_MAX_STREAMS = 4;
+
+            AdaptiveExplorerPaging();
+
+            // Hot addresses are requested on their own, the others stay in a single group
+            std::vector<std::vector<std::string>> split(const std::vector<std::string> &addresses) const;
+            uint16_t getBatchSize(const std::vector<std::string> &addresses) const;
+
+            // Batch size to retry with when a full page only contains a single block
+            static uint16_t grow(uint16_t batchSize);
+
+            // Records a call and adapts the policy. The activity holds the number of transactions
+            // of the page that involve each address of the group.
+            void record(const std::vector<std::string> &addresses,
+                        uint16_t batchSize,
+                        std::size_t transactions,
+                        bool truncated,
+                        std::chrono::milliseconds latency,
+                        const std::unordered_map<std::string, std::size_t> &activity);
+
+            // Maximum number of requests a single page of transactions is split into
+            void setMaxStreams(uint32_t maxStreams);
+            std::vector<Timing> getTimings() const;
+
+          private:
+            static uint16_t adapt(uint16_t batchSize, bool truncated, std::chrono::milliseconds latency);
+
+            mutable std::mutex _lock;
+            uint32_t _maxStreams;
+            uint16_t _groupBatchSize;
+            // Hot addresses with their own batch size
+            std::unordered_map<std::string, uint16_t> _hotAddresses;
+            std::deque<Timing> _timings;
+        };
+    } // namespace core
+} // namespace ledger
+
+#endif // LEDGER_CORE_ADAPTIVEEXPLORERPAGING_HPP
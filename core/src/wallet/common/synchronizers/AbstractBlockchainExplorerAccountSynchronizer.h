@@ -51,6 +51,7 @@
 #include <utils/Unit.hpp>
 #include <wallet/common/AbstractWallet.hpp>
 #include <wallet/common/database/AccountDatabaseHelper.h>
+#include <wallet/common/database/BalanceCheckpointDatabaseHelper.h>
 #include <wallet/common/database/BlockDatabaseHelper.h>
 #include <wallet/common/database/OperationDatabaseHelper.h>
 
@@ -540,6 +541,7 @@ namespace ledger {
                         buddy->logger->info("Drop transaction {}", tx.first);
                         buddy->logger->info("Deleting operation from DB {}", tx.second);
                         try {
+                            BalanceCheckpointDatabaseHelper::invalidateOperationCheckpoints(sql, tx.second);
                             sql << "DELETE FROM operations WHERE uid = :uid", soci::use(tx.second);
                             // tr.commit();
                         } catch (std::exception &ex) {
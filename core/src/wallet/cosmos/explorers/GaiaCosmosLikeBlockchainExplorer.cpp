@@ -88,7 +88,7 @@ namespace ledger {
               CosmosLikeBlockchainExplorer(
                   configuration,
                   {api::Configuration::BLOCKCHAIN_EXPLORER_API_ENDPOINT}),
-              _http(http), _parameters(parameters) {}
+              _http(http), _parameters(parameters), _blockCache(BLOCK_CACHE_CAPACITY) {}
 
         const std::vector<CosmosLikeBlockchainExplorer::TransactionFilter> &
         GaiaCosmosLikeBlockchainExplorer::getTransactionFilters() {
@@ -97,16 +97,49 @@ namespace ledger {
 
         FuturePtr<cosmos::Block>
         GaiaCosmosLikeBlockchainExplorer::getBlock(uint64_t &blockHeight) const {
-            return _http
-                ->GET(fmt::format(kGaiaBlocksEndpoint, blockHeight), ACCEPT_HEADER)
-                .json(true)
-                .mapPtr<cosmos::Block>(
-                    getContext(), [](const HttpRequest::JsonResult &response) {
-                        auto result          = std::make_shared<cosmos::Block>();
-                        const auto &document = std::get<1>(response)->GetObject();
-                        rpcs_parsers::parseBlock(document, currencies::ATOM.name, *result);
-                        return result;
-                    });
+            const auto height = blockHeight;
+            std::lock_guard<std::mutex> lock(_pendingBlocksLock);
+            auto cached = _blockCache.get(height);
+            if (cached.hasValue()) {
+                return FuturePtr<cosmos::Block>::successful(
+                    std::make_shared<cosmos::Block>(cached.getValue()));
+            }
+            // Coalesce with an identical request already in flight
+            auto pending = _pendingBlocks.find(height);
+            if (pending != _pendingBlocks.end()) {
+                return pending->second;
+            }
+
+            auto block = _http
+                             ->GET(fmt::format(kGaiaBlocksEndpoint, height), ACCEPT_HEADER)
+                             .json(true)
+                             .mapPtr<cosmos::Block>(
+                                 getContext(), [](const HttpRequest::JsonResult &response) {
+                                     auto result          = std::make_shared<cosmos::Block>();
+                                     const auto &document = std::get<1>(response)->GetObject();
+                                     rpcs_parsers::parseBlock(document, currencies::ATOM.name, *result);
+                                     return result;
+                                 });
+            _pendingBlocks.emplace(height, block);
+            // The lock is held until the request is registered, so this callback cannot
+            // run before the insertion above.
+            block.onComplete(
+                getContext(),
+                [this, height](const Try<std::shared_ptr<cosmos::Block>> &result) {
+                    std::lock_guard<std::mutex> lock(_pendingBlocksLock);
+                    if (result.isSuccess() && result.getValue() != nullptr) {
+                        _blockCache.put(height, *result.getValue());
+                    }
+                    _pendingBlocks.erase(height);
+                });
+            return block;
+        }
+
+        void GaiaCosmosLikeBlockchainExplorer::warmUpBlockCache(
+            const std::vector<cosmos::Block> &blocks) {
+            for (const auto &block : blocks) {
+                _blockCache.put(block.height, block);
+            }
         }
 
         FuturePtr<ledger::core::cosmos::Account>
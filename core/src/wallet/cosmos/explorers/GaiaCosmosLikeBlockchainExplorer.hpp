@@ -33,7 +33,10 @@
 
 #include <async/DedicatedContext.hpp>
 #include <boost/utility/string_view.hpp>
+#include <mutex>
 #include <net/HttpClient.hpp>
+#include <unordered_map>
+#include <utils/LRUCache.h>
 #include <wallet/common/Block.h>
 #include <wallet/cosmos/explorers/CosmosLikeBlockchainExplorer.hpp>
 
@@ -66,8 +69,16 @@ namespace ledger {
             const std::vector<TransactionFilter> &getTransactionFilters() override;
 
             // Block querier
+            // Blocks are served from an LRU cache keyed by height, and concurrent requests
+            // for the same height share a single HTTP call.
             FuturePtr<cosmos::Block> getBlock(uint64_t &blockHeight) const override;
 
+            /// Seed the block cache with blocks already known (e.g. read from the database)
+            void warmUpBlockCache(const std::vector<cosmos::Block> &blocks);
+
+            /// Maximum number of blocks kept in the block cache
+            static constexpr size_t BLOCK_CACHE_CAPACITY = 2000;
+
             // Account querier
             FuturePtr<ledger::core::cosmos::Account> getAccount(const std::string &account) const override;
 
@@ -192,6 +203,12 @@ namespace ledger {
           private:
             std::shared_ptr<HttpClient> _http;
             api::CosmosLikeNetworkParameters _parameters;
+
+            // Block data never changes once a height is committed, so it can be cached
+            // for the whole lifetime of the explorer (which is shared by the wallets of a pool).
+            mutable LRUCache<uint64_t, cosmos::Block> _blockCache;
+            mutable std::unordered_map<uint64_t, FuturePtr<cosmos::Block>> _pendingBlocks;
+            mutable std::mutex _pendingBlocksLock;
         };
 
     } // namespace core
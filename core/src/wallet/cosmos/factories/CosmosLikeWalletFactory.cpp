@@ -34,6 +34,7 @@
 #include <api/KeychainEngines.hpp>
 #include <api/SynchronizationEngines.hpp>
 #include <database/migrations.hpp>
+#include <wallet/common/database/BlockDatabaseHelper.h>
 #include <wallet/cosmos/CosmosLikeWallet.hpp>
 #include <wallet/cosmos/CosmosNetworks.hpp>
 #include <wallet/cosmos/explorers/GaiaCosmosLikeBlockchainExplorer.hpp>
@@ -152,8 +153,16 @@ namespace ledger {
                     api::BlockchainExplorerEngines::COSMOS_NODE);
                 auto &networkParams = getCurrency().cosmosLikeNetworkParameters.value();
 
-                explorer            = std::make_shared<GaiaCosmosLikeBlockchainExplorer>(
+                auto gaiaExplorer   = std::make_shared<GaiaCosmosLikeBlockchainExplorer>(
                     context, http, networkParams, std::dynamic_pointer_cast<DynamicObject>(configuration));
+                // Pre-warm the block cache with the most recent blocks already stored by
+                // the pool, they are the ones most likely to be requested by the next syncs
+                {
+                    soci::session sql(pool->getDatabaseSessionPool()->getReadonlyPool());
+                    gaiaExplorer->warmUpBlockCache(BlockDatabaseHelper::getLastBlocks(
+                        sql, currencyName, GaiaCosmosLikeBlockchainExplorer::BLOCK_CACHE_CAPACITY));
+                }
+                explorer = gaiaExplorer;
             } else {
                 throw Exception(
                     api::ErrorCode::IMPLEMENTATION_IS_MISSING,
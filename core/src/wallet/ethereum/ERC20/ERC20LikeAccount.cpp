@@ -47,6 +47,7 @@
 #include <utils/hex.h>
 #include <wallet/common/BalanceHistory.hpp>
 #include <wallet/common/OperationQuery.h>
+#include <wallet/ethereum/database/ERC20BalanceDatabaseHelper.h>
 #include <wallet/ethereum/database/EthereumLikeOperationDatabaseHelper.hpp>
 #include <wallet/pool/WalletPool.hpp>
 
@@ -78,11 +79,12 @@ namespace ledger {
         }
 
         FuturePtr<api::BigInt> ERC20LikeAccount::getBalance() {
-            auto parentAccount = _account.lock();
-            if (!parentAccount) {
-                throw make_exception(api::ErrorCode::NULL_POINTER, "Could not lock parent account.");
-            }
-            return parentAccount->getERC20Balance(_token.contractAddress);
+            auto parent            = acquireParent();
+            std::string accountUid = _accountUid;
+            return FuturePtr<api::BigInt>::async(parent->getContext(), [=]() -> std::shared_ptr<api::BigInt> {
+                soci::session sql(parent->getWallet()->getDatabase()->getReadonlyPool());
+                return std::make_shared<api::BigIntImpl>(ERC20BalanceDatabaseHelper::getBalance(sql, accountUid));
+            });
         }
 
         void ERC20LikeAccount::getBalance(const std::shared_ptr<api::BigIntCallback> &callback) {
@@ -93,41 +95,30 @@ namespace ledger {
             const std::chrono::system_clock::time_point &startDate,
             const std::chrono::system_clock::time_point &endDate,
             api::TimePeriod precision) {
-            auto operations = getOperations();
-            // manually sort by date
-            std::sort(
-                operations.begin(),
-                operations.end(),
-                [](
-                    const std::shared_ptr<api::ERC20LikeOperation> &a,
-                    const std::shared_ptr<api::ERC20LikeOperation> &b) {
-                    return a->getTime() < b->getTime();
-                });
+            auto parent = acquireParent();
+            soci::session sql(parent->getWallet()->getDatabase()->getReadonlyPool());
+
+            // Start from the latest checkpoint before the window and only scan the operations after it
+            BalanceCheckpoint checkpoint;
+            auto latest = ERC20BalanceDatabaseHelper::getLatestCheckpoint(sql, _accountUid, startDate);
+            if (latest.nonEmpty()) {
+                checkpoint = latest.getValue();
+            }
+            std::vector<ERC20BalanceChange> changes;
+            ERC20BalanceDatabaseHelper::queryBalanceChangesBetween(sql, _accountUid, checkpoint.date, endDate, changes);
 
             // a small type used to pick implementations used by agnostic::getBalanceHistoryFor.
             struct OperationStrategy {
-                static inline std::chrono::system_clock::time_point date(std::shared_ptr<api::ERC20LikeOperation> &op) {
-                    return op->getTime();
+                static inline std::chrono::system_clock::time_point date(const ERC20BalanceChange &change) {
+                    return change.date;
                 }
 
                 static inline std::shared_ptr<api::BigInt> value_constructor(const BigInt &v) {
                     return std::make_shared<api::BigIntImpl>(v);
                 }
 
-                static inline void update_balance(std::shared_ptr<api::ERC20LikeOperation> &op, BigInt &sum) {
-                    auto value = BigInt(op->getValue()->toString(DECIMAL_NUM_BASE));
-
-                    switch (op->getOperationType()) {
-                    case api::OperationType::RECEIVE:
-                        sum = sum + value;
-                        break;
-
-                    case api::OperationType::SEND:
-                        sum = sum - value;
-                        break;
-                    default:
-                        break;
-                    }
+                static inline void update_balance(const ERC20BalanceChange &change, BigInt &sum) {
+                    ERC20BalanceDatabaseHelper::updateBalance(sum, change.type, change.value);
                 }
             };
 
@@ -135,26 +126,20 @@ namespace ledger {
                 startDate,
                 endDate,
                 precision,
-                operations.cbegin(),
-                operations.cend(),
-                BigInt());
+                changes.cbegin(),
+                changes.cend(),
+                checkpoint.balance);
         }
 
         BigInt ERC20LikeAccount::accumulateBalanceWithOperation(
             const BigInt &balance,
             api::ERC20LikeOperation &op) {
-            auto ty    = op.getOperationType();
-            auto value = BigInt(op.getValue()->toString(DECIMAL_NUM_BASE));
-
-            switch (ty) {
-            case api::OperationType::RECEIVE:
-                return balance + value;
-
-            case api::OperationType::SEND:
-                return balance - value;
-            default:
-                return balance;
-            }
+            auto result = balance;
+            auto value  = std::dynamic_pointer_cast<api::BigIntImpl>(op.getValue());
+            ERC20BalanceDatabaseHelper::updateBalance(result,
+                                                      op.getOperationType(),
+                                                      value ? value->backend() : BigInt(op.getValue()->toString(DECIMAL_NUM_BASE)));
+            return result;
         }
 
         static inline void inflateERC20Operation(soci::row &row, std::shared_ptr<ERC20LikeOperation> &op) {
@@ -41,6 +41,7 @@
 #include <math/Base58.hpp>
 #include <utils/DateUtils.hpp>
 #include <utils/Option.hpp>
+#include <wallet/common/database/BalanceCheckpointDatabaseHelper.h>
 #include <wallet/common/database/BlockDatabaseHelper.h>
 #include <wallet/common/database/BulkInsertDatabaseHelper.hpp>
 #include <wallet/common/database/OperationDatabaseHelper.h>
@@ -49,6 +50,7 @@
 #include <wallet/ethereum/ERC20/erc20Tokens.h>
 #include <wallet/ethereum/api_impl/EthereumLikeTransactionApi.h>
 #include <wallet/ethereum/api_impl/InternalTransaction.h>
+#include <wallet/ethereum/database/ERC20BalanceDatabaseHelper.h>
 #include <wallet/ethereum/database/EthereumLikeAccountDatabaseHelper.h>
 #include <wallet/ethereum/database/EthereumLikeOperationDatabaseHelper.hpp>
 #include <wallet/ethereum/database/EthereumLikeTransactionDatabaseHelper.h>
@@ -160,7 +162,9 @@ namespace ledger {
             return Try<int>::from([&]() {
                 soci::session sql(getWallet()->getDatabase()->getPool());
                 soci::transaction tr(sql);
+                BalanceCheckpointDatabaseHelper::invalidateCheckpoints(sql, operations);
                 EthereumLikeOperationDatabaseHelper::bulkInsert(sql, operations, accountAddress);
+                updateBalanceCheckpoints(sql, operations);
                 tr.commit();
                 // Emit
                 emitNewOperationsEvent(operations);
@@ -236,16 +240,58 @@ namespace ledger {
             }
         }
 
-        std::vector<Operation> EthereumLikeAccount::getInternalOperations(soci::session &sql) {
+        void EthereumLikeAccount::queryBalanceChanges(soci::session &sql,
+                                                      const std::chrono::system_clock::time_point &after,
+                                                      std::vector<OperationBalanceChange> &out) {
+            queryBalanceChanges(sql, after, Option<std::chrono::system_clock::time_point>(), out);
+        }
+
+        void EthereumLikeAccount::queryBalanceChanges(soci::session &sql,
+                                                      const std::chrono::system_clock::time_point &after,
+                                                      const Option<std::chrono::system_clock::time_point> &before,
+                                                      std::vector<OperationBalanceChange> &out) {
+            OperationDatabaseHelper::queryBalanceChanges(sql, getAccountUid(), after, before, out);
+
+            // Internal operations move funds too, fold them in order with the operations
+            for (const auto &operation : getInternalOperations(sql, after, before)) {
+                out.push_back(OperationBalanceChange{
+                    operation.date,
+                    operation.type,
+                    UInt256::fromBigInt(operation.amount),
+                    UInt256::fromBigInt(operation.fees.getValueOr(BigInt::ZERO))});
+            }
+            std::stable_sort(out.begin(), out.end(), [](OperationBalanceChange const &a, OperationBalanceChange const &b) {
+                return a.date < b.date;
+            });
+        }
+
+        void EthereumLikeAccount::updateBalanceCheckpoints(soci::session &sql, const std::vector<Operation> &operations) {
+            const auto &uid  = getAccountUid();
+            auto latest      = BalanceCheckpointDatabaseHelper::getLatestCheckpoint(sql, uid).getValueOr(BalanceCheckpoint());
+            auto pendingDate = BalanceCheckpointDatabaseHelper::getEarliestPendingDate(sql, uid);
+            if (!BalanceCheckpointDatabaseHelper::hasFoldableOperations(latest, pendingDate, operations)) {
+                return;
+            }
+            std::vector<OperationBalanceChange> changes;
+            queryBalanceChanges(sql, latest.date, pendingDate, changes);
+            BalanceCheckpointDatabaseHelper::updateCheckpoints(sql, uid, latest, pendingDate, changes);
+        }
+
+        std::vector<Operation> EthereumLikeAccount::getInternalOperations(soci::session &sql,
+                                                                          const std::chrono::system_clock::time_point &after,
+                                                                          const Option<std::chrono::system_clock::time_point> &before) {
             auto addr                    = _keychain->getAddress()->toString();
+            int bounded                  = before.nonEmpty() ? 1 : 0;
+            auto beforeDate              = before.getValueOr(after);
 
             soci::rowset<soci::row> rows = (sql.prepare << "SELECT io.type, io.value, io.sender, io.receiver, io.gas_limit, io.gas_used, et.gas_price, op.date, et.status "
                                                            "FROM internal_operations as io "
                                                            "JOIN operations as op on io.ethereum_operation_uid = op.uid "
                                                            "JOIN ethereum_operations as eo on eo.uid = op.uid "
                                                            "JOIN ethereum_transactions as et on eo.transaction_uid = et.transaction_uid "
-                                                           "WHERE io.receiver = :addr OR io.sender = :addr",
-                                            soci::use(addr, "addr"));
+                                                           "WHERE (io.receiver = :addr OR io.sender = :addr) AND op.date > :date "
+                                                           "AND (:bounded = 0 OR op.date < :before)",
+                                            soci::use(addr, "addr"), soci::use(after, "date"), soci::use(bounded, "bounded"), soci::use(beforeDate, "before"));
 
             std::vector<Operation> operations;
 
@@ -357,31 +403,29 @@ namespace ledger {
 
                 const auto &uid = self->getAccountUid();
                 soci::session sql(self->getWallet()->getDatabase()->getReadonlyPool());
-                std::vector<Operation> operations;
-
-                // Get operations related to an account
-                OperationDatabaseHelper::queryOperations(sql, uid, operations);
-
-                // Get internal operations, add them to the list of operations and deallocate
-                // them to free memory
-                {
-                    auto internalOperations = getInternalOperations(sql);
-
-                    // add the internal operations to the list of operations
-                    operations.insert(operations.end(), internalOperations.begin(), internalOperations.end());
+                std::vector<OperationBalanceChange> operations;
+                Int256 sum;
+
+                // Get operations related to an account, starting after the latest balance checkpoint
+                // settled at the start date if there is one
+                auto checkpoint = BalanceCheckpointDatabaseHelper::getLatestCheckpoint(sql, uid, startDate);
+                auto after      = std::chrono::system_clock::time_point();
+                if (checkpoint.nonEmpty()) {
+                    sum   = Int256::fromBigInt(checkpoint->balance);
+                    after = checkpoint->date;
                 }
+                self->queryBalanceChanges(sql, after, operations);
 
-                // sort operations
-                std::sort(operations.begin(), operations.end(), [](Operation const &a, Operation const &b) {
-                    return a.date < b.date;
-                });
+                std::size_t operationsCount = 0;
+                while (operationsCount < operations.size() && operations[operationsCount].date <= startDate) {
+                    BalanceCheckpointDatabaseHelper::updateBalance(sum, operations[operationsCount]);
+                    operationsCount += 1;
+                }
 
                 auto lowerDate = startDate;
                 auto upperDate = DateUtils::incrementDate(startDate, precision);
 
                 std::vector<std::shared_ptr<api::Amount>> amounts;
-                std::size_t operationsCount = 0;
-                BigInt sum;
                 while (lowerDate <= endDate && operationsCount < operations.size()) {
                     auto operation = operations[operationsCount];
 
@@ -389,24 +433,11 @@ namespace ledger {
                         lowerDate = DateUtils::incrementDate(lowerDate, precision);
                         upperDate = DateUtils::incrementDate(upperDate, precision);
                         amounts.emplace_back(
-                            std::make_shared<ledger::core::Amount>(self->getWallet()->getCurrency(), 0, sum));
+                            std::make_shared<ledger::core::Amount>(self->getWallet()->getCurrency(), 0, sum.toBigInt()));
                     }
 
                     if (operation.date <= upperDate) {
-                        switch (operation.type) {
-                        case api::OperationType::RECEIVE: {
-                            sum = sum + operation.amount;
-                            break;
-                        }
-
-                        case api::OperationType::SEND: {
-                            sum = sum - (operation.amount + operation.fees.getValueOr(BigInt::ZERO));
-                            break;
-                        }
-
-                        default:
-                            break;
-                        }
+                        BalanceCheckpointDatabaseHelper::updateBalance(sum, operation);
                     }
 
                     operationsCount += 1;
@@ -416,7 +447,7 @@ namespace ledger {
                     lowerDate = DateUtils::incrementDate(lowerDate, precision);
 
                     amounts.emplace_back(
-                        std::make_shared<ledger::core::Amount>(self->getWallet()->getCurrency(), 0, sum));
+                        std::make_shared<ledger::core::Amount>(self->getWallet()->getCurrency(), 0, sum.toBigInt()));
                 }
 
                 return amounts;
@@ -634,6 +665,27 @@ namespace ledger {
             getERC20Balances(erc20Addresses).callback(getMainExecutionContext(), callback);
         }
 
+        Future<std::unordered_map<std::string, BigInt>> EthereumLikeAccount::getAllERC20Balances() {
+            auto self = std::dynamic_pointer_cast<EthereumLikeAccount>(shared_from_this());
+            return async<std::unordered_map<std::string, BigInt>>([self]() {
+                soci::session sql(self->getWallet()->getDatabase()->getReadonlyPool());
+                return ERC20BalanceDatabaseHelper::getBalances(sql, self->getAccountUid());
+            });
+        }
+
+        void EthereumLikeAccount::getAllERC20Balances(const std::shared_ptr<api::ERC20BalanceListCallback> &callback) {
+            getAllERC20Balances()
+                .map<std::vector<api::ERC20Balance>>(getContext(), [](const std::unordered_map<std::string, BigInt> &balances) {
+                    std::vector<api::ERC20Balance> result;
+                    result.reserve(balances.size());
+                    for (const auto &balance : balances) {
+                        result.emplace_back(balance.first, balance.second.toString());
+                    }
+                    return result;
+                })
+                .callback(getMainExecutionContext(), callback);
+        }
+
         void EthereumLikeAccount::addERC20Accounts(soci::session &sql,
                                                    const std::vector<ERC20LikeAccountDatabaseEntry> &erc20Entries) {
             auto self = std::dynamic_pointer_cast<EthereumLikeAccount>(shared_from_this());
@@ -35,13 +35,17 @@
 #include <api/AddressListCallback.hpp>
 #include <api/BigIntCallback.hpp>
 #include <api/BigIntListCallback.hpp>
+#include <api/ERC20Balance.hpp>
+#include <api/ERC20BalanceListCallback.hpp>
 #include <api/EthereumLikeAccount.hpp>
 #include <api/EthereumLikeTransactionBuilder.hpp>
 #include <api/Event.hpp>
 #include <api/StringCallback.hpp>
+#include <unordered_map>
 #include <wallet/common/AbstractAccount.hpp>
 #include <wallet/common/AbstractWallet.hpp>
 #include <wallet/common/Amount.h>
+#include <wallet/common/database/OperationDatabaseHelper.h>
 #include <wallet/ethereum/ERC20/ERC20LikeAccount.h>
 #include <wallet/ethereum/api_impl/InternalTransaction.h>
 #include <wallet/ethereum/database/EthereumLikeAccountDatabaseEntry.h>
@@ -67,7 +71,18 @@ namespace ledger {
             void interpretTransaction(const EthereumLikeBlockchainExplorerTransaction &transaction, std::vector<Operation> &out);
             Try<int> bulkInsert(const std::vector<Operation> &operations);
             /// Get internal transactions related to the parent operation.
-            std::vector<Operation> getInternalOperations(soci::session &sql);
+            // Internal operations of the account dated strictly after a given date, and strictly before another one when given
+            std::vector<Operation> getInternalOperations(soci::session &sql,
+                                                         const std::chrono::system_clock::time_point &after = std::chrono::system_clock::time_point(),
+                                                         const Option<std::chrono::system_clock::time_point> &before = Option<std::chrono::system_clock::time_point>());
+            // Balance changes of the account operations and internal operations dated strictly after a given date, ordered by date
+            void queryBalanceChanges(soci::session &sql,
+                                     const std::chrono::system_clock::time_point &after,
+                                     std::vector<OperationBalanceChange> &out);
+            void queryBalanceChanges(soci::session &sql,
+                                     const std::chrono::system_clock::time_point &after,
+                                     const Option<std::chrono::system_clock::time_point> &before,
+                                     std::vector<OperationBalanceChange> &out);
 
             void updateERC20Accounts(Operation &operation);
             void updateERC20Operation(Operation &operation,
@@ -115,6 +130,9 @@ namespace ledger {
             void getERC20Balance(const std::string &erc20Address, const std::shared_ptr<api::BigIntCallback> &callback) override;
             Future<std::vector<std::shared_ptr<api::BigInt>>> getERC20Balances(const std::vector<std::string> &erc20Addresses);
             void getERC20Balances(const std::vector<std::string> &erc20Addresses, const std::shared_ptr<api::BigIntListCallback> &callback) override;
+            // Balances of every synchronized ERC20 account by contract address, read from the database
+            Future<std::unordered_map<std::string, BigInt>> getAllERC20Balances();
+            void getAllERC20Balances(const std::shared_ptr<api::ERC20BalanceListCallback> &callback) override;
 
             void addERC20Accounts(soci::session &sql,
                                   const std::vector<ERC20LikeAccountDatabaseEntry> &erc20Entries);
@@ -129,6 +147,8 @@ namespace ledger {
 
           private:
             std::shared_ptr<EthereumLikeAccount> getSelf();
+            // Save the balance checkpoints of the operations inserted since the latest one
+            void updateBalanceCheckpoints(soci::session &sql, const std::vector<Operation> &operations);
             std::shared_ptr<EthereumLikeKeychain> _keychain;
             std::string _accountAddress;
             std::shared_ptr<Preferences> _internalPreferences;
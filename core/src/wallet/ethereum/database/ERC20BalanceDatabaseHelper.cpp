@@ -0,0 +1,194 @@
+/*
+ *
+ * ERC20BalanceDatabaseHelper
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#include "ERC20BalanceDatabaseHelper.h"
+
+#include <api/enum_from_string.hpp>
+#include <database/soci-date.h>
+
+using namespace soci;
+
+namespace ledger {
+    namespace core {
+
+        // Balance of the selected ERC20 accounts by contract address: the latest checkpoint of each
+        // account is joined with the operations dated after it
+        static std::unordered_map<std::string, BigInt> queryBalances(soci::session &sql,
+                                                                     const std::string &column,
+                                                                     const std::string &uid) {
+            rowset<row> rows = (sql.prepare << "SELECT a.contract_address, cp.balance, op.type, op.value "
+                                               "FROM erc20_accounts AS a "
+                                               "LEFT JOIN erc20_balance_checkpoints AS cp ON cp.account_uid = a.uid "
+                                               "AND cp.date = (SELECT MAX(date) FROM erc20_balance_checkpoints WHERE account_uid = a.uid) "
+                                               "LEFT JOIN erc20_operations AS op ON op.account_uid = a.uid "
+                                               "AND NOT (op.status = 0 AND COALESCE(op.block_height, 0) > 0) "
+                                               "AND (cp.date IS NULL OR op.date > cp.date) "
+                                               "WHERE a."
+                                            << column << " = :uid",
+                                use(uid));
+            std::unordered_map<std::string, BigInt> balances;
+            for (auto &row : rows) {
+                auto it = balances.find(row.get<std::string>(0));
+                if (it == balances.end()) {
+                    const auto checkpoint = row.get_indicator(1) != i_null ? BigInt::fromHex(row.get<std::string>(1)) : BigInt::ZERO;
+                    it                    = balances.emplace(row.get<std::string>(0), checkpoint).first;
+                }
+                if (row.get_indicator(2) != i_null) {
+                    ERC20BalanceDatabaseHelper::updateBalance(it->second,
+                                                              api::from_string<api::OperationType>(row.get<std::string>(2)),
+                                                              BigInt::fromHex(row.get<std::string>(3)));
+                }
+            }
+            return balances;
+        }
+
+        Option<BalanceCheckpoint> ERC20BalanceDatabaseHelper::getLatestCheckpoint(soci::session &sql,
+                                                                                  const std::string &erc20AccountUid,
+                                                                                  const std::chrono::system_clock::time_point &date) {
+            rowset<row> rows = (sql.prepare << "SELECT date, balance FROM erc20_balance_checkpoints "
+                                               "WHERE account_uid = :uid AND date <= :date "
+                                               "ORDER BY date DESC LIMIT 1",
+                                use(erc20AccountUid), use(date));
+            for (auto &row : rows) {
+                BalanceCheckpoint checkpoint;
+                checkpoint.date    = row.get<std::chrono::system_clock::time_point>(0);
+                checkpoint.balance = BigInt::fromHex(row.get<std::string>(1));
+                return Option<BalanceCheckpoint>(checkpoint);
+            }
+            return Option<BalanceCheckpoint>();
+        }
+
+        static std::size_t inflateBalanceChanges(soci::rowset<soci::row> &rows, std::vector<ERC20BalanceChange> &out) {
+            std::size_t count = 0;
+            for (auto &row : rows) {
+                ERC20BalanceChange change;
+                change.date  = row.get<std::chrono::system_clock::time_point>(0);
+                change.type  = api::from_string<api::OperationType>(row.get<std::string>(1));
+                change.value = BigInt::fromHex(row.get<std::string>(2));
+                out.push_back(change);
+                count += 1;
+            }
+            return count;
+        }
+
+        std::size_t ERC20BalanceDatabaseHelper::queryBalanceChangesAfter(soci::session &sql,
+                                                                         const std::string &erc20AccountUid,
+                                                                         const std::chrono::system_clock::time_point &after,
+                                                                         std::vector<ERC20BalanceChange> &out) {
+            rowset<row> rows = (sql.prepare << "SELECT date, type, value FROM erc20_operations "
+                                               "WHERE account_uid = :uid AND date > :date "
+                                               "AND NOT (status = 0 AND COALESCE(block_height, 0) > 0) "
+                                               "ORDER BY date",
+                                use(erc20AccountUid), use(after));
+            return inflateBalanceChanges(rows, out);
+        }
+
+        std::size_t ERC20BalanceDatabaseHelper::queryBalanceChangesBetween(soci::session &sql,
+                                                                           const std::string &erc20AccountUid,
+                                                                           const std::chrono::system_clock::time_point &after,
+                                                                           const std::chrono::system_clock::time_point &until,
+                                                                           std::vector<ERC20BalanceChange> &out) {
+            rowset<row> rows = (sql.prepare << "SELECT date, type, value FROM erc20_operations "
+                                               "WHERE account_uid = :uid AND date > :after AND date <= :until "
+                                               "AND NOT (status = 0 AND COALESCE(block_height, 0) > 0) "
+                                               "ORDER BY date",
+                                use(erc20AccountUid), use(after), use(until));
+            return inflateBalanceChanges(rows, out);
+        }
+
+        void ERC20BalanceDatabaseHelper::updateCheckpoints(soci::session &sql, const std::vector<std::string> &erc20AccountUids) {
+            for (const auto &uid : erc20AccountUids) {
+                BalanceCheckpoint checkpoint;
+                std::vector<ERC20BalanceChange> changes;
+                rowset<row> rows = (sql.prepare << "SELECT date, balance FROM erc20_balance_checkpoints "
+                                                   "WHERE account_uid = :uid ORDER BY date DESC LIMIT 1",
+                                    use(uid));
+                for (auto &row : rows) {
+                    checkpoint.date    = row.get<std::chrono::system_clock::time_point>(0);
+                    checkpoint.balance = BigInt::fromHex(row.get<std::string>(1));
+                }
+                queryBalanceChangesAfter(sql, uid, checkpoint.date, changes);
+
+                // Pending operations may still fail or be dropped, they are never covered
+                Option<std::chrono::system_clock::time_point> earliestPendingDate;
+                rowset<row> pendingRows = (sql.prepare << "SELECT date FROM erc20_operations "
+                                                          "WHERE account_uid = :uid AND COALESCE(block_height, 0) = 0 "
+                                                          "ORDER BY date LIMIT 1",
+                                           use(uid));
+                for (auto &row : pendingRows) {
+                    earliestPendingDate = row.get<std::chrono::system_clock::time_point>(0);
+                }
+
+                // Checkpoints are cut between operations of different dates, as they cover every
+                // operation dated before or at their date
+                std::size_t folded = 0;
+                for (std::size_t index = 0; index < changes.size(); index++) {
+                    if (earliestPendingDate.nonEmpty() && changes[index].date >= earliestPendingDate.getValue()) {
+                        break;
+                    }
+                    updateBalance(checkpoint.balance, changes[index].type, changes[index].value);
+                    folded += 1;
+                    const bool settled = index + 1 == changes.size() || changes[index + 1].date > changes[index].date;
+                    if (folded < BalanceCheckpointDatabaseHelper::MIN_OPERATIONS_PER_CHECKPOINT || !settled) {
+                        continue;
+                    }
+                    checkpoint.date = changes[index].date;
+                    auto balance    = checkpoint.balance.toHexString();
+                    sql << "INSERT INTO erc20_balance_checkpoints VALUES(:uid, :date, :balance) "
+                           "ON CONFLICT(account_uid, date) DO UPDATE SET balance = :balance",
+                        use(uid, "uid"), use(checkpoint.date, "date"), use(balance, "balance");
+                    folded = 0;
+                }
+            }
+        }
+
+        BigInt ERC20BalanceDatabaseHelper::getBalance(soci::session &sql, const std::string &erc20AccountUid) {
+            auto balances = queryBalances(sql, "uid", erc20AccountUid);
+            return balances.empty() ? BigInt::ZERO : balances.begin()->second;
+        }
+
+        std::unordered_map<std::string, BigInt> ERC20BalanceDatabaseHelper::getBalances(soci::session &sql, const std::string &ethereumAccountUid) {
+            return queryBalances(sql, "ethereum_account_uid", ethereumAccountUid);
+        }
+
+        void ERC20BalanceDatabaseHelper::updateBalance(BigInt &balance, api::OperationType type, const BigInt &value) {
+            switch (type) {
+            case api::OperationType::RECEIVE:
+                balance = balance + value;
+                break;
+            case api::OperationType::SEND:
+                balance = balance - value;
+                break;
+            default:
+                break;
+            }
+        }
+    } // namespace core
+} // namespace ledger
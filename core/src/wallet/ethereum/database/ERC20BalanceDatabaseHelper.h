@@ -0,0 +1,94 @@
+/*
+ *
+ * ERC20BalanceDatabaseHelper
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#ifndef LEDGER_CORE_ERC20BALANCEDATABASEHELPER_H
+#define LEDGER_CORE_ERC20BALANCEDATABASEHELPER_H
+
+#include <api/OperationType.hpp>
+#include <chrono>
+#include <math/BigInt.h>
+#include <soci.h>
+#include <string>
+#include <unordered_map>
+#include <utils/Option.hpp>
+#include <vector>
+#include <wallet/common/database/BalanceCheckpointDatabaseHelper.h>
+
+namespace ledger {
+    namespace core {
+        struct ERC20BalanceChange {
+            std::chrono::system_clock::time_point date;
+            api::OperationType type;
+            BigInt value;
+        };
+
+        /**
+         * Running balances of ERC20 accounts. Checkpoints are saved at insertion time every time enough
+         * operations were folded since the previous one, so balances and balance histories only
+         * scan the operations dated after the latest checkpoint. They are invalidated along with the
+         * checkpoints of their parent Ethereum account (see BalanceCheckpointDatabaseHelper).
+         * Operations mined with a failed status do not move tokens and are left out of the balances.
+         * Pending operations, stored without block height (0), are counted as if they succeed so an
+         * outgoing transfer is reflected right away; checkpoints never cover them, as they may still
+         * fail or be dropped from the mempool.
+         */
+        class ERC20BalanceDatabaseHelper {
+          public:
+            static Option<BalanceCheckpoint> getLatestCheckpoint(soci::session &sql,
+                                                                 const std::string &erc20AccountUid,
+                                                                 const std::chrono::system_clock::time_point &date);
+
+            // Balance changes of an ERC20 account dated strictly after a given date, ordered by date
+            static std::size_t queryBalanceChangesAfter(soci::session &sql,
+                                                        const std::string &erc20AccountUid,
+                                                        const std::chrono::system_clock::time_point &after,
+                                                        std::vector<ERC20BalanceChange> &out);
+
+            // Balance changes of an ERC20 account dated after a given date and up to another one, ordered by date
+            static std::size_t queryBalanceChangesBetween(soci::session &sql,
+                                                          const std::string &erc20AccountUid,
+                                                          const std::chrono::system_clock::time_point &after,
+                                                          const std::chrono::system_clock::time_point &until,
+                                                          std::vector<ERC20BalanceChange> &out);
+
+            // Save new checkpoints for the ERC20 accounts with enough operations since their latest one
+            static void updateCheckpoints(soci::session &sql, const std::vector<std::string> &erc20AccountUids);
+
+            static BigInt getBalance(soci::session &sql, const std::string &erc20AccountUid);
+
+            // Balances of every ERC20 account of an Ethereum account by contract address, read in a single query
+            static std::unordered_map<std::string, BigInt> getBalances(soci::session &sql, const std::string &ethereumAccountUid);
+
+            static void updateBalance(BigInt &balance, api::OperationType type, const BigInt &value);
+        };
+    } // namespace core
+} // namespace ledger
+
+#endif // LEDGER_CORE_ERC20BALANCEDATABASEHELPER_H
@@ -40,6 +40,7 @@
 #include <debug/Benchmarker.h>
 #include <unordered_set>
 #include <wallet/common/database/BulkInsertDatabaseHelper.hpp>
+#include <wallet/ethereum/database/ERC20BalanceDatabaseHelper.h>
 #include <wallet/ethereum/database/EthereumLikeTransactionDatabaseHelper.h>
 
 using namespace soci;
@@ -215,7 +216,7 @@ namespace {
         ":uid, :eth_op_uid, :account_uid, :op_type, :hash, :nonce, :value, :date, :sender,"
         ":receiver, :data, :gas_price, :gas_limit, :gas_used, :status, :block_height"
         ") ON CONFLICT(uid) DO UPDATE SET "
-        " status = :status, gas_used = :gas_used",
+        " status = :status, gas_used = :gas_used, block_height = :block_height",
         [](auto &s, auto &b) {
             s,
                 use(b.ercOpUid, "uid"),
@@ -374,8 +375,13 @@ namespace ledger {
             if (!internalOpStmt.bindings.opUid.empty())
                 internalOpStmt.execute();
             // ERC20 operation
-            if (!erc20OpStmt.bindings.hash.empty())
+            if (!erc20OpStmt.bindings.hash.empty()) {
                 erc20OpStmt.execute();
+                // ERC20 balance checkpoints
+                std::unordered_set<std::string> erc20AccountUids(erc20OpStmt.bindings.accountUid.begin(),
+                                                                 erc20OpStmt.bindings.accountUid.end());
+                ERC20BalanceDatabaseHelper::updateCheckpoints(sql, std::vector<std::string>(erc20AccountUids.begin(), erc20AccountUids.end()));
+            }
         }
 
     } // namespace core
@@ -30,6 +30,7 @@
 
 #include "LedgerApiEthereumLikeBlockchainExplorer.h"
 
+#include <api/ConfigurationDefaults.hpp>
 #include <api_impl/BigIntImpl.hpp>
 namespace ledger {
     namespace core {
@@ -41,6 +42,8 @@ namespace ledger {
             _http            = http;
             _parameters      = parameters;
             _explorerVersion = configuration->getString(api::Configuration::BLOCKCHAIN_EXPLORER_VERSION).value_or("v3");
+            _paging.setMaxStreams(configuration->getInt(api::Configuration::BLOCKCHAIN_EXPLORER_MAX_PARALLEL_REQUESTS)
+                                      .value_or(api::ConfigurationDefaults::DEFAULT_BLOCKCHAIN_EXPLORER_MAX_PARALLEL_REQUESTS));
         }
 
         Future<std::shared_ptr<BigInt>> LedgerApiEthereumLikeBlockchainExplorer::getNonce(const std::string &address) {
@@ -324,6 +327,10 @@ namespace ledger {
             return getLedgerApiTransactions(addresses, fromBlockHash, session, isSnakeCase);
         }
 
+        std::vector<std::string> LedgerApiEthereumLikeBlockchainExplorer::getTransactionAddresses(const EthereumLikeBlockchainExplorerTransaction &transaction) const {
+            return {transaction.sender, transaction.receiver};
+        }
+
         FuturePtr<Block> LedgerApiEthereumLikeBlockchainExplorer::getCurrentBlock() const {
             return getLedgerApiCurrentBlock();
         }
@@ -82,6 +82,9 @@ namespace ledger {
             api::EthereumLikeNetworkParameters getNetworkParameters() const override;
             std::string getExplorerVersion() const override;
 
+          protected:
+            std::vector<std::string> getTransactionAddresses(const EthereumLikeBlockchainExplorerTransaction &transaction) const override;
+
           private:
             Future<std::shared_ptr<BigInt>> getHelper(const std::string &url,
                                                       const std::string &field);
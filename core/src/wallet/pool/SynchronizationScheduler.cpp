@@ -0,0 +1,225 @@
+/*
+ *
+ * SynchronizationScheduler.cpp
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#include "SynchronizationScheduler.hpp"
+
+#include <api/Account.hpp>
+#include <api/Configuration.hpp>
+#include <api/ExecutionContext.hpp>
+#include <collections/DynamicObject.hpp>
+#include <events/Event.hpp>
+#include <events/LambdaEventReceiver.hpp>
+#include <fmt/format.h>
+#include <utils/LambdaRunnable.hpp>
+#include <wallet/common/AbstractAccount.hpp>
+#include <wallet/common/AbstractWallet.hpp>
+
+namespace ledger {
+    namespace core {
+        SynchronizationScheduler::SynchronizationScheduler(const std::shared_ptr<api::ExecutionContext> &context,
+                                                           int32_t maxConcurrentSynchronizations,
+                                                           int32_t maxConcurrentSynchronizationsPerExplorer,
+                                                           const SaturationProbe &isSaturated) : DedicatedContext(context),
+                                                                                                 _maxConcurrentSynchronizations(std::max(maxConcurrentSynchronizations, 1)),
+                                                                                                 _maxConcurrentSynchronizationsPerExplorer(std::max(maxConcurrentSynchronizationsPerExplorer, 1)),
+                                                                                                 _isSaturated(isSaturated),
+                                                                                                 _running(0),
+                                                                                                 _queued(0),
+                                                                                                 _retryScheduled(false) {
+        }
+
+        std::shared_ptr<ProgressNotifier<api::EventCode>> SynchronizationScheduler::schedule(const std::shared_ptr<AbstractAccount> &account,
+                                                                                             Priority priority) {
+            auto wallet   = account->getWallet();
+            auto endpoint = wallet->getConfig()->getString(api::Configuration::BLOCKCHAIN_EXPLORER_API_ENDPOINT).value_or("");
+            auto explorer = fmt::format("{}:{}", wallet->getCurrency().name, endpoint);
+            return schedule(
+                account->getAccountUid(), explorer, [account]() { return account->synchronize(); }, priority);
+        }
+
+        std::shared_ptr<ProgressNotifier<api::EventCode>> SynchronizationScheduler::schedule(const std::string &accountUid,
+                                                                                             const std::string &explorer,
+                                                                                             const SynchronizeFunction &synchronize,
+                                                                                             Priority priority) {
+            std::shared_ptr<Job> job;
+            {
+                std::lock_guard<std::mutex> lock(_lock);
+                auto it = _jobs.find(accountUid);
+                if (it != _jobs.end()) {
+                    job = it->second;
+                    // A queued background synchronization jumps ahead when the user is waiting for it
+                    if (job->state == Job::State::QUEUED && job->priority == Priority::BACKGROUND && priority == Priority::INTERACTIVE) {
+                        auto &queue = _queues[static_cast<int>(Priority::BACKGROUND)][job->explorer];
+                        queue.erase(std::find(queue.begin(), queue.end(), job));
+                        job->priority = Priority::INTERACTIVE;
+                        _queues[static_cast<int>(Priority::INTERACTIVE)][job->explorer].push_back(job);
+                    }
+                    return job->notifier;
+                }
+                job              = std::make_shared<Job>();
+                job->accountUid  = accountUid;
+                job->explorer    = explorer;
+                job->synchronize = synchronize;
+                job->priority    = priority;
+                job->state       = Job::State::QUEUED;
+                job->notifier    = std::make_shared<ProgressNotifier<api::EventCode>>();
+                _jobs[accountUid] = job;
+                _queues[static_cast<int>(priority)][explorer].push_back(job);
+                _queued += 1;
+            }
+            job->notifier->setProgress("queued", 0.0);
+            drain();
+            return job->notifier;
+        }
+
+        std::size_t SynchronizationScheduler::getRunningCount() const {
+            std::lock_guard<std::mutex> lock(_lock);
+            return static_cast<std::size_t>(_running);
+        }
+
+        std::size_t SynchronizationScheduler::getQueuedCount() const {
+            std::lock_guard<std::mutex> lock(_lock);
+            return _queued;
+        }
+
+        void SynchronizationScheduler::drain() {
+            std::vector<std::shared_ptr<Job>> started;
+            bool retry = false;
+            {
+                std::lock_guard<std::mutex> lock(_lock);
+                while (_running < _maxConcurrentSynchronizations && _queued > 0) {
+                    if (_isSaturated && _isSaturated()) {
+                        // Back-pressure: let running synchronizations release database sessions first
+                        retry           = !_retryScheduled;
+                        _retryScheduled = true;
+                        break;
+                    }
+                    auto job = pick();
+                    if (job == nullptr) {
+                        break;
+                    }
+                    _running += 1;
+                    _runningPerExplorer[job->explorer] += 1;
+                    started.push_back(job);
+                }
+            }
+            if (retry) {
+                std::weak_ptr<SynchronizationScheduler> weakSelf = shared_from_this();
+                getContext()->delay(make_runnable([weakSelf]() {
+                                        if (auto self = weakSelf.lock()) {
+                                            {
+                                                std::lock_guard<std::mutex> lock(self->_lock);
+                                                self->_retryScheduled = false;
+                                            }
+                                            self->drain();
+                                        }
+                                    }),
+                                    SATURATION_RETRY_DELAY_MS);
+            }
+            for (const auto &job : started) {
+                start(job);
+            }
+        }
+
+        std::shared_ptr<SynchronizationScheduler::Job> SynchronizationScheduler::pick() {
+            for (auto &queues : _queues) {
+                for (auto &queue : queues) {
+                    if (queue.second.empty() || _runningPerExplorer[queue.first] >= _maxConcurrentSynchronizationsPerExplorer) {
+                        continue;
+                    }
+                    auto job = queue.second.front();
+                    queue.second.pop_front();
+                    job->state = Job::State::STARTED;
+                    _queued -= 1;
+                    return job;
+                }
+            }
+            return nullptr;
+        }
+
+        void SynchronizationScheduler::start(const std::shared_ptr<Job> &job) {
+            std::weak_ptr<SynchronizationScheduler> weakSelf = shared_from_this();
+            // The job owns its receiver, which only refers back to it weakly
+            std::weak_ptr<Job> weakJob                       = job;
+            job->receiver                                    = make_receiver([weakSelf, weakJob](const std::shared_ptr<api::Event> &event) {
+                auto self = weakSelf.lock();
+                auto job  = weakJob.lock();
+                switch (event->getCode()) {
+                case api::EventCode::SYNCHRONIZATION_SUCCEED:
+                case api::EventCode::SYNCHRONIZATION_SUCCEED_ON_PREVIOUSLY_EMPTY_ACCOUNT:
+                case api::EventCode::SYNCHRONIZATION_FAILED:
+                    if (self && job) {
+                        self->finish(job, event);
+                    }
+                    break;
+                default:
+                    break;
+                }
+            });
+            try {
+                job->eventBus = job->synchronize();
+            } catch (const std::exception &e) {
+                auto payload = std::make_shared<DynamicObject>();
+                payload->putInt(api::Account::EV_SYNC_ERROR_CODE_INT, static_cast<int32_t>(api::ErrorCode::RUNTIME_ERROR));
+                payload->putString(api::Account::EV_SYNC_ERROR_MESSAGE, e.what());
+                finish(job, std::make_shared<Event>(api::EventCode::SYNCHRONIZATION_FAILED, payload));
+                return;
+            }
+            job->notifier->setProgress("synchronizing", 0.0);
+            job->eventBus->subscribe(getContext(), job->receiver);
+        }
+
+        void SynchronizationScheduler::finish(const std::shared_ptr<Job> &job, const std::shared_ptr<api::Event> &event) {
+            {
+                std::lock_guard<std::mutex> lock(_lock);
+                auto it = _jobs.find(job->accountUid);
+                if (it == _jobs.end() || it->second != job) {
+                    return;
+                }
+                _jobs.erase(it);
+                _running -= 1;
+                _runningPerExplorer[job->explorer] -= 1;
+            }
+            if (job->eventBus) {
+                job->eventBus->unsubscribe(job->receiver);
+            }
+            if (event->getCode() == api::EventCode::SYNCHRONIZATION_FAILED) {
+                auto payload = event->getPayload();
+                auto code    = payload ? payload->getInt(api::Account::EV_SYNC_ERROR_CODE_INT) : std::experimental::optional<int32_t>();
+                auto message = payload ? payload->getString(api::Account::EV_SYNC_ERROR_MESSAGE) : std::experimental::optional<std::string>();
+                job->notifier->failure(make_exception(code ? static_cast<api::ErrorCode>(code.value()) : api::ErrorCode::RUNTIME_ERROR,
+                                                      "Synchronization of {} failed: {}", job->accountUid, message.value_or("")));
+            } else {
+                job->notifier->success(event->getCode());
+            }
+            drain();
+        }
+    } // namespace core
+} // namespace ledger
@@ -0,0 +1,126 @@
+/*
+ *
+ * SynchronizationScheduler.hpp
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#ifndef LEDGER_CORE_SYNCHRONIZATIONSCHEDULER_HPP
+#define LEDGER_CORE_SYNCHRONIZATIONSCHEDULER_HPP
+
+#include <api/Event.hpp>
+#include <api/EventBus.hpp>
+#include <api/EventCode.hpp>
+#include <async/DedicatedContext.hpp>
+#include <deque>
+#include <events/ProgressNotifier.h>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace ledger {
+    namespace core {
+        class AbstractAccount;
+
+        /**
+         * Pool wide scheduler of account synchronizations. It bounds the number of accounts
+         * synchronized at the same time, globally and per explorer, serves interactive requests
+         * before background ones and holds new synchronizations back while the database
+         * connection pool is saturated. Scheduling an account that is already queued or
+         * synchronizing joins the pending synchronization.
+         */
+        class SynchronizationScheduler : public DedicatedContext, public std::enable_shared_from_this<SynchronizationScheduler> {
+          public:
+            enum class Priority {
+                INTERACTIVE,
+                BACKGROUND
+            };
+
+            using SynchronizeFunction = std::function<std::shared_ptr<api::EventBus>()>;
+            using SaturationProbe     = std::function<bool()>;
+
+            SynchronizationScheduler(const std::shared_ptr<api::ExecutionContext> &context,
+                                     int32_t maxConcurrentSynchronizations,
+                                     int32_t maxConcurrentSynchronizationsPerExplorer,
+                                     const SaturationProbe &isSaturated);
+
+            // The notifier reports the "queued" and "synchronizing" steps, then resolves with the
+            // final synchronization event code
+            std::shared_ptr<ProgressNotifier<api::EventCode>> schedule(const std::shared_ptr<AbstractAccount> &account,
+                                                                       Priority priority);
+            std::shared_ptr<ProgressNotifier<api::EventCode>> schedule(const std::string &accountUid,
+                                                                       const std::string &explorer,
+                                                                       const SynchronizeFunction &synchronize,
+                                                                       Priority priority);
+
+            std::size_t getRunningCount() const;
+            std::size_t getQueuedCount() const;
+
+            // Delay before starting queued synchronizations again once the database was saturated
+            static const int64_t SATURATION_RETRY_DELAY_MS = 100;
+
+          private:
+            struct Job {
+                enum class State {
+                    QUEUED,
+                    STARTED
+                };
+
+                std::string accountUid;
+                std::string explorer;
+                SynchronizeFunction synchronize;
+                // Both only change under the scheduler lock
+                Priority priority;
+                State state;
+                std::shared_ptr<ProgressNotifier<api::EventCode>> notifier;
+                std::shared_ptr<api::EventBus> eventBus;
+                std::shared_ptr<api::EventReceiver> receiver;
+            };
+
+            void drain();
+            void start(const std::shared_ptr<Job> &job);
+            void finish(const std::shared_ptr<Job> &job, const std::shared_ptr<api::Event> &event);
+            std::shared_ptr<Job> pick();
+
+            const int32_t _maxConcurrentSynchronizations;
+            const int32_t _maxConcurrentSynchronizationsPerExplorer;
+            SaturationProbe _isSaturated;
+
+            mutable std::mutex _lock;
+            // Queued jobs by priority then explorer, so that a busy explorer never holds back the others
+            std::unordered_map<std::string, std::deque<std::shared_ptr<Job>>> _queues[2];
+            std::unordered_map<std::string, std::shared_ptr<Job>> _jobs;
+            std::unordered_map<std::string, int32_t> _runningPerExplorer;
+            int32_t _running;
+            std::size_t _queued;
+            bool _retryScheduled;
+        };
+    } // namespace core
+} // namespace ledger
+
+#endif // LEDGER_CORE_SYNCHRONIZATIONSCHEDULER_HPP
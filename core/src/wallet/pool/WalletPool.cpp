@@ -95,6 +95,18 @@ namespace ledger {
                 _internalPreferencesBackend->setEncryption(_rng, _password);
             }
 
+            // HTTP response cache
+            auto httpCacheMemorySize = configuration->getInt(api::PoolConfiguration::HTTP_CACHE_MAX_MEMORY_SIZE).value_or(0);
+            if (httpCacheMemorySize > 0) {
+                auto httpCacheDiskSize = configuration->getInt(api::PoolConfiguration::HTTP_CACHE_MAX_DISK_SIZE).value_or(0);
+                _httpCache             = std::make_shared<HttpResponseCache>(
+                    httpCacheMemorySize,
+                    httpCacheDiskSize > 0 ? std::make_shared<Preferences>(*_internalPreferencesBackend, "http_cache") : nullptr,
+                    std::max(httpCacheDiskSize, 0));
+                _httpCache->addExplorerRules(std::chrono::seconds(configuration->getInt(api::PoolConfiguration::HTTP_CACHE_TTL)
+                                                                      .value_or(api::ConfigurationDefaults::DEFAULT_HTTP_CACHE_TTL)));
+            }
+
             // Logger management
             _logPrinter       = logPrinter;
             auto enableLogger = _configuration->getBoolean(api::PoolConfiguration::ENABLE_INTERNAL_LOGGING).value_or(true);
@@ -121,6 +133,16 @@ namespace ledger {
             _publisher                  = std::make_shared<EventPublisher>(getContext());
 
             _threadPoolExecutionContext = _threadDispatcher->getThreadPoolExecutionContext(fmt::format("pool_{}_thread_pool", name));
+
+            // Synchronization management
+            auto database             = _database;
+            _synchronizationScheduler = std::make_shared<SynchronizationScheduler>(
+                getContext(),
+                configuration->getInt(api::PoolConfiguration::SYNCHRONIZATION_MAX_CONCURRENT_ACCOUNTS)
+                    .value_or(api::ConfigurationDefaults::DEFAULT_SYNCHRONIZATION_MAX_CONCURRENT_ACCOUNTS),
+                configuration->getInt(api::PoolConfiguration::SYNCHRONIZATION_MAX_CONCURRENT_ACCOUNTS_PER_EXPLORER)
+                    .value_or(api::ConfigurationDefaults::DEFAULT_SYNCHRONIZATION_MAX_CONCURRENT_ACCOUNTS_PER_EXPLORER),
+                [database]() { return database->isSaturated(); });
         }
 
         std::shared_ptr<WalletPool>
@@ -224,6 +246,14 @@ namespace ledger {
             return _database;
         }
 
+        std::shared_ptr<SynchronizationScheduler> WalletPool::getSynchronizationScheduler() const {
+            return _synchronizationScheduler;
+        }
+
+        std::shared_ptr<HttpResponseCache> WalletPool::getHttpResponseCache() const {
+            return _httpCache;
+        }
+
         std::shared_ptr<DynamicObject> WalletPool::getConfiguration() const {
             return _configuration;
         }
@@ -265,6 +295,7 @@ namespace ledger {
                     getDispatcher()->getThreadPoolExecutionContext("httpExecutionContext"));
                 _httpClients[baseUrl] = client;
                 client->setLogger(logger());
+                client->setResponseCache(_httpCache);
                 return client;
             }
             auto client = _httpClients[baseUrl].lock();
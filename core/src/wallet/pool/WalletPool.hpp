@@ -56,6 +56,7 @@
 #include <utils/TTLCache.h>
 #include <wallet/bitcoin/factories/BitcoinLikeWalletFactory.hpp>
 #include <wallet/common/AbstractWalletFactory.hpp>
+#include <wallet/pool/SynchronizationScheduler.hpp>
 namespace ledger {
     namespace core {
         class BitcoinLikeWalletFactory;
@@ -74,6 +75,9 @@ namespace ledger {
             std::shared_ptr<DatabaseSessionPool> getDatabaseSessionPool() const;
             std::shared_ptr<DynamicObject> getConfiguration() const;
             std::shared_ptr<api::EventBus> getEventBus() const;
+            std::shared_ptr<SynchronizationScheduler> getSynchronizationScheduler() const;
+            // Null unless HTTP_CACHE_MAX_MEMORY_SIZE is set
+            std::shared_ptr<HttpResponseCache> getHttpResponseCache() const;
             const std::string &getName() const;
             const std::string getPassword() const;
 
@@ -192,9 +196,15 @@ namespace ledger {
             std::shared_ptr<api::PreferencesBackend> _externalPreferencesBackend;
             std::shared_ptr<api::PreferencesBackend> _internalPreferencesBackend;
 
+            // HTTP response cache, its disk tier lives in the internal preferences
+            std::shared_ptr<HttpResponseCache> _httpCache;
+
             // Database management
             std::shared_ptr<DatabaseSessionPool> _database;
 
+            // Synchronization management
+            std::shared_ptr<SynchronizationScheduler> _synchronizationScheduler;
+
             // Logger
             std::shared_ptr<spdlog::logger> _logger;
             std::shared_ptr<api::LogPrinter> _logPrinter;
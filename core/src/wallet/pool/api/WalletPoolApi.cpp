@@ -32,6 +32,7 @@
 
 #include <api/CurrencyCallback.hpp>
 #include <api/CurrencyListCallback.hpp>
+#include <api/EventCodeCallback.hpp>
 #include <api/I32Callback.hpp>
 #include <api/WalletCallback.hpp>
 #include <api/WalletListCallback.hpp>
@@ -40,6 +41,7 @@
 #include <database/soci-number.h>
 #include <database/soci-option.h>
 #include <memory>
+#include <wallet/common/AbstractAccount.hpp>
 
 namespace ledger {
     namespace core {
@@ -185,6 +187,19 @@ namespace ledger {
             return _pool->getEventBus();
         }
 
+        void WalletPoolApi::scheduleSynchronization(const std::shared_ptr<api::Account> &account,
+                                                    bool interactive,
+                                                    const std::shared_ptr<api::EventCodeCallback> &callback) {
+            auto localAccount = std::dynamic_pointer_cast<AbstractAccount>(account);
+            if (!localAccount) {
+                Future<api::EventCode>::failure(make_exception(api::ErrorCode::INVALID_ARGUMENT, "Account was not created by a wallet pool"))
+                    .callback(_mainContext, callback);
+                return;
+            }
+            auto priority = interactive ? SynchronizationScheduler::Priority::INTERACTIVE : SynchronizationScheduler::Priority::BACKGROUND;
+            _pool->getSynchronizationScheduler()->schedule(localAccount, priority)->getFuture().callback(_mainContext, callback);
+        }
+
         void WalletPoolApi::getLastBlock(const std::string &currencyName,
                                          const std::shared_ptr<api::BlockCallback> &callback) {
             _pool->getLastBlock(currencyName).callback(_mainContext, callback);
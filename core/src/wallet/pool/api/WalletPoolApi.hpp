@@ -32,6 +32,7 @@
 #define LEDGER_CORE_WALLETPOOL_API_HPP
 
 #include <api/ErrorCodeCallback.hpp>
+#include <api/EventCodeCallback.hpp>
 #include <api/PreferencesBackend.hpp>
 #include <api/WalletPool.hpp>
 #include <api/WalletPoolCallback.hpp>
@@ -69,6 +70,10 @@ namespace ledger {
 
             std::shared_ptr<api::EventBus> getEventBus() override;
 
+            void scheduleSynchronization(const std::shared_ptr<api::Account> &account,
+                                         bool interactive,
+                                         const std::shared_ptr<api::EventCodeCallback> &callback) override;
+
             void
             getLastBlock(const std::string &currencyName, const std::shared_ptr<api::BlockCallback> &callback) override;
 
@@ -31,6 +31,7 @@
 #include "NodeRippleLikeBlockchainExplorer.h"
 
 #include <api/Configuration.hpp>
+#include <api/ConfigurationDefaults.hpp>
 #include <api/RippleConfigurationDefaults.hpp>
 #include <rapidjson/document.h>
 #include <wallet/common/api_impl/OperationApi.h>
@@ -42,10 +43,19 @@ namespace ledger {
             const std::shared_ptr<api::ExecutionContext> &context,
             const std::shared_ptr<HttpClient> &http,
             const api::RippleLikeNetworkParameters &parameters,
-            const std::shared_ptr<api::DynamicObject> &configuration) : DedicatedContext(context),
-                                                                        RippleLikeBlockchainExplorer(configuration, {api::Configuration::BLOCKCHAIN_EXPLORER_API_ENDPOINT}) {
+            const std::shared_ptr<api::DynamicObject> &configuration,
+            const std::shared_ptr<RippleLikeRpcBatcher> &batcher) : DedicatedContext(context),
+                                                                    RippleLikeBlockchainExplorer(configuration, {api::Configuration::BLOCKCHAIN_EXPLORER_API_ENDPOINT}) {
             _http       = http;
             _parameters = parameters;
+            _batcher    = batcher;
+            if (!_batcher) {
+                auto window = configuration->getInt(api::Configuration::BLOCKCHAIN_EXPLORER_RPC_BATCH_WINDOW_MS)
+                                  .value_or(api::ConfigurationDefaults::DEFAULT_BLOCKCHAIN_EXPLORER_RPC_BATCH_WINDOW_MS);
+                auto maxSize = configuration->getInt(api::Configuration::BLOCKCHAIN_EXPLORER_RPC_BATCH_MAX_SIZE)
+                                   .value_or(api::ConfigurationDefaults::DEFAULT_BLOCKCHAIN_EXPLORER_RPC_BATCH_MAX_SIZE);
+                _batcher = std::make_shared<RippleLikeRpcBatcher>(http, context, std::chrono::milliseconds(window), maxSize);
+            }
         }
 
         Future<std::shared_ptr<BigInt>>
@@ -84,13 +94,9 @@ namespace ledger {
             NodeRippleLikeBodyRequest bodyRequest;
             bodyRequest.setMethod("server_state");
             bodyRequest.pushParameter("ledger_index", "current");
-            auto requestBody         = bodyRequest.getString();
-            bool parseNumberAsString = true;
-            std::unordered_map<std::string, std::string> headers{{"Content-Type", "application/json"}};
-            return _http->POST("", std::vector<uint8_t>(requestBody.begin(), requestBody.end()), headers)
-                .json(parseNumberAsString)
-                .mapPtr<BigInt>(getContext(), [field](const HttpRequest::JsonResult &result) {
-                    auto &json = *std::get<1>(result);
+            return call(bodyRequest)
+                .mapPtr<BigInt>(getContext(), [field](const std::shared_ptr<rapidjson::Document> &result) {
+                    auto &json = *result;
                     // Is there a result field ?
                     if (!json.IsObject() || !json.HasMember("result") ||
                         !json["result"].IsObject()) {
@@ -177,12 +183,9 @@ namespace ledger {
             bodyRequest.setMethod("tx");
             bodyRequest.pushParameter("transaction", transactionHash);
             bodyRequest.pushParameter("binary", "true");
-            auto requestBody = bodyRequest.getString();
-            std::unordered_map<std::string, std::string> headers{{"Content-Type", "application/json"}};
-            return _http->POST("", std::vector<uint8_t>(requestBody.begin(), requestBody.end()), headers)
-                .json()
-                .template map<Bytes>(getExplorerContext(), [](const HttpRequest::JsonResult &result) -> Bytes {
-                    auto &json = *std::get<1>(result);
+            return call(bodyRequest)
+                .template map<Bytes>(getExplorerContext(), [](const std::shared_ptr<rapidjson::Document> &result) -> Bytes {
+                    auto &json = *result;
                     if (!json.IsObject() || !json.HasMember("result") ||
                         !json["result"].IsObject()) {
                         throw make_exception(api::ErrorCode::HTTP_ERROR, "Failed to get raw transaction, no (or malformed) field \"result\" in response");
@@ -306,13 +309,9 @@ namespace ledger {
             bodyRequest.setMethod("account_info");
             bodyRequest.pushParameter("account", address);
             bodyRequest.pushParameter("ledger_index", std::string("validated"));
-            auto requestBody         = bodyRequest.getString();
-            bool parseNumberAsString = true;
-            std::unordered_map<std::string, std::string> headers{{"Content-Type", "application/json"}};
-            return _http->POST("", std::vector<uint8_t>(requestBody.begin(), requestBody.end()), headers)
-                .json(parseNumberAsString)
-                .mapPtr<BigInt>(getContext(), [address, key, defaultValue](const HttpRequest::JsonResult &result) {
-                    auto &json = *std::get<1>(result);
+            return call(bodyRequest)
+                .mapPtr<BigInt>(getContext(), [address, key, defaultValue](const std::shared_ptr<rapidjson::Document> &result) {
+                    auto &json = *result;
                     // Is there a result field ?
                     if (!json.IsObject() || !json.HasMember("result") ||
                         !json["result"].IsObject()) {
@@ -338,5 +337,9 @@ namespace ledger {
                     return std::make_shared<BigInt>(value);
                 });
         }
+
+        Future<std::shared_ptr<rapidjson::Document>> NodeRippleLikeBlockchainExplorer::call(NodeRippleLikeBodyRequest &bodyRequest) {
+            return _batcher->call(bodyRequest.getString());
+        }
     } // namespace core
 } // namespace ledger
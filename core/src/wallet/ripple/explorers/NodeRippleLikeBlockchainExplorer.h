@@ -34,6 +34,7 @@
 #include <api/RippleLikeNetworkParameters.hpp>
 #include <wallet/common/explorers/AbstractLedgerApiBlockchainExplorer.h>
 #include <wallet/ripple/explorers/RippleLikeBlockchainExplorer.h>
+#include <wallet/ripple/explorers/RippleLikeRpcBatcher.h>
 #include <wallet/ripple/explorers/api/RippleLikeBlockParser.h>
 #include <wallet/ripple/explorers/api/RippleLikeTransactionsBulkParser.h>
 #include <wallet/ripple/explorers/api/RippleLikeTransactionsParser.h>
@@ -163,7 +164,8 @@ namespace ledger {
             NodeRippleLikeBlockchainExplorer(const std::shared_ptr<api::ExecutionContext> &context,
                                              const std::shared_ptr<HttpClient> &http,
                                              const api::RippleLikeNetworkParameters &parameters,
-                                             const std::shared_ptr<api::DynamicObject> &configuration);
+                                             const std::shared_ptr<api::DynamicObject> &configuration,
+                                             const std::shared_ptr<RippleLikeRpcBatcher> &batcher = nullptr);
 
             Future<std::shared_ptr<BigInt>>
             getBalance(const std::vector<RippleLikeKeychain::Address> &addresses) override;
@@ -217,8 +219,12 @@ namespace ledger {
                            const std::string &key,
                            const BigInt &defaultValue);
 
+            // Read only call, gathered with the concurrent ones into a batch
+            Future<std::shared_ptr<rapidjson::Document>> call(NodeRippleLikeBodyRequest &bodyRequest);
+
             api::RippleLikeNetworkParameters _parameters;
             std::string _paginationMarker;
+            std::shared_ptr<RippleLikeRpcBatcher> _batcher;
         };
     } // namespace core
 } // namespace ledger
@@ -0,0 +1,164 @@
+/*
+ *
+ * RippleLikeRpcBatcher
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#include "RippleLikeRpcBatcher.h"
+
+#include <utils/Exception.hpp>
+#include <utils/LambdaRunnable.hpp>
+
+namespace ledger {
+    namespace core {
+        RippleLikeRpcBatcher::RippleLikeRpcBatcher(const std::shared_ptr<HttpClient> &http,
+                                                   const std::shared_ptr<api::ExecutionContext> &context,
+                                                   std::chrono::milliseconds window,
+                                                   size_t maxBatchSize)
+            : _http(http), _context(context), _window(window), _maxBatchSize(std::max<size_t>(maxBatchSize, 1)), _flushScheduled(false) {
+        }
+
+        Future<std::shared_ptr<rapidjson::Document>> RippleLikeRpcBatcher::call(const std::string &body) {
+            PendingCall call{body, Promise<std::shared_ptr<rapidjson::Document>>()};
+            auto future = call.promise.getFuture();
+            std::vector<PendingCall> ready;
+            bool schedule = false;
+            {
+                std::lock_guard<std::mutex> lock(_lock);
+                _stats.calls += 1;
+                _pending.push_back(std::move(call));
+                if (_window.count() <= 0 || _pending.size() >= _maxBatchSize) {
+                    ready.swap(_pending);
+                } else if (!_flushScheduled) {
+                    _flushScheduled = true;
+                    schedule        = true;
+                }
+            }
+            if (!ready.empty()) {
+                send(std::move(ready));
+            }
+            if (schedule) {
+                auto self = shared_from_this();
+                _context->delay(make_runnable([self]() {
+                                    self->flush();
+                                }),
+                                _window.count());
+            }
+            return future;
+        }
+
+        RippleLikeRpcBatcher::Stats RippleLikeRpcBatcher::getStats() const {
+            std::lock_guard<std::mutex> lock(_lock);
+            return _stats;
+        }
+
+        void RippleLikeRpcBatcher::flush() {
+            std::vector<PendingCall> ready;
+            {
+                std::lock_guard<std::mutex> lock(_lock);
+                ready.swap(_pending);
+                _flushScheduled = false;
+            }
+            if (!ready.empty()) {
+                send(std::move(ready));
+            }
+        }
+
+        void RippleLikeRpcBatcher::send(std::vector<PendingCall> calls) {
+            std::string body;
+            if (calls.size() == 1) {
+                body = calls.front().body;
+            } else {
+                body = "{\"method\":\"batch\",\"params\":[";
+                for (size_t index = 0; index < calls.size(); index++) {
+                    if (index > 0) {
+                        body += ",";
+                    }
+                    body += calls[index].body;
+                }
+                body += "]}";
+            }
+            {
+                std::lock_guard<std::mutex> lock(_lock);
+                _stats.requests += 1;
+            }
+
+            auto pending = std::make_shared<std::vector<PendingCall>>(std::move(calls));
+            std::unordered_map<std::string, std::string> headers{{"Content-Type", "application/json"}};
+            bool parseNumbersAsString = true;
+            _http->POST("", std::vector<uint8_t>(body.begin(), body.end()), headers)
+                .json(parseNumbersAsString)
+                .onComplete(_context, [pending](const Try<HttpRequest::JsonResult> &result) {
+                    if (result.isFailure()) {
+                        for (auto &call : *pending) {
+                            call.promise.failure(result.getFailure());
+                        }
+                        return;
+                    }
+                    try {
+                        dispatch(*pending, *std::get<1>(result.getValue()));
+                    } catch (const Exception &ex) {
+                        for (auto &call : *pending) {
+                            call.promise.failure(ex);
+                        }
+                    }
+                });
+        }
+
+        void RippleLikeRpcBatcher::dispatch(std::vector<PendingCall> &calls, const rapidjson::Document &response) {
+            if (calls.size() == 1) {
+                auto document = std::make_shared<rapidjson::Document>();
+                document->CopyFrom(response, document->GetAllocator());
+                calls.front().promise.success(document);
+                return;
+            }
+
+            // rippled answers a batch with the array of the results, either bare or under "result"
+            const rapidjson::Value *results = &response;
+            if (response.IsObject() && response.HasMember("result")) {
+                results = &response["result"];
+            }
+            if (!results->IsArray() || results->Size() != calls.size()) {
+                throw make_exception(api::ErrorCode::HTTP_ERROR, "Malformed batch response, expected an array of {} results", calls.size());
+            }
+
+            for (rapidjson::SizeType index = 0; index < results->Size(); index++) {
+                const auto &item = (*results)[index];
+                auto document    = std::make_shared<rapidjson::Document>();
+                auto &allocator  = document->GetAllocator();
+                if (item.IsObject() && item.HasMember("result")) {
+                    document->CopyFrom(item, allocator);
+                } else {
+                    document->SetObject();
+                    rapidjson::Value result(item, allocator);
+                    document->AddMember("result", result, allocator);
+                }
+                calls[index].promise.success(document);
+            }
+        }
+    } // namespace core
+} // namespace ledger
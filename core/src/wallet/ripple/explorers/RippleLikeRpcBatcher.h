@@ -0,0 +1,96 @@
+/*
+ *
+ * RippleLikeRpcBatcher
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#ifndef LEDGER_CORE_RIPPLELIKERPCBATCHER_H
+#define LEDGER_CORE_RIPPLELIKERPCBATCHER_H
+
+#include <api/ExecutionContext.hpp>
+#include <async/Future.hpp>
+#include <async/Promise.hpp>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <net/HttpClient.hpp>
+#include <rapidjson/document.h>
+#include <string>
+#include <vector>
+
+namespace ledger {
+    namespace core {
+
+        /**
+         * Coalesces the rippled JSON-RPC calls issued within a short window into a single "batch" call,
+         * then hands each caller its own response. One batcher is shared by all the node explorers of a
+         * pool talking to the same endpoint, so concurrent accounts share the round trips.
+         *
+         * Responses are given as {"result": ...} documents, like standalone calls, with numbers parsed as
+         * strings. Calls with side effects (submit) should not go through the batcher.
+         */
+        class RippleLikeRpcBatcher : public std::enable_shared_from_this<RippleLikeRpcBatcher> {
+          public:
+            struct Stats {
+                uint64_t calls    = 0;
+                uint64_t requests = 0;
+            };
+
+            RippleLikeRpcBatcher(const std::shared_ptr<HttpClient> &http,
+                                 const std::shared_ptr<api::ExecutionContext> &context,
+                                 std::chrono::milliseconds window,
+                                 size_t maxBatchSize);
+
+            // Queue a call built with NodeRippleLikeBodyRequest, a zero window sends it right away
+            Future<std::shared_ptr<rapidjson::Document>> call(const std::string &body);
+
+            Stats getStats() const;
+
+          private:
+            struct PendingCall {
+                std::string body;
+                Promise<std::shared_ptr<rapidjson::Document>> promise;
+            };
+
+            void flush();
+            void send(std::vector<PendingCall> calls);
+            static void dispatch(std::vector<PendingCall> &calls, const rapidjson::Document &response);
+
+            std::shared_ptr<HttpClient> _http;
+            std::shared_ptr<api::ExecutionContext> _context;
+            std::chrono::milliseconds _window;
+            size_t _maxBatchSize;
+
+            mutable std::mutex _lock;
+            std::vector<PendingCall> _pending;
+            bool _flushScheduled;
+            Stats _stats;
+        };
+    } // namespace core
+} // namespace ledger
+
+#endif // LEDGER_CORE_RIPPLELIKERPCBATCHER_H
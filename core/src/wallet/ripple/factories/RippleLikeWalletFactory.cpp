@@ -122,14 +122,25 @@ namespace ledger {
                                                                       api::BlockchainExplorerEngines::RIPPLE_NODE,
                                                                       networkParams.Identifier));
             if (engine == api::BlockchainExplorerEngines::RIPPLE_NODE) {
-                auto http = pool->getHttpClient(
-                    fmt::format("{}:{}",
-                                configuration->getString(api::Configuration::BLOCKCHAIN_EXPLORER_API_ENDPOINT)
-                                    .value_or(api::RippleConfigurationDefaults::RIPPLE_OBSERVER_NODE_ENDPOINT_S2),
-                                configuration->getString(api::Configuration::BLOCKCHAIN_EXPLORER_PORT)
-                                    .value_or(api::RippleConfigurationDefaults::RIPPLE_DEFAULT_PORT)));
+                auto endpoint = fmt::format("{}:{}",
+                                            configuration->getString(api::Configuration::BLOCKCHAIN_EXPLORER_API_ENDPOINT)
+                                                .value_or(api::RippleConfigurationDefaults::RIPPLE_OBSERVER_NODE_ENDPOINT_S2),
+                                            configuration->getString(api::Configuration::BLOCKCHAIN_EXPLORER_PORT)
+                                                .value_or(api::RippleConfigurationDefaults::RIPPLE_DEFAULT_PORT));
+                auto http     = pool->getHttpClient(endpoint);
+
+                // Explorers of the pool on the same node share their batches, the first one sets the window
+                auto batcher = _rpcBatchers[endpoint].lock();
+                if (!batcher) {
+                    auto window  = configuration->getInt(api::Configuration::BLOCKCHAIN_EXPLORER_RPC_BATCH_WINDOW_MS)
+                                      .value_or(api::ConfigurationDefaults::DEFAULT_BLOCKCHAIN_EXPLORER_RPC_BATCH_WINDOW_MS);
+                    auto maxSize = configuration->getInt(api::Configuration::BLOCKCHAIN_EXPLORER_RPC_BATCH_MAX_SIZE)
+                                       .value_or(api::ConfigurationDefaults::DEFAULT_BLOCKCHAIN_EXPLORER_RPC_BATCH_MAX_SIZE);
+                    batcher                = std::make_shared<RippleLikeRpcBatcher>(http, context, std::chrono::milliseconds(window), maxSize);
+                    _rpcBatchers[endpoint] = batcher;
+                }
 
-                explorer = std::make_shared<NodeRippleLikeBlockchainExplorer>(context, http, networkParams, configuration);
+                explorer = std::make_shared<NodeRippleLikeBlockchainExplorer>(context, http, networkParams, configuration, batcher);
             } else if (engine == api::BlockchainExplorerEngines::RIPPLE_API) {
                 auto http = pool->getHttpClient(
                     configuration->getString(
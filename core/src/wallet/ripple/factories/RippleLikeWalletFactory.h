@@ -35,6 +35,7 @@
 #include <functional>
 #include <wallet/common/AbstractWalletFactory.hpp>
 #include <wallet/ripple/explorers/RippleLikeBlockchainExplorer.h>
+#include <wallet/ripple/explorers/RippleLikeRpcBatcher.h>
 #include <wallet/ripple/factories/RippleLikeKeychainFactory.h>
 #include <wallet/ripple/synchronizers/RippleLikeAccountSynchronizer.hpp>
 
@@ -56,6 +57,9 @@ namespace ledger {
             // Explorers
             std::list<std::weak_ptr<RippleLikeBlockchainExplorer>> _runningExplorers;
 
+            // JSON-RPC batchers of the node explorers, by endpoint
+            std::unordered_map<std::string, std::weak_ptr<RippleLikeRpcBatcher>> _rpcBatchers;
+
             // Keychain factories
             std::unordered_map<std::string, std::shared_ptr<RippleLikeKeychainFactory>> _keychainFactories;
         };
@@ -38,6 +38,8 @@
 #include "horizon/HorizonOperationParser.hpp"
 #include "horizon/HorizonTransactionParser.hpp"
 
+#include <api/Configuration.hpp>
+#include <api/ConfigurationDefaults.hpp>
 #include <math/BaseConverter.hpp>
 #include <utils/Exception.hpp>
 #include <utils/JSONUtils.h>
@@ -53,10 +55,15 @@ namespace ledger {
         using TransactionsParser = HorizonApiParser<std::vector<std::shared_ptr<stellar::Transaction>>, HorizonTransactionsParser>;
         using OperationsParser   = HorizonApiParser<std::vector<std::shared_ptr<stellar::Operation>>, HorizonOperationsParser>;
 
+        const int32_t HorizonBlockchainExplorer::MAX_PAGE_SIZE = 200;
+
         HorizonBlockchainExplorer::HorizonBlockchainExplorer(const std::shared_ptr<api::ExecutionContext> &context,
                                                              const std::shared_ptr<HttpClient> &http,
                                                              const std::shared_ptr<api::DynamicObject> &configuration)
             : StellarLikeBlockchainExplorer(context, http) {
+            auto pageSize = configuration->getInt(api::Configuration::BLOCKCHAIN_EXPLORER_PAGE_SIZE)
+                                .value_or(api::ConfigurationDefaults::DEFAULT_BLOCKCHAIN_EXPLORER_PAGE_SIZE);
+            _pageSize = std::max(1, std::min(pageSize, MAX_PAGE_SIZE));
         }
 
         Future<Option<std::shared_ptr<stellar::Asset>>> HorizonBlockchainExplorer::getAsset(const std::string &assetCode, const std::string &assetIssuer) {
@@ -101,7 +108,7 @@ namespace ledger {
         Future<std::vector<std::shared_ptr<stellar::Operation>>> HorizonBlockchainExplorer::getOperations(const std::string &address,
                                                                                                           const Option<std::string> &cursor) {
             auto cursorParam = cursor.isEmpty() ? "" : fmt::format("&cursor={}", cursor.getValue());
-            return http->GET(fmt::format("/accounts/{}/operations?limit=50&order=asc{}", address, cursorParam))
+            return http->GET(fmt::format("/accounts/{}/operations?limit={}&order=asc{}", address, _pageSize, cursorParam))
                 .template json<OperationsParser::Result, Exception>(OperationsParser())
                 .map<std::vector<std::shared_ptr<stellar::Operation>>>(getContext(), [](const OperationsParser::Response &response) -> std::vector<std::shared_ptr<stellar::Operation>> {
                     if (response.isLeft()) {
@@ -114,7 +121,7 @@ namespace ledger {
         Future<std::vector<std::shared_ptr<stellar::Transaction>>> HorizonBlockchainExplorer::getTransactions(const std::string &address,
                                                                                                               const std::string &cursor) {
             auto cursorParam = cursor.empty() ? "" : fmt::format("&cursor={}", cursor);
-            return http->GET(fmt::format("/accounts/{}/transactions?limit=50&order=asc{}", address, cursorParam))
+            return http->GET(fmt::format("/accounts/{}/transactions?limit={}&order=asc{}", address, _pageSize, cursorParam))
                 .template json<TransactionsParser::Result, Exception>(TransactionsParser())
                 .map<std::vector<std::shared_ptr<stellar::Transaction>>>(getContext(), [](const TransactionsParser::Response &response) -> std::vector<std::shared_ptr<stellar::Transaction>> {
                     if (response.isLeft()) {
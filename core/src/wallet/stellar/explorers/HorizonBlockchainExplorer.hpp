@@ -51,6 +51,12 @@ namespace ledger {
             Future<std::shared_ptr<stellar::Account>> getAccount(const std::string &accountId) const override;
 
             Future<std::string> postTransaction(const std::vector<uint8_t> &tx, const std::string &correlationId = "") override;
+
+            // Largest page Horizon serves on collection endpoints
+            static const int32_t MAX_PAGE_SIZE;
+
+          private:
+            int32_t _pageSize;
         };
     } // namespace core
 } // namespace ledger
@@ -104,42 +104,51 @@ namespace ledger {
             const std::shared_ptr<StellarLikeAccount> &account,
             StellarLikeBlockchainExplorerAccountSynchronizer::SavedState &state) {
             auto address = account->getKeychain()->getAddress()->toString();
+            synchronizeTransactions(account, state, _explorer->getTransactions(address, state.transactionPagingToken));
+        }
+
+        void StellarLikeBlockchainExplorerAccountSynchronizer::synchronizeTransactions(
+            const std::shared_ptr<StellarLikeAccount> &account,
+            StellarLikeBlockchainExplorerAccountSynchronizer::SavedState &state,
+            Future<stellar::TransactionVector> page) {
+            auto address = account->getKeychain()->getAddress()->toString();
             auto self    = shared_from_this();
-            _explorer->getTransactions(address, state.transactionPagingToken)
-                .onComplete(account->getContext(), [self, account, state](const Try<stellar::TransactionVector> &txs) mutable {
-                    if (txs.isFailure()) {
-                        self->failSynchronization(txs.getFailure());
-                    } else {
-                        {
-                            std::vector<Operation> operations;
-                            for (const auto &tx : txs.getValue()) {
-                                account->logger()->debug("XLM transaction hash: {}, paging_token: {}", tx->hash, tx->pagingToken);
-                                account->interpretTransaction(*tx, operations);
-                                Try<int> tryPutTx = account->bulkInsert(operations);
-                                if (tryPutTx.isFailure()) {
-                                    account->logger()->error("Failed to bulk insert because: {}", tryPutTx.getFailure().getMessage());
-                                    throw make_exception(api::ErrorCode::RUNTIME_ERROR, "Synchronization failed ({})", tryPutTx.exception().getValue().getMessage());
-                                } else {
-                                    ++state.insertedOperations;
-                                }
-
-                                state.lastBlockHeight = std::max(state.lastBlockHeight, tx->ledger);
-                            }
-                        }
-                        account->emitEventsNow();
-                        if (!txs.getValue().empty()) {
-                            state.transactionPagingToken = txs.getValue().back()->pagingToken;
-                            {
-                                auto preferences = account->getInternalPreferences()->getSubPreferences("StellarLikeBlockchainExplorerAccountSynchronizer");
-                                preferences->editor()->putObject("state", state)->commit();
-                            }
-
-                            self->synchronizeTransactions(account, state);
-                        } else {
-                            self->endSynchronization(account, state);
-                        }
-                    }
-                });
+            page.onComplete(account->getContext(), [self, account, address, state](const Try<stellar::TransactionVector> &txs) mutable {
+                if (txs.isFailure()) {
+                    self->failSynchronization(txs.getFailure());
+                    return;
+                }
+                const auto &transactions = txs.getValue();
+                if (transactions.empty()) {
+                    self->endSynchronization(account, state);
+                    return;
+                }
+
+                // The paging token of the last transaction is all the next page needs, fetch it while this one is written
+                auto nextPage = self->_explorer->getTransactions(address, transactions.back()->pagingToken);
+
+                std::vector<Operation> operations;
+                for (const auto &tx : transactions) {
+                    account->logger()->debug("XLM transaction hash: {}, paging_token: {}", tx->hash, tx->pagingToken);
+                    account->interpretTransaction(*tx, operations);
+                    state.lastBlockHeight = std::max(state.lastBlockHeight, tx->ledger);
+                }
+                // A single database transaction for the whole page
+                Try<int> tryPutTx = account->bulkInsert(operations);
+                if (tryPutTx.isFailure()) {
+                    account->logger()->error("Failed to bulk insert because: {}", tryPutTx.getFailure().getMessage());
+                    throw make_exception(api::ErrorCode::RUNTIME_ERROR, "Synchronization failed ({})", tryPutTx.exception().getValue().getMessage());
+                }
+                state.insertedOperations += operations.size();
+                account->emitEventsNow();
+
+                state.transactionPagingToken = transactions.back()->pagingToken;
+                {
+                    auto preferences = account->getInternalPreferences()->getSubPreferences("StellarLikeBlockchainExplorerAccountSynchronizer");
+                    preferences->editor()->putObject("state", state)->commit();
+                }
+                self->synchronizeTransactions(account, state, nextPage);
+            });
         }
 
         void StellarLikeBlockchainExplorerAccountSynchronizer::endSynchronization(
@@ -90,6 +90,10 @@ namespace ledger {
                                     SavedState &state);
             void synchronizeTransactions(const std::shared_ptr<StellarLikeAccount> &account,
                                          SavedState &state);
+            // Persist the page of transactions, prefetching the next one meanwhile
+            void synchronizeTransactions(const std::shared_ptr<StellarLikeAccount> &account,
+                                         SavedState &state,
+                                         Future<stellar::TransactionVector> page);
             inline void failSynchronization(const Exception &ex);
             inline void endSynchronization(const std::shared_ptr<StellarLikeAccount> &account, SavedState const &state);
 
@@ -59,6 +59,11 @@ namespace ledger {
                                                                                              };
 
           protected:
+            QueryBuilder &joinTables(QueryBuilder &builder) override {
+                return builder.outerJoin("blocks AS b", "o.block_uid = b.uid")
+                    .outerJoin("tezos_originated_operations AS orig_op", "o.uid = orig_op.uid");
+            }
+
             soci::rowset<soci::row> performCount(soci::session &sql) override {
                 return _builder.select("o.type, count(*)")
                     .from("operations")
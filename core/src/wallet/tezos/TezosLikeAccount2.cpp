@@ -37,6 +37,7 @@
 #include <api/TezosLikeTransaction.hpp>
 #include <api/TezosOperationTag.hpp>
 #include <async/Future.hpp>
+#include <async/algorithm.h>
 #include <collections/vector.hpp>
 #include <common/AccountHelper.hpp>
 #include <database/query/ConditionQueryFilter.h>
@@ -125,11 +126,7 @@ namespace ledger {
             auto startTime = DateUtils::now();
             eventPublisher->postSticky(std::make_shared<Event>(api::EventCode::SYNCHRONIZATION_STARTED, api::DynamicObject::newInstance()), 0);
             future.flatMap<tezos::AccountSynchronizationContext>(getContext(), [self](const Try<tezos::AccountSynchronizationContext> &result) { // NOLINT(readability-function-cognitive-complexity)
-                      // Synchronize originated accounts ...
-                      // Notes: We should rid of this part by implementing support for fetching
-                      // txs for multiple addresses
-                      // Hint: we could add originated accounts to keychain as
-                      // managedAccounts and getAllObservableAddresses will return them as well
+                      // Synchronize originated accounts, as many at once as the explorer accepts
                       if (self->_originatedAccounts.empty()) {
                           return Future<tezos::AccountSynchronizationContext>::successful(result.getValue());
                       }
@@ -138,25 +135,41 @@ namespace ledger {
                       }
                       using TxsBulk = TezosLikeBlockchainExplorer::TransactionsBulk;
 
-                      static std::function<Future<tezos::AccountSynchronizationContext>(std::shared_ptr<TezosLikeAccount>, size_t, void *, tezos::AccountSynchronizationContext)> getTxs =
-                          [](const std::shared_ptr<TezosLikeAccount> &account, size_t id, void *session, tezos::AccountSynchronizationContext result) {
-                              std::vector<std::string> addresses{account->_originatedAccounts[id]->getAddress()};
-
-                              auto offset = account->_explorer->getSynchronisationOffset(account->_originatedAccounts[id]->queryOperations());
-
-                              return offset.flatMap<tezos::AccountSynchronizationContext>(account->getContext(), [=](const std::string &offset) mutable {
-                                  // For the moment we start synchro from the beginning
+                      static std::function<Future<tezos::AccountSynchronizationContext>(std::shared_ptr<TezosLikeAccount>, size_t, void *, Option<std::string>, tezos::AccountSynchronizationContext)> getTxs =
+                          [](const std::shared_ptr<TezosLikeAccount> &account, size_t first, void *session, const Option<std::string> &cursor, tezos::AccountSynchronizationContext result) {
+                              const auto last = std::min(first + account->_explorer->getMaxAddressesPerRequest(), account->_originatedAccounts.size());
+                              std::vector<std::string> addresses;
+                              std::vector<Future<std::string>> offsets;
+                              for (auto id = first; id < last; id++) {
+                                  addresses.push_back(account->_originatedAccounts[id]->getAddress());
+                                  offsets.push_back(cursor.isEmpty() ? account->_explorer->getSynchronisationOffset(account->_originatedAccounts[id]->queryOperations())
+                                                                     : Future<std::string>::successful(cursor.getValue()));
+                              }
+
+                              return async::sequence(account->getContext(), offsets).flatMap<tezos::AccountSynchronizationContext>(account->getContext(), [=](const std::vector<std::string> &offsets) mutable {
+                                  // Resume from the least synchronized account of the chunk, operations already
+                                  // stored for the others are ignored on insertion
+                                  auto offset = *std::min_element(offsets.begin(), offsets.end(), [](const std::string &lhs, const std::string &rhs) {
+                                      return lhs.size() != rhs.size() ? lhs.size() < rhs.size() : lhs < rhs;
+                                  });
                                   auto getSession = session ? Future<void *>::successful(session) : account->_explorer->startSession();
                                   return getSession.flatMap<tezos::AccountSynchronizationContext>(account->getContext(), [=](void *s) mutable {
                                       return account->_explorer->getTransactions(addresses, offset, s)
                                           .flatMap<tezos::AccountSynchronizationContext>(account->getContext(), [=](const std::shared_ptr<TxsBulk> &bulk) mutable {
-                                              auto uid = TezosLikeAccountDatabaseHelper::createOriginatedAccountUid(account->getAccountUid(), addresses[0]);
                                               {
                                                   std::vector<Operation> operations;
-                                                  for (auto &tx : bulk->transactions) {
-                                                      tx.originatedAccountUid     = uid;
-                                                      tx.originatedAccountAddress = addresses[0];
-                                                      account->interpretTransaction(tx, operations);
+                                                  for (const auto &fetched : bulk->transactions) {
+                                                      // An operation between two originated accounts belongs to both of them
+                                                      for (const auto &address : addresses) {
+                                                          if (addresses.size() > 1 && fetched.sender != address && fetched.receiver != address &&
+                                                              (fetched.originatedAccount.isEmpty() || fetched.originatedAccount.getValue().address != address)) {
+                                                              continue;
+                                                          }
+                                                          auto tx                     = fetched;
+                                                          tx.originatedAccountUid     = TezosLikeAccountDatabaseHelper::createOriginatedAccountUid(account->getAccountUid(), address);
+                                                          tx.originatedAccountAddress = address;
+                                                          account->interpretTransaction(tx, operations);
+                                                      }
                                                   }
                                                   auto f = account->bulkInsert(operations);
                                                   if (f.isSuccess()) {
@@ -164,18 +177,18 @@ namespace ledger {
                                                   }
                                               }
 
-                                              if (bulk->hasNext) {
-                                                  return getTxs(account, id, s, result);
+                                              if (bulk->hasNext && !bulk->transactions.empty()) {
+                                                  return getTxs(account, first, s, bulk->transactions.back().explorerId, result);
                                               }
 
-                                              if (id == account->_originatedAccounts.size() - 1) {
+                                              if (last == account->_originatedAccounts.size()) {
                                                   account->logger()->info("[{}] Stopping synchronization at originatedAccount index {} ({} originated account detected)",
                                                                           account->tracePrefix(),
-                                                                          id,
-                                                                          id + 1);
+                                                                          last - 1,
+                                                                          last);
                                                   return Future<tezos::AccountSynchronizationContext>::successful(result);
                                               }
-                                              return getTxs(account, id + 1, nullptr, result);
+                                              return getTxs(account, last, nullptr, Option<std::string>(), result);
                                           })
                                           .recover(account->getContext(), [](const Exception &ex) -> tezos::AccountSynchronizationContext {
                                               throw ex;
@@ -183,7 +196,7 @@ namespace ledger {
                                   });
                               });
                           };
-                      return getTxs(self, 0, nullptr, result.getValue());
+                      return getTxs(self, 0, nullptr, Option<std::string>(), result.getValue());
                   })
                 .onComplete(getContext(), [eventPublisher, self, startTime](const auto &result) {
                     api::EventCode code;
@@ -37,7 +37,11 @@
 #include <api/TezosConfiguration.hpp>
 #include <api/TezosConfigurationDefaults.hpp>
 #include <api/TezosLikeOriginatedAccount.hpp>
+#include <async/algorithm.h>
+#include <collections/strings.hpp>
+#include <map>
 #include <sstream>
+#include <utils/LambdaRunnable.hpp>
 #include <wallet/common/OperationQuery.h>
 
 namespace ledger {
@@ -138,23 +142,125 @@ namespace ledger {
 
         Future<std::shared_ptr<BigInt>>
         BakingBadTezosLikeBlockchainExplorer::getBalance(const std::vector<TezosLikeKeychain::Address> &addresses) {
-            const auto size = addresses.size();
-            if (size != 1) {
-                throw make_exception(api::ErrorCode::INVALID_ARGUMENT,
-                                     "Can only get balance of 1 address from Tezos Node, but got {} addresses",
-                                     addresses.size());
+            if (addresses.empty()) {
+                throw make_exception(api::ErrorCode::INVALID_ARGUMENT, "Can't get balance of an empty list of addresses");
+            }
+            std::vector<std::string> addressesStr;
+            addressesStr.reserve(addresses.size());
+            for (const auto &address : addresses) {
+                addressesStr.push_back(address->toString());
             }
-            const std::string addressesStr = addresses[0]->toString();
 
-            return _http->GET(fmt::format("v1/accounts/{}/balance", addressesStr))
-                .template json<BigInt, Exception>()
-                .template mapPtr<BigInt>(getExplorerContext(),
-                                         [](const Either<Exception, std::shared_ptr<BigInt>> &result) {
-                                             if (result.isLeft()) {
-                                                 throw result.getLeft();
-                                             }
-                                             return result.getRight();
-                                         });
+            return getAccountStates(addressesStr)
+                .mapPtr<BigInt>(getExplorerContext(), [](const std::vector<AccountState> &states) {
+                    auto balance = std::make_shared<BigInt>(BigInt::ZERO);
+                    for (const auto &state : states) {
+                        *balance = *balance + state.balance;
+                    }
+                    return balance;
+                });
+        }
+
+        Future<std::vector<BakingBadTezosLikeBlockchainExplorer::AccountState>>
+        BakingBadTezosLikeBlockchainExplorer::getAccountStates(const std::vector<std::string> &addresses) {
+            std::vector<Future<AccountState>> states;
+            bool scheduleFlush = false;
+            {
+                std::lock_guard<std::mutex> lock(_inflightLock);
+                for (const auto &address : addresses) {
+                    auto it = _inflightAccounts.find(address);
+                    if (it != _inflightAccounts.end()) {
+                        states.push_back(it->second);
+                        continue;
+                    }
+                    scheduleFlush = scheduleFlush || _queuedAccounts.empty();
+                    Promise<AccountState> promise;
+                    _queuedAccounts.emplace(address, promise);
+                    _inflightAccounts.emplace(address, promise.getFuture());
+                    states.push_back(promise.getFuture());
+                }
+            }
+            if (scheduleFlush) {
+                auto self = shared_from_this();
+                getExplorerContext()->execute(make_runnable([self]() {
+                    self->flushAccountStates();
+                }));
+            }
+            return async::sequence(getExplorerContext(), states);
+        }
+
+        void BakingBadTezosLikeBlockchainExplorer::flushAccountStates() {
+            std::unordered_map<std::string, Promise<AccountState>> queued;
+            {
+                std::lock_guard<std::mutex> lock(_inflightLock);
+                queued.swap(_queuedAccounts);
+            }
+            std::vector<std::string> addresses;
+            std::vector<Promise<AccountState>> promises;
+            for (const auto &entry : queued) {
+                addresses.push_back(entry.first);
+                promises.push_back(entry.second);
+            }
+
+            auto self = shared_from_this();
+            for (size_t first = 0; first < addresses.size(); first += MAX_ADDRESSES_PER_REQUEST) {
+                const auto last = std::min(first + MAX_ADDRESSES_PER_REQUEST, addresses.size());
+                std::vector<std::string> chunk(addresses.begin() + first, addresses.begin() + last);
+                std::vector<Promise<AccountState>> chunkPromises(promises.begin() + first, promises.begin() + last);
+                std::stringstream addressesStr;
+                strings::join(chunk, addressesStr, ",");
+
+                const bool parseNumbersAsString = true;
+                _http->GET(fmt::format("v1/accounts?address.in={}&limit={}", addressesStr.str(), chunk.size()))
+                    .json(parseNumbersAsString)
+                    .map<std::unordered_map<std::string, AccountState>>(getExplorerContext(), [](const HttpRequest::JsonResult &result) {
+                        const auto &json = *std::get<1>(result);
+                        if (!json.IsArray()) {
+                            throw make_exception(api::ErrorCode::HTTP_ERROR,
+                                                 "Failed to get accounts from network, no (or malformed) response");
+                        }
+                        const auto getString = [](const rapidjson::Value &object, const char *fieldName) -> std::string {
+                            return object.IsObject() && object.HasMember(fieldName) && object[fieldName].IsString() ? object[fieldName].GetString() : "";
+                        };
+                        std::unordered_map<std::string, AccountState> states;
+                        for (const auto &account : json.GetArray()) {
+                            AccountState state;
+                            state.address     = getString(account, "address");
+                            const auto amount = getString(account, "balance");
+                            const auto count  = getString(account, "counter");
+                            state.balance     = amount.empty() ? BigInt::ZERO : BigInt::fromString(amount);
+                            state.counter     = count.empty() ? BigInt::ZERO : BigInt::fromString(count);
+                            state.publicKey   = getString(account, "publicKey");
+                            if (state.publicKey.empty() && account.HasMember("manager")) {
+                                state.publicKey = getString(account["manager"], "publicKey");
+                            }
+                            states[state.address] = state;
+                        }
+                        return states;
+                    })
+                    .onComplete(getExplorerContext(), [self, chunk, chunkPromises](const Try<std::unordered_map<std::string, AccountState>> &result) mutable {
+                        {
+                            std::lock_guard<std::mutex> lock(self->_inflightLock);
+                            for (const auto &address : chunk) {
+                                self->_inflightAccounts.erase(address);
+                            }
+                        }
+                        for (size_t index = 0; index < chunk.size(); index++) {
+                            if (result.isFailure()) {
+                                chunkPromises[index].failure(result.getFailure());
+                                continue;
+                            }
+                            // Accounts never seen on chain are not listed by TzKT
+                            const auto &states = result.getValue();
+                            auto it            = states.find(chunk[index]);
+                            if (it != states.end()) {
+                                chunkPromises[index].success(it->second);
+                            } else {
+                                chunkPromises[index].success(AccountState{chunk[index], BigInt::ZERO, BigInt::ZERO, ""});
+                            }
+                        }
+                    });
+            }
         }
 
         Future<std::shared_ptr<BigInt>>
@@ -272,42 +378,69 @@ namespace ledger {
         }
 
         std::function<FuturePtr<TezosLikeBlockchainExplorer::TransactionsBulk>(const std::shared_ptr<TezosLikeBlockchainExplorer::TransactionsBulk> &)>
-        BakingBadTezosLikeBlockchainExplorer::AddPublicKeyToRevealTx(const std::vector<std::string> &addresses) {
+        BakingBadTezosLikeBlockchainExplorer::AddPublicKeyToRevealTx() {
             return [=](const std::shared_ptr<TransactionsBulk> &bulk) {
                 std::vector<std::vector<Transaction>::iterator> revealTx;
+                std::vector<std::string> senders;
 
                 // Gather pointers to each REVEAL operations
                 for (auto it = bulk->transactions.begin(); it < bulk->transactions.end(); ++it) {
                     if (it->type == api::TezosOperationTag::OPERATION_TAG_REVEAL) {
                         revealTx.push_back(it);
+                        senders.push_back(it->sender);
                     }
                 }
                 if (revealTx.empty()) {
                     return FuturePtr<TransactionsBulk>::successful(bulk);
                 }
 
-                return _http->GET(fmt::format("v1/accounts/{}", addresses[0]))
-                    .json(false)
-                    .mapPtr<TransactionsBulk>(getExplorerContext(), [=](const HttpRequest::JsonResult &account) {
-                        const auto &json = *std::get<1>(account);
-                        if (!json.IsObject() && !json.HasMember("publicKey")) {
-                            throw make_exception(api::ErrorCode::HTTP_ERROR,
-                                                 "Failed to get 'publicKey' from network, no (or malformed) field in response");
-                        }
-
+                return getAccountStates(senders)
+                    .mapPtr<TransactionsBulk>(getExplorerContext(), [=](const std::vector<AccountState> &states) {
                         // Set publicKey to each gathered REAVEAL operations
-                        std::string pubkey = json.HasMember("publicKey") ? json["publicKey"].GetString() : "";
-                        if (pubkey.empty()) {
-                            pubkey = json.HasMember("manager") && json["manager"].HasMember("publicKey") ? json["manager"]["publicKey"].GetString() : "";
-                        }
-                        for (const auto &tx : revealTx) {
-                            tx->publicKey = pubkey;
+                        for (size_t index = 0; index < revealTx.size(); index++) {
+                            revealTx[index]->publicKey = states[index].publicKey;
                         }
                         return bulk;
                     });
             };
         }
 
+        FuturePtr<TezosLikeBlockchainExplorer::TransactionsBulk>
+        BakingBadTezosLikeBlockchainExplorer::getTransactionsPage(const std::string &address, uint64_t lastId) {
+            const auto key = fmt::format("{}:{}", address, lastId);
+            // tzkt api: Sort mode (0 - ascending, 1 - descending)
+            std::string params = fmt::format("?limit={}&sort=0", PAGE_SIZE);
+            if (lastId > 0) {
+                params += fmt::format("&lastId={}", lastId);
+            }
+            using EitherTransactionsBulk = Either<Exception, std::shared_ptr<TransactionsBulk>>;
+
+            std::unique_lock<std::mutex> lock(_inflightLock);
+            auto it = _inflightPages.find(key);
+            if (it != _inflightPages.end()) {
+                return it->second;
+            }
+            auto page = _http->GET(fmt::format("v1/accounts/{}/operations{}", address, params))
+                .template json<TezosLikeBlockchainExplorer::TransactionsBulk, Exception>()
+                .template mapPtr<TransactionsBulk>(getExplorerContext(),
+                                                   [](const EitherTransactionsBulk &result) {
+                                                       if (result.isLeft()) {
+                                                           throw result.getLeft();
+                                                       }
+                                                       result.getRight()->hasNext = result.getRight()->transactions.size() == PAGE_SIZE;
+                                                       return result.getRight();
+                                                   });
+            _inflightPages.emplace(key, page);
+            lock.unlock();
+
+            auto self = shared_from_this();
+            page.onComplete(getExplorerContext(), [self, key](const Try<std::shared_ptr<TransactionsBulk>> &) {
+                std::lock_guard<std::mutex> lock(self->_inflightLock);
+                self->_inflightPages.erase(key);
+            });
+            return page;
+        }
+
         FuturePtr<TezosLikeBlockchainExplorer::TransactionsBulk>
         BakingBadTezosLikeBlockchainExplorer::getTransactions(const std::vector<std::string> &addresses,
                                                               Option<std::string> offset,
@@ -317,30 +450,52 @@ namespace ledger {
             });
 
             const uint64_t localOffset = tryOffset.isSuccess() ? tryOffset.getValue() : 0;
-            constexpr uint64_t limit   = 100;
 
-            if (addresses.size() != 1) {
+            if (addresses.empty() || addresses.size() > MAX_ADDRESSES_PER_REQUEST) {
                 throw make_exception(api::ErrorCode::INVALID_ARGUMENT,
-                                     "Can only get transactions for 1 address from Tezos Node, but got {} addresses",
+                                     "Can only get transactions for 1 to {} addresses from TzKT, but got {} addresses",
+                                     MAX_ADDRESSES_PER_REQUEST,
                                      addresses.size());
             }
-            // tzkt api: Sort mode (0 - ascending, 1 - descending)
-            std::string params = fmt::format("?limit={}&sort=0", limit);
-            if (localOffset > 0) {
-                params += fmt::format("&lastId={}", localOffset);
+            std::vector<FuturePtr<TransactionsBulk>> pages;
+            pages.reserve(addresses.size());
+            for (const auto &address : addresses) {
+                pages.push_back(getTransactionsPage(address, localOffset));
             }
-            using EitherTransactionsBulk = Either<Exception, std::shared_ptr<TransactionsBulk>>;
-            return _http->GET(fmt::format("v1/accounts/{}/operations{}", addresses[0], params))
-                .template json<TezosLikeBlockchainExplorer::TransactionsBulk, Exception>()
-                .template mapPtr<TransactionsBulk>(getExplorerContext(),
-                                                   [](const EitherTransactionsBulk &result) {
-                                                       if (result.isLeft()) {
-                                                           throw result.getLeft();
-                                                       }
-                                                       result.getRight()->hasNext = result.getRight()->transactions.size() == limit;
-                                                       return result.getRight();
-                                                   })
-                .flatMapPtr<TransactionsBulk>(getExplorerContext(), AddPublicKeyToRevealTx(addresses));
+
+            return async::sequence(getExplorerContext(), pages)
+                .mapPtr<TransactionsBulk>(getExplorerContext(), [](const std::vector<std::shared_ptr<TransactionsBulk>> &pages) {
+                    const auto idOf = [](const Transaction &tx) -> uint64_t {
+                        return std::stoull(tx.explorerId.getValueOr("0"));
+                    };
+                    // Operation ids are global to TzKT so pages of several addresses share the same cursor.
+                    // Stop at the lowest last id of the full pages, the next call resumes from there.
+                    auto bulk     = std::make_shared<TransactionsBulk>();
+                    bulk->hasNext = false;
+                    auto cursor   = std::numeric_limits<uint64_t>::max();
+                    for (const auto &page : pages) {
+                        if (page->hasNext) {
+                            bulk->hasNext = true;
+                            cursor        = std::min(cursor, idOf(page->transactions.back()));
+                        }
+                    }
+                    // Operations between two of the addresses are listed by both pages
+                    std::map<uint64_t, Transaction> merged;
+                    for (const auto &page : pages) {
+                        for (const auto &tx : page->transactions) {
+                            const auto id = idOf(tx);
+                            if (id <= cursor) {
+                                merged.emplace(id, tx);
+                            }
+                        }
+                    }
+                    bulk->transactions.reserve(merged.size());
+                    for (const auto &entry : merged) {
+                        bulk->transactions.push_back(entry.second);
+                    }
+                    return bulk;
+                })
+                .flatMapPtr<TransactionsBulk>(getExplorerContext(), AddPublicKeyToRevealTx());
         }
 
         FuturePtr<Block> BakingBadTezosLikeBlockchainExplorer::getCurrentBlock() const {
@@ -395,7 +550,14 @@ namespace ledger {
 
         Future<std::shared_ptr<BigInt>>
         BakingBadTezosLikeBlockchainExplorer::getCounter(const std::string &address) {
-            return _http->GET(fmt::format("/chains/main/blocks/head/context/contracts/{}/counter", address), std::unordered_map<std::string, std::string>(), getRPCNodeEndpoint())
+            // The counter is read from the node head since TzKT may lag behind it, so concurrent
+            // callers only share the request in flight
+            std::unique_lock<std::mutex> lock(_inflightLock);
+            auto it = _inflightCounters.find(address);
+            if (it != _inflightCounters.end()) {
+                return it->second;
+            }
+            auto counter = _http->GET(fmt::format("/chains/main/blocks/head/context/contracts/{}/counter", address), std::unordered_map<std::string, std::string>(), getRPCNodeEndpoint())
                 .template json<BigInt, Exception>()
                 .template mapPtr<BigInt>(getExplorerContext(),
                                          [](const Either<Exception, std::shared_ptr<BigInt>> &result) {
@@ -404,6 +566,15 @@ namespace ledger {
                                              }
                                              return result.getRight();
                                          });
+            _inflightCounters.emplace(address, counter);
+            lock.unlock();
+
+            auto self = shared_from_this();
+            counter.onComplete(getExplorerContext(), [self, address](const Try<std::shared_ptr<BigInt>> &) {
+                std::lock_guard<std::mutex> lock(self->_inflightLock);
+                self->_inflightCounters.erase(address);
+            });
+            return counter;
         }
 
         Future<std::vector<uint8_t>> BakingBadTezosLikeBlockchainExplorer::forgeKTOperation(const std::shared_ptr<TezosLikeTransactionApi> &tx) {
@@ -457,6 +628,10 @@ namespace ledger {
                 });
         }
 
+        size_t BakingBadTezosLikeBlockchainExplorer::getMaxAddressesPerRequest() const {
+            return MAX_ADDRESSES_PER_REQUEST;
+        }
+
         Future<std::string> BakingBadTezosLikeBlockchainExplorer::getSynchronisationOffset(const std::shared_ptr<api::OperationQuery> &operations) {
             constexpr bool ascending = true;
             auto ops                 = std::dynamic_pointer_cast<OperationQuery>(operations->complete()->limit(1)->addOrder(api::OperationOrderKey::TIME, ascending))->execute();
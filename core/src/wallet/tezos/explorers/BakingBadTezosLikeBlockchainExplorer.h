@@ -30,6 +30,7 @@
 
 #pragma once
 #include <api/TezosLikeNetworkParameters.hpp>
+#include <mutex>
 #include <wallet/common/explorers/AbstractLedgerApiBlockchainExplorer.h>
 #include <wallet/tezos/api_impl/TezosLikeTransactionApi.h>
 #include <wallet/tezos/explorers/TezosLikeBlockchainExplorer.h>
@@ -52,6 +53,18 @@ namespace ledger {
                                                      public DedicatedContext,
                                                      public std::enable_shared_from_this<BakingBadTezosLikeBlockchainExplorer> {
           public:
+            /// Number of operations fetched per address and per request
+            static const uint64_t PAGE_SIZE               = 100;
+            /// Number of addresses looked up by a single accounts request
+            static const size_t MAX_ADDRESSES_PER_REQUEST = 50;
+
+            struct AccountState {
+                std::string address;
+                BigInt balance;
+                BigInt counter;
+                std::string publicKey;
+            };
+
             BakingBadTezosLikeBlockchainExplorer(const std::shared_ptr<api::ExecutionContext> &context,
                                                  const std::shared_ptr<HttpClient> &http,
                                                  const api::TezosLikeNetworkParameters &parameters,
@@ -114,11 +127,27 @@ namespace ledger {
 
             Future<std::string> getSynchronisationOffset(const std::shared_ptr<api::OperationQuery> &operations) override;
 
+            size_t getMaxAddressesPerRequest() const override;
+
+            /// Get the state of many accounts with as few requests as possible. Lookups requested
+            /// before the explorer context gets to them are sent together, and concurrent callers
+            /// asking for the same address share the same request.
+            Future<std::vector<AccountState>> getAccountStates(const std::vector<std::string> &addresses);
+
           private:
+            FuturePtr<TransactionsBulk> getTransactionsPage(const std::string &address, uint64_t lastId);
+            void flushAccountStates();
+
             api::TezosLikeNetworkParameters _parameters;
             std::unordered_map<std::string, uint64_t> _sessions;
             std::function<FuturePtr<TezosLikeBlockchainExplorer::TransactionsBulk>(const std::shared_ptr<TezosLikeBlockchainExplorer::TransactionsBulk> &)>
-            AddPublicKeyToRevealTx(const std::vector<std::string> &addresses);
+            AddPublicKeyToRevealTx();
+
+            std::mutex _inflightLock;
+            std::unordered_map<std::string, Future<AccountState>> _inflightAccounts;
+            std::unordered_map<std::string, Promise<AccountState>> _queuedAccounts;
+            std::unordered_map<std::string, FuturePtr<BigInt>> _inflightCounters;
+            std::unordered_map<std::string, FuturePtr<TransactionsBulk>> _inflightPages;
         };
     } // namespace core
 } // namespace ledger
@@ -180,6 +180,11 @@ namespace ledger {
 
             virtual Future<std::string> getSynchronisationOffset(const std::shared_ptr<api::OperationQuery> &operations) = 0;
 
+            /// Number of addresses getTransactions accepts at once.
+            virtual size_t getMaxAddressesPerRequest() const {
+                return 1;
+            }
+
           protected:
             std::string getRPCNodeEndpoint() const {
                 return _rpcNode;
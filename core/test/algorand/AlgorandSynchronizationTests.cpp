@@ -32,6 +32,7 @@
 
 #include <api/Configuration.hpp>
 #include <functional>
+#include <set>
 #include <wallet/algorand/AlgorandAccount.hpp>
 #include <wallet/algorand/AlgorandLikeCurrencies.hpp>
 #include <wallet/algorand/AlgorandNetworks.hpp>
@@ -52,11 +53,11 @@ class AlgorandSynchronizationTest : public WalletFixture<WalletFactory> {
         uv::wait(pool->deleteWallet("test-wallet"));
         WalletFixture::TearDown();
     }
-    void synchronizeAccount(const std::string &accountAddress) {
+    void createAccount(const std::string &accountAddress,
+                       const std::shared_ptr<api::DynamicObject> &configuration = DynamicObject::newInstance()) {
         registerCurrency(currencies::ALGORAND);
 
         // NOTE: we run the tests on the staging environment which is on the TestNet
-        auto configuration = DynamicObject::newInstance();
         configuration->putString(api::Configuration::BLOCKCHAIN_EXPLORER_API_ENDPOINT, "https://algorand.coin.staging.aws.ledger.com");
 
         auto wallet    = std::dynamic_pointer_cast<Wallet>(uv::wait(pool->createWallet("test-wallet", "algorand", configuration)));
@@ -71,7 +72,12 @@ class AlgorandSynchronizationTest : public WalletFixture<WalletFactory> {
             {algorand::Address::toPublicKey(accountAddress)},
             {hex::toByteArray("")});
 
-        _account      = std::dynamic_pointer_cast<Account>(uv::wait(wallet->newAccountWithInfo(info)));
+        _account = std::dynamic_pointer_cast<Account>(uv::wait(wallet->newAccountWithInfo(info)));
+    }
+
+    void synchronizeAccount(const std::string &accountAddress,
+                            const std::shared_ptr<api::DynamicObject> &configuration = DynamicObject::newInstance()) {
+        createAccount(accountAddress, configuration);
 
         auto receiver = make_receiver([=](const std::shared_ptr<api::Event> &event) {
             fmt::print("Received event {}\n", api::to_string(event->getCode()));
@@ -115,3 +121,53 @@ TEST_F(AlgorandSynchronizationTest, DISABLED_AccountSynchronizationTest) {
     std::cout << ">>> Nb of operations: " << operations.size() << std::endl;
     EXPECT_GT(operations.size(), 200);
 }
+
+TEST_F(AlgorandSynchronizationTest, DISABLED_AccountBackfillSynchronizationTest) {
+    // Split the history of the account into many small segments
+    auto configuration = DynamicObject::newInstance();
+    configuration->putInt(api::Configuration::SYNCHRONIZATION_BACKFILL_SEGMENT_SIZE, 500000);
+    configuration->putInt(api::Configuration::SYNCHRONIZATION_BACKFILL_MAX_CONCURRENT_SEGMENTS, 4);
+    synchronizeAccount(OBELIX_ADDRESS, configuration);
+
+    auto internalPreferences = _account->getInternalPreferences()->getSubPreferences("AlgorandAccountSynchronizer");
+    auto savedState          = internalPreferences->template getObject<SavedState>("state");
+    EXPECT_GT(savedState.getValue().round, 6000000);
+    EXPECT_TRUE(internalPreferences->template getObject<BackfillState>("backfill").isEmpty());
+
+    auto operations = uv::wait(std::dynamic_pointer_cast<OperationQuery>(_account->queryOperations()->complete())->execute());
+    EXPECT_GT(operations.size(), 200);
+    std::set<std::string> uids;
+    for (const auto &operation : operations) {
+        EXPECT_TRUE(uids.insert(operation->getUid()).second);
+    }
+}
+
+TEST_F(AlgorandSynchronizationTest, EraseDataSinceDuringBackfill) {
+    createAccount(OBELIX_ADDRESS);
+    auto now = std::chrono::system_clock::now();
+    {
+        soci::session sql(pool->getDatabaseSessionPool()->getPool());
+        _account->putBlock(sql, api::Block("block_hash", "", now - std::chrono::hours(1), currencies::ALGORAND.name, 5000000));
+    }
+
+    // The newest page raised the saved round while the segments below it were still being fetched
+    auto internalPreferences = _account->getInternalPreferences()->getSubPreferences("AlgorandAccountSynchronizer");
+    SavedState savedState;
+    savedState.round = 6000000;
+    BackfillState backfillState;
+    backfillState.firstRound        = 1000000;
+    backfillState.lastRound         = 5900000;
+    backfillState.segmentSize       = 500000;
+    backfillState.completedSegments = {8, 9};
+    internalPreferences->editor()->putObject<SavedState>("state", savedState)->putObject<BackfillState>("backfill", backfillState)->commit();
+
+    uv::wait(_account->eraseDataSince(now));
+    EXPECT_EQ(internalPreferences->getObject<SavedState>("state").getValue().round, 1000000);
+    EXPECT_TRUE(internalPreferences->getObject<BackfillState>("backfill").isEmpty());
+
+    // Without a pending backfill, the synchronization resumes from the last block before the date
+    savedState.round = 6000000;
+    internalPreferences->editor()->putObject<SavedState>("state", savedState)->commit();
+    uv::wait(_account->eraseDataSince(now));
+    EXPECT_EQ(internalPreferences->getObject<SavedState>("state").getValue().round, 5000000);
+}
@@ -0,0 +1,175 @@
+/*
+ *
+ * deffered_tests
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <src/async/Future.hpp>
+#include <src/async/Promise.hpp>
+#include <src/async/algorithm.h>
+#include <src/utils/ImmediateExecutionContext.hpp>
+#include <thread>
+
+using namespace ledger::core;
+
+namespace {
+    // Run a function concurrently on a few threads, all released at the same time
+    template <typename F>
+    void runConcurrently(size_t threadsCount, F f) {
+        std::atomic<bool> go{false};
+        std::vector<std::thread> threads;
+        for (size_t index = 0; index < threadsCount; index++) {
+            threads.emplace_back([&go, &f, index]() {
+                while (!go.load()) {
+                    std::this_thread::yield();
+                }
+                f(index);
+            });
+        }
+        go = true;
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+} // namespace
+
+TEST(Deffered, RunsCallbacksInRegistrationOrder) {
+    Promise<int> promise;
+    std::vector<int> calls;
+    for (auto i = 0; i < 5; i++) {
+        promise.getFuture().onComplete(ImmediateExecutionContext::INSTANCE, [&calls, i](const Try<int> &result) {
+            EXPECT_EQ(result.getValue(), 42);
+            calls.push_back(i);
+        });
+    }
+    EXPECT_TRUE(calls.empty());
+    EXPECT_FALSE(promise.isCompleted());
+    promise.success(42);
+    EXPECT_TRUE(promise.isCompleted());
+    // Callbacks added after the completion run immediately
+    promise.getFuture().onComplete(ImmediateExecutionContext::INSTANCE, [&calls](const Try<int> &) {
+        calls.push_back(5);
+    });
+    EXPECT_EQ(calls, std::vector<int>({0, 1, 2, 3, 4, 5}));
+    EXPECT_EQ(promise.getFuture().getValue().getValue().getValue(), 42);
+}
+
+TEST(Deffered, CompletesOnlyOnce) {
+    Promise<int> promise;
+    EXPECT_TRUE(promise.getFuture().getValue().isEmpty());
+    promise.failure(Exception(api::ErrorCode::INVALID_ARGUMENT, "first"));
+    EXPECT_THROW(promise.success(1), Exception);
+    EXPECT_FALSE(promise.trySuccess(2));
+    auto value = promise.getFuture().getValue();
+    ASSERT_TRUE(value.hasValue());
+    EXPECT_TRUE(value.getValue().isFailure());
+    EXPECT_EQ(value.getValue().getFailure().getErrorCode(), api::ErrorCode::INVALID_ARGUMENT);
+}
+
+TEST(Deffered, CallbacksRegisteredDuringCompletionRunOnce) {
+    for (auto round = 0; round < 200; round++) {
+        Promise<int> promise;
+        std::atomic<int> calls{0};
+        runConcurrently(4, [&](size_t index) {
+            if (index == 0) {
+                promise.success(round);
+                return;
+            }
+            for (auto i = 0; i < 50; i++) {
+                promise.getFuture().onComplete(ImmediateExecutionContext::INSTANCE, [&calls, round](const Try<int> &result) {
+                    EXPECT_EQ(result.getValue(), round);
+                    calls++;
+                });
+            }
+        });
+        EXPECT_EQ(calls.load(), 150);
+    }
+}
+
+TEST(Deffered, DISABLED_BenchmarkChainDepth) {
+    const auto DEPTH = 1000;
+    const auto ROUNDS = 1000;
+    auto start = std::chrono::steady_clock::now();
+    for (auto round = 0; round < ROUNDS; round++) {
+        Promise<int> promise;
+        auto future = promise.getFuture();
+        for (auto i = 0; i < DEPTH; i++) {
+            future = future.map<int>(ImmediateExecutionContext::INSTANCE, [](const int &v) { return v + 1; });
+        }
+        promise.success(0);
+        EXPECT_EQ(future.getValue().getValue().getValue(), DEPTH);
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << "Chain of " << DEPTH << " maps x " << ROUNDS << " : " << elapsed.count() << " s\n";
+}
+
+TEST(Deffered, DISABLED_BenchmarkFanIn) {
+    const auto WIDTH = 1000;
+    const auto ROUNDS = 100;
+    auto start = std::chrono::steady_clock::now();
+    for (auto round = 0; round < ROUNDS; round++) {
+        std::vector<Promise<int>> promises(WIDTH);
+        std::vector<Future<int>> futures;
+        futures.reserve(WIDTH);
+        for (const auto &promise : promises) {
+            futures.push_back(promise.getFuture());
+        }
+        auto all = async::sequence(ImmediateExecutionContext::INSTANCE, futures);
+        for (auto i = 0; i < WIDTH; i++) {
+            promises[i].success(i);
+        }
+        EXPECT_EQ(all.getValue().getValue().getValue().size(), WIDTH);
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << "Sequence of " << WIDTH << " futures x " << ROUNDS << " : " << elapsed.count() << " s\n";
+}
+
+TEST(Deffered, DISABLED_BenchmarkContention) {
+    const auto THREADS = 8;
+    const auto CALLBACKS = 1000;
+    const auto ROUNDS = 1000;
+    std::atomic<int> calls{0};
+    auto start = std::chrono::steady_clock::now();
+    for (auto round = 0; round < ROUNDS; round++) {
+        Promise<int> promise;
+        runConcurrently(THREADS, [&](size_t index) {
+            for (auto i = 0; i < CALLBACKS; i++) {
+                promise.getFuture().onComplete(ImmediateExecutionContext::INSTANCE, [&calls](const Try<int> &) { calls++; });
+                if (index == 0 && i == CALLBACKS / 2) {
+                    promise.success(round);
+                }
+            }
+        });
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_EQ(calls.load(), THREADS * CALLBACKS * ROUNDS);
+    std::cout << THREADS << " threads x " << CALLBACKS << " callbacks x " << ROUNDS << " : " << elapsed.count() << " s\n";
+}
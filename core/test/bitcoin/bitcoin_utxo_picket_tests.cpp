@@ -1,13 +1,20 @@
 #include <api/BitcoinLikeScript.hpp>
 #include <api/KeychainEngines.hpp>
+#include <bitcoin/BitcoinLikeAddress.hpp>
+#include <chrono>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <iostream>
 #include <ledger/core/api/Networks.hpp>
+#include <random>
+#include <set>
 #include <spdlog/sinks/null_sink.h>
+#include <utils/ImmediateExecutionContext.hpp>
 #include <wallet/bitcoin/api_impl/BitcoinLikeScriptApi.h>
 #include <wallet/bitcoin/api_impl/BitcoinLikeTransactionApi.h>
 #include <wallet/bitcoin/scripts/BitcoinLikeScript.h>
 #include <wallet/bitcoin/transaction_builders/BitcoinLikeStrategyUtxoPicker.h>
+#include <wallet/bitcoin/transaction_builders/BitcoinLikeUtxoPool.h>
 #include <wallet/common/Amount.h>
 #include <wallet/currencies.hpp>
 
@@ -311,3 +318,250 @@ TEST(OptimizeSize, FeeIsEnoughForP2TR) {
     for (int64_t feesPerByte = 1; feesPerByte < 1000000; feesPerByte *= 10)
         feeIsEnoughFor(address, targetOutputSizeInBytes, feesPerByte);
 }
+
+TEST(UtxoPool, ReusesLoadedSetUntilInvalidated) {
+    auto utxos = createUtxos({10000, 20000, 30000});
+    BitcoinLikeUtxoPool pool;
+    int loads  = 0;
+    auto load  = [&]() {
+        loads += 1;
+        return utxos;
+    };
+
+    auto first = pool.get(0, load);
+    EXPECT_EQ(pool.get(0, load), first);
+    EXPECT_EQ(loads, 1);
+
+    // A different worthless amount requires a new set
+    pool.get(15000, load);
+    EXPECT_EQ(loads, 2);
+
+    pool.invalidate();
+    EXPECT_NE(pool.get(15000, load), first);
+    EXPECT_EQ(loads, 3);
+}
+
+TEST(UtxoPool, EffectiveViewIsSortedAndCached) {
+    std::vector<Option<uint64_t>> blockHeights = {Option<uint64_t>{}, 100, Option<uint64_t>{}, 200};
+    BitcoinLikeUtxoSet utxos(createUtxos({5000, 1000, 3000, 200}, blockHeights));
+
+    auto view = utxos.getEffectiveView(500, true);
+    ASSERT_EQ(view->utxos.size(), 3);
+    EXPECT_EQ(view->utxos[0].index, 1);
+    EXPECT_EQ(view->utxos[1].index, 0);
+    EXPECT_EQ(view->utxos[2].index, 2);
+    EXPECT_EQ(view->availableValue, 500 + 4500 + 2500);
+    EXPECT_EQ(utxos.getEffectiveView(500, true), view);
+    EXPECT_EQ(utxos.getEffectiveView(500, false)->utxos[0].index, 0);
+}
+
+TEST(UtxoPool, ExcludedUtxosAreNotPicked) {
+    const api::Currency currency = currencies::BITCOIN;
+    auto buddy                   = createBuddy(5, 25000, currency);
+    BitcoinLikeUtxoSet utxos(createUtxos({15000, 5000, 15000, 15000}, std::vector<Option<uint64_t>>(4, Option<uint64_t>{})));
+    std::vector<bool> excluded{false, false, true, false};
+
+    auto pickedUtxos = BitcoinLikeStrategyUtxoPicker::filterWithMergeOutputs(buddy, utxos, excluded, BigInt(-1), currency, false);
+    ASSERT_EQ(pickedUtxos.size(), 3);
+    for (auto const &utxo : pickedUtxos) {
+        EXPECT_NE(utxo.index, 2);
+    }
+}
+
+TEST(UtxoPool, DISABLED_BuildThroughput) {
+    const api::Currency currency = currencies::BITCOIN;
+    std::mt19937_64 random(42);
+    std::uniform_int_distribution<int64_t> values(10000, 10000000);
+
+    auto measure = [](const std::string &label, size_t count, const std::function<void()> &build) {
+        const auto start = std::chrono::steady_clock::now();
+        auto elapsed     = std::chrono::steady_clock::duration::zero();
+        size_t builds    = 0;
+        do {
+            build();
+            builds += 1;
+            elapsed = std::chrono::steady_clock::now() - start;
+        } while (elapsed < std::chrono::seconds(2));
+        const auto seconds = std::chrono::duration<double>(elapsed).count();
+        std::cout << label << " with " << count << " utxos: " << builds / seconds << " builds/s" << std::endl;
+    };
+
+    for (size_t count : {1000, 10000, 100000}) {
+        std::vector<int64_t> amounts;
+        std::vector<Option<uint64_t>> blockHeights;
+        for (size_t i = 0; i < count; i++) {
+            amounts.push_back(values(random));
+            blockHeights.push_back(Option<uint64_t>(i));
+        }
+        auto vector = createUtxos(amounts, blockHeights);
+        auto pooled = std::make_shared<const BitcoinLikeUtxoSet>(vector);
+        auto buddy  = createBuddy(20, 25000000, currency);
+
+        measure("OPTIMIZE_SIZE reloaded", count, [&]() {
+            BitcoinLikeStrategyUtxoPicker::filterWithOptimizeSize(buddy, vector, BigInt(-1), currency, true);
+        });
+        measure("OPTIMIZE_SIZE pooled", count, [&]() {
+            BitcoinLikeStrategyUtxoPicker::filterWithOptimizeSize(buddy, *pooled, {}, BigInt(-1), currency, true);
+        });
+        measure("MERGE_OUTPUTS reloaded", count, [&]() {
+            BitcoinLikeStrategyUtxoPicker::filterWithMergeOutputs(buddy, vector, BigInt(-1), currency, true);
+        });
+        measure("MERGE_OUTPUTS pooled", count, [&]() {
+            BitcoinLikeStrategyUtxoPicker::filterWithMergeOutputs(buddy, *pooled, {}, BigInt(-1), currency, true);
+        });
+        measure("DEEP_OUTPUTS_FIRST reloaded", count, [&]() {
+            BitcoinLikeStrategyUtxoPicker::filterWithDeepFirst(buddy, vector, BigInt(-1), currency);
+        });
+        measure("DEEP_OUTPUTS_FIRST pooled", count, [&]() {
+            BitcoinLikeStrategyUtxoPicker::filterWithDeepFirst(buddy, *pooled, {}, BigInt(-1), currency);
+        });
+    }
+}
+
+namespace {
+    struct BatchFixture {
+        BatchFixture(size_t utxoCount, size_t requestCount, api::BitcoinLikePickingStrategy strategy) : currency(currencies::BITCOIN) {
+            std::vector<BitcoinLikeUtxo> vector;
+            for (uint64_t i = 0; i < utxoCount; i++) {
+                vector.emplace_back(BitcoinLikeUtxo{
+                    i % 2,
+                    std::to_string(i / 2),
+                    Amount(currency, 0, BigInt(100000)),
+                    Option<std::string>("bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t4"),
+                    Option<std::string>{},
+                    "",
+                    Option<uint64_t>(i)});
+            }
+            utxos = std::make_shared<const BitcoinLikeUtxoSet>(vector);
+
+            auto config = std::make_shared<ledger::core::DynamicObject>();
+            config->putString(api::Configuration::KEYCHAIN_ENGINE, api::KeychainEngines::BIP32_P2PKH);
+            keychain = std::make_shared<::testing::NiceMock<MockKeychain>>(config, currency, 0, std::shared_ptr<Preferences>());
+            for (size_t i = 0; i < requestCount; i++) {
+                changeAddresses.push_back(std::make_shared<BitcoinLikeAddress>(currency, std::vector<uint8_t>(20, static_cast<uint8_t>(i)), api::KeychainEngines::BIP32_P2PKH));
+            }
+            auto addresses = changeAddresses;
+            ON_CALL(*keychain, getObservableRangeSize()).WillByDefault(::testing::Return(20));
+            ON_CALL(*keychain, getFreshAddresses(BitcoinLikeKeychain::CHANGE, ::testing::_)).WillByDefault(::testing::Invoke([addresses](BitcoinLikeKeychain::KeyPurpose, size_t n) {
+                return std::vector<BitcoinLikeKeychain::Address>(addresses.begin(), addresses.begin() + std::min(n, addresses.size()));
+            }));
+            ON_CALL(*keychain, getFreshAddress(BitcoinLikeKeychain::CHANGE)).WillByDefault(::testing::Return(changeAddresses.front()));
+
+            for (size_t i = 0; i < requestCount; i++) {
+                BitcoinLikeTransactionBuildRequest request(std::make_shared<BigInt>(0));
+                request.wipe       = false;
+                request.feePerByte = std::make_shared<BigInt>(10);
+                request.outputs.push_back(std::make_tuple(std::make_shared<BigInt>(150000),
+                                                          std::make_shared<BitcoinLikeScriptApi>(BitcoinLikeScript::fromAddress("bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t4", currency))));
+                request.utxoPicker = BitcoinUtxoPickerParams{strategy, 0, optional<int32_t>()};
+                requests.push_back(request);
+            }
+            picker = std::make_shared<BitcoinLikeStrategyUtxoPicker>(ImmediateExecutionContext::INSTANCE, currency, true);
+        }
+
+        BitcoinLikeGetUtxoFunction getUtxo() {
+            auto set   = utxos;
+            auto loads = snapshotLoads;
+            return [set, loads]() {
+                *loads += 1;
+                return Future<std::shared_ptr<const BitcoinLikeUtxoSet>>::successful(set);
+            };
+        }
+
+        api::Currency currency;
+        std::shared_ptr<const BitcoinLikeUtxoSet> utxos;
+        std::shared_ptr<::testing::NiceMock<MockKeychain>> keychain;
+        std::vector<BitcoinLikeKeychain::Address> changeAddresses;
+        std::vector<BitcoinLikeTransactionBuildRequest> requests;
+        std::shared_ptr<BitcoinLikeStrategyUtxoPicker> picker;
+        std::shared_ptr<size_t> snapshotLoads = std::make_shared<size_t>(0);
+    };
+} // namespace
+
+TEST(BatchBuild, SpendsDisjointUtxos) {
+    // Every transaction needs two UTXOs, there is enough for five of them
+    BatchFixture fixture(10, 6, api::BitcoinLikePickingStrategy::OPTIMIZE_SIZE);
+    auto build  = fixture.picker->getBatchBuildFunction(fixture.getUtxo(), BitcoinLikeGetTxFunction(), nullptr, fixture.keychain, 100, spdlog::null_logger_mt("batch_null_sink"), true);
+    auto result = build(fixture.requests).getValue();
+    ASSERT_TRUE(result.hasValue());
+    auto const &transactions = result.getValue().getValue();
+    ASSERT_EQ(transactions.size(), 6);
+
+    std::set<std::string> spent;
+    std::set<std::string> changeAddresses;
+    for (size_t i = 0; i < 5; i++) {
+        ASSERT_TRUE(transactions[i].isSuccess());
+        auto const &tx = transactions[i].getValue();
+        for (auto const &input : tx->getInputs()) {
+            EXPECT_TRUE(spent.insert(input->getPreviousTxHash().value() + ":" + std::to_string(input->getPreviousOutputIndex().value())).second);
+        }
+        ASSERT_EQ(tx->getOutputs().size(), 2);
+        changeAddresses.insert(tx->getOutputs()[1]->getAddress().value());
+    }
+    EXPECT_EQ(spent.size(), 10);
+    EXPECT_EQ(changeAddresses.size(), 5);
+    ASSERT_TRUE(transactions[5].isFailure());
+    EXPECT_EQ(transactions[5].getFailure().getErrorCode(), api::ErrorCode::NOT_ENOUGH_FUNDS);
+}
+
+TEST(BatchBuild, HandsOutChangeAddressesInRequestOrder) {
+    BatchFixture fixture(10, 6, api::BitcoinLikePickingStrategy::OPTIMIZE_SIZE);
+    // The observable range no longer bounds the number of change addresses of a batch
+    ON_CALL(*fixture.keychain, getObservableRangeSize()).WillByDefault(::testing::Return(3));
+    ON_CALL(*fixture.keychain, getAddressDerivationPath(::testing::_)).WillByDefault(::testing::Invoke([&fixture](const std::string &address) {
+        for (size_t i = 0; i < fixture.changeAddresses.size(); i++) {
+            if (fixture.changeAddresses[i]->toString() == address) {
+                return Option<std::string>(fmt::format("44'/0'/0'/1/{}", i));
+            }
+        }
+        return Option<std::string>();
+    }));
+    // The second request can't be funded and must not consume a change address
+    std::get<0>(fixture.requests[1].outputs.front()) = std::make_shared<BigInt>(100000000);
+    EXPECT_CALL(*fixture.keychain, getFreshAddresses(BitcoinLikeKeychain::CHANGE, 5));
+    {
+        // Every change address is marked as used, the observable range is extended once after the last one
+        ::testing::InSequence sequence;
+        for (uint32_t i = 0; i < 4; i++) {
+            EXPECT_CALL(*fixture.keychain, markPathAsUsed(::testing::Property(&DerivationPath::getLastChildNum, i), false));
+        }
+        EXPECT_CALL(*fixture.keychain, markPathAsUsed(::testing::Property(&DerivationPath::getLastChildNum, 4), true));
+    }
+    auto build  = fixture.picker->getBatchBuildFunction(fixture.getUtxo(), BitcoinLikeGetTxFunction(), nullptr, fixture.keychain, 100, spdlog::null_logger_mt("batch_change_null_sink"), true);
+    auto result = build(fixture.requests).getValue();
+    ASSERT_TRUE(result.hasValue());
+    auto const &transactions = result.getValue().getValue();
+    ASSERT_EQ(transactions.size(), 6);
+    ASSERT_TRUE(transactions[1].isFailure());
+
+    // Addresses follow the order of the funded requests
+    const std::vector<size_t> funded = {0, 2, 3, 4, 5};
+    for (size_t i = 0; i < funded.size(); i++) {
+        ASSERT_TRUE(transactions[funded[i]].isSuccess());
+        auto const &outputs = transactions[funded[i]].getValue()->getOutputs();
+        ASSERT_EQ(outputs.size(), 2);
+        EXPECT_EQ(outputs[1]->getAddress().value(), fixture.changeAddresses[i]->toString());
+    }
+}
+
+TEST(BatchBuild, DISABLED_BuildThroughput) {
+    for (size_t count : {100, 1000}) {
+        BatchFixture fixture(count * 4, count, api::BitcoinLikePickingStrategy::DEEP_OUTPUTS_FIRST);
+        auto logger = spdlog::null_logger_mt("batch_throughput_" + std::to_string(count));
+
+        auto start  = std::chrono::steady_clock::now();
+        auto single = fixture.picker->getBuildFunction(fixture.getUtxo(), BitcoinLikeGetTxFunction(), nullptr, fixture.keychain, 100, logger, true);
+        for (auto const &request : fixture.requests) {
+            single(request);
+        }
+        auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << count << " transactions built one by one: " << count / seconds << " tx/s, " << *fixture.snapshotLoads << " UTXO snapshots" << std::endl;
+        *fixture.snapshotLoads = 0;
+
+        start      = std::chrono::steady_clock::now();
+        auto batch = fixture.picker->getBatchBuildFunction(fixture.getUtxo(), BitcoinLikeGetTxFunction(), nullptr, fixture.keychain, 100, logger, true);
+        batch(fixture.requests);
+        seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << count << " transactions built in a batch: " << count / seconds << " tx/s, " << *fixture.snapshotLoads << " UTXO snapshots" << std::endl;
+    }
+}
@@ -0,0 +1,188 @@
+/*
+ *
+ * transaction_parser_tests.cpp
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <bytes/BytesWriter.h>
+#include <chrono>
+#include <crypto/SHA256.hpp>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <utils/hex.h>
+#include <wallet/bitcoin/api_impl/BitcoinLikeTransactionApi.h>
+#include <wallet/bitcoin/networks.hpp>
+#include <wallet/currencies.hpp>
+
+using namespace ledger::core;
+
+namespace {
+    struct RawTransaction {
+        api::Currency currency;
+        std::string hex;
+        std::string hash;
+        int32_t blockHeight;
+    };
+
+    const std::vector<RawTransaction> &mainnetTransactions() {
+        static const std::vector<RawTransaction> transactions{
+            // P2PKH
+            {currencies::BITCOIN,
+             "0100000001c76ec87ab18aa0398a2cbfa68625576fdc3bf276b467fc016010ad675678157d010000006b483045022100e0c4a6449841f4a435b23dc2cd4a6c26a8e12e25783dbd02072332c794012ca202202246876625e726ef9a89f854d59d2aee1787c9807d82d953732e56dbc296657001210212b8ae5848c5ce1422643aed011c9b1cbb7da9a5feba0cad0c130a11e8c4091dffffffff02400d03000000000017a914b800848ce7130e91d55422e1f3d72e813dc250e187b9dc2b00000000001976a9140265b33d266d56c25416d493ccb42992faa3f24a88ac00000000",
+             "",
+             0},
+            // P2SH-P2WPKH
+            {currencies::BITCOIN_TESTNET,
+             "0100000000010182815d16259062c4bc08c4fb3aa985444b7208197cf676212f1b3da93782e19f0100000017160014e4fae08faaa8469c5756fda7fbfde46922a4e7b2ffffffff0280f0fa020000000017a91428242bc4e7266060e084fab55fb70916b605d0b3870f4a9b040000000017a91401445204b7063c76c702501899334d6f7499806d870248304502210085a85a2dec818ece4748c0c9d71640a5703a5eec9112dd58183b048c6a9961cf02201dd0beabc1c3500f75849a046deab9e2d2ce388fff6cb92693508f5ea406471d012103d2f424cd1f60e96241a968b9da3c3f6b780f90538bdf306350b9607c279ad48600000000",
+             "93ae1990d10745e3ab4bf742d4b06bd513e7a26384617a17525851e4e3ed7038",
+             0},
+            // P2WPKH
+            {currencies::BITCOIN,
+             "0100000000010154302828c224cb00c797038d4cbc9e06b5a38d832e879c67de523bd714a8c37c0000000000ffffff00021027000000000000160014bd6df7f5fd8b7d0e1f8dc2873d29277162508c01e82f010000000000160014192381a610b9dda473b2dc3dc0e3e80413dc553002483045022100dc57387b377550476a04f3147d915e57e396ab5ce41f8629f0aebd0f9a472876022025920a6a9d80aa6b31aedd10dfbd16d0b2eb8e449a93b70059e0cec7ac2a40ca012102fbba978d75f5fc4e7987840b78033e0e4797c7776c070037422616e622f8e6dc00000000",
+             "c3dd55c86d02ad9d4b0e748c219fd15b79f21c6d5e38f5fe84a453a7f9e37494",
+             0},
+            // P2WSH
+            {currencies::BITCOIN,
+             "0100000000010180e68831516392fcd100d186b3c2c7b95c80b53c77e77c35ba03a66b429a2a1b0000000000ffffffff028096980000000000220020d9bbfbe56af7c4b7f960a70d7ea107156913d9e5a26b0a71429df5e097ca65378096980000000000220020ba468eea561b26301e4cf69fa34bde4ad60c81e70f059f045ca9a79931004a4d024730440220032521802a76ad7bf74d0e2c218b72cf0cbc867066e2e53db905ba37f130397e02207709e2188ed7f08f4c952d9d13986da504502b8c3be59617e043552f506c46ff83275163ab68210392972e2eb617b2388771abe27235fd5ac44af8e61693261550447a4c3e39da98ac00000000",
+             "94236be7808bc824ae3c531ee4cdf26559d6cf40cb6541f38153c54701fb0ea7",
+             0},
+            // ZCash
+            {currencies::ZCASH,
+             "0100000001f8355b0761296d28e29bd39833fe8c6558120037498dfdedabf41890e65c68dc010000006b483045022100a13ae06b36e3d4e90c7b9265bfff296b98d79c9970d7ef4964eb26d23ab44a5f022024155e86bde7a2322b1395d904c5fa007a925bc02f7d60623bde56a8b09bbb680121032d1d22333719a013313e538557971639f8c167fa5be8089dd2e996d704fb580cffffffff02a0860100000000001976a91407c4358a95e07e570d67857e12086fd6b1ee873688acf24f1600000000001976a9143c1a6afff1941911e0b524ffcd2a15de6e68b6d188ac00000000",
+             "4858a0a3d5f1de0c0f5729f25c3501bda946093aed07f842e53a90ac65d66f70",
+             0},
+            // Stealthcoin with timestamp
+            {currencies::STEALTHCOIN,
+             "01000000ae71115b01f9d2e90eef51048962392b2ac2cbe476aacb06d750e0794aeb5da5a2afaf19da000000006b483045022100be2faab00cc32a4f6f0249d70f3b6d1fc66bf50dcd6ae011d0287a4a581e5c7a02203cd71132619de1e8a1a84c481529f32d4e29b495f835d5b0da7655203a0a7dda01210269568d231762330f7aed9cf0acfb2512f2d7889eb18adb778589ab5cca66fb3dffffffff0200127a00000000001976a914b4949cd1e6c07826ceee84929a7c6babcccc5ec388ac6094b500000000001976a91417cb2228c292d617f98f4b89b448650e0a480e0788ac00000000",
+             "38fcb406a0110c50465edb482bab8d6100e7f9fa7e3ae01e48145c60fd51d00b",
+             0},
+            // Stealthcoin without timestamp, script sigs are not part of the hash
+            {currencies::STEALTHCOIN,
+             "020000000162cd1e8fd9fe9e07a27c969a4fdc74adcb3d01f8b62b918998bc7971070fb1000100000048473044022071051379723e794e5e1f4931755106b6c5fa0ab0b1f8e5fc1a77241d14c428c6022020748197e9d00b379307e0eb2a22d419815faaf96e342ba86d8931b05ac03ab701ffffffff02000000000000000000977ae027000000002321032ce5cc649a30eb4f052bc2ff2080c53781ddb0881a4469f77e060c91d32671f5ac00000000",
+             "c7578a4909c7000403df354ec8ce4a8a7f9074c935c45491f74783fd1cc03c0e",
+             0}};
+        return transactions;
+    }
+
+    // Builds a transaction spending the same input count times
+    std::vector<uint8_t> repeatInput(const std::string &header,
+                                     const std::string &input,
+                                     const std::string &outputs,
+                                     const std::string &witness,
+                                     size_t count) {
+        BytesWriter writer;
+        writer.writeByteArray(hex::toByteArray(header));
+        writer.writeVarInt(count);
+        auto inputBytes = hex::toByteArray(input);
+        for (size_t i = 0; i < count; i++) {
+            writer.writeByteArray(inputBytes);
+        }
+        writer.writeByteArray(hex::toByteArray(outputs));
+        auto witnessBytes = hex::toByteArray(witness);
+        for (size_t i = 0; !witnessBytes.empty() && i < count; i++) {
+            writer.writeByteArray(witnessBytes);
+        }
+        writer.writeLeValue<uint32_t>(0);
+        return writer.toByteArray();
+    }
+
+    std::string txId(const std::vector<uint8_t> &hashedBytes) {
+        auto hash = SHA256::bytesToBytesHash(SHA256::bytesToBytesHash(hashedBytes));
+        std::reverse(hash.begin(), hash.end());
+        return hex::toString(hash);
+    }
+
+    const std::string P2WPKH_INPUT   = "54302828c224cb00c797038d4cbc9e06b5a38d832e879c67de523bd714a8c37c0000000000ffffff00";
+    const std::string P2WPKH_OUTPUTS = "021027000000000000160014bd6df7f5fd8b7d0e1f8dc2873d29277162508c01e82f010000000000160014192381a610b9dda473b2dc3dc0e3e80413dc5530";
+    const std::string P2WPKH_WITNESS = "02483045022100dc57387b377550476a04f3147d915e57e396ab5ce41f8629f0aebd0f9a472876022025920a6a9d80aa6b31aedd10dfbd16d0b2eb8e449a93b70059e0cec7ac2a40ca012102fbba978d75f5fc4e7987840b78033e0e4797c7776c070037422616e622f8e6dc";
+    const std::string XST_OUTPOINT   = "62cd1e8fd9fe9e07a27c969a4fdc74adcb3d01f8b62b918998bc7971070fb10001000000";
+    const std::string XST_SCRIPT_SIG = "48473044022071051379723e794e5e1f4931755106b6c5fa0ab0b1f8e5fc1a77241d14c428c6022020748197e9d00b379307e0eb2a22d419815faaf96e342ba86d8931b05ac03ab701";
+    const std::string XST_OUTPUTS    = "02000000000000000000977ae027000000002321032ce5cc649a30eb4f052bc2ff2080c53781ddb0881a4469f77e060c91d32671f5ac";
+} // namespace
+
+TEST(BitcoinLikeTransactionParser, ParsesMainnetTransactions) {
+    for (const auto &transaction : mainnetTransactions()) {
+        auto tx = BitcoinLikeTransactionApi::parseRawSignedTransaction(transaction.currency, hex::toByteArray(transaction.hex), transaction.blockHeight);
+        EXPECT_EQ(hex::toString(tx->serialize()), transaction.hex);
+        if (!transaction.hash.empty()) {
+            EXPECT_EQ(tx->getHash(), transaction.hash);
+        }
+    }
+}
+
+TEST(BitcoinLikeTransactionParser, HashesLargeSegwitTransaction) {
+    auto rawTx = repeatInput("010000000001", P2WPKH_INPUT, P2WPKH_OUTPUTS, P2WPKH_WITNESS, 300);
+    auto tx    = BitcoinLikeTransactionApi::parseRawSignedTransaction(currencies::BITCOIN, rawTx, 0);
+    EXPECT_EQ(tx->serialize(), rawTx);
+    EXPECT_EQ(tx->getInputs().size(), 300);
+    EXPECT_EQ(tx->getInputs()[299]->getScriptSig(), hex::toByteArray(P2WPKH_WITNESS.substr(2)));
+    // txID ignores marker, flag and witnesses
+    EXPECT_EQ(tx->getHash(), txId(repeatInput("01000000", P2WPKH_INPUT, P2WPKH_OUTPUTS, "", 300)));
+}
+
+TEST(BitcoinLikeTransactionParser, HashesLargeStealthcoinTransactionWithoutScriptSigs) {
+    auto rawTx = repeatInput("02000000", XST_OUTPOINT + XST_SCRIPT_SIG + "ffffffff", XST_OUTPUTS, "", 300);
+    auto tx    = BitcoinLikeTransactionApi::parseRawSignedTransaction(currencies::STEALTHCOIN, rawTx, 0);
+    EXPECT_EQ(tx->serialize(), rawTx);
+    EXPECT_EQ(tx->getHash(), txId(repeatInput("02000000", XST_OUTPOINT + "00" + "ffffffff", XST_OUTPUTS, "", 300)));
+}
+
+TEST(BitcoinLikeTransactionParser, DISABLED_ParseThroughput) {
+    auto measure = [](const std::string &label, const std::vector<std::pair<api::Currency, std::vector<uint8_t>>> &corpus) {
+        size_t bytes = 0;
+        for (const auto &transaction : corpus) {
+            bytes += transaction.second.size();
+        }
+        const auto start = std::chrono::steady_clock::now();
+        auto elapsed     = std::chrono::steady_clock::duration::zero();
+        size_t rounds    = 0;
+        do {
+            for (const auto &transaction : corpus) {
+                BitcoinLikeTransactionApi::parseRawSignedTransaction(transaction.first, transaction.second, 0);
+            }
+            rounds += 1;
+            elapsed = std::chrono::steady_clock::now() - start;
+        } while (elapsed < std::chrono::seconds(2));
+        const auto seconds = std::chrono::duration<double>(elapsed).count();
+        std::cout << label << ": " << rounds * corpus.size() / seconds << " tx/s, "
+                  << rounds * bytes / seconds / 1024 / 1024 << " MiB/s" << std::endl;
+    };
+
+    std::vector<std::pair<api::Currency, std::vector<uint8_t>>> mainnet;
+    for (const auto &transaction : mainnetTransactions()) {
+        mainnet.emplace_back(transaction.currency, hex::toByteArray(transaction.hex));
+    }
+    measure("Mainnet corpus", mainnet);
+
+    for (size_t count : {10, 100, 1000}) {
+        measure("Segwit with " + std::to_string(count) + " inputs",
+                {{currencies::BITCOIN, repeatInput("010000000001", P2WPKH_INPUT, P2WPKH_OUTPUTS, P2WPKH_WITNESS, count)}});
+        measure("Stealthcoin with " + std::to_string(count) + " inputs",
+                {{currencies::STEALTHCOIN, repeatInput("02000000", XST_OUTPOINT + XST_SCRIPT_SIG + "ffffffff", XST_OUTPUTS, "", count)}});
+    }
+}
@@ -0,0 +1,191 @@
+/*
+ *
+ * synchronization_benchmarks.cpp
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "StellarFixture.hpp"
+
+#include <api/Configuration.hpp>
+#include <api/HttpReadBodyResult.hpp>
+#include <api/HttpRequest.hpp>
+#include <chrono>
+#include <collections/DynamicObject.hpp>
+#include <iostream>
+#include <mutex>
+#include <proxy-http-client/FakeUrlConnection.hpp>
+#include <utils/LambdaRunnable.hpp>
+#include <wallet/common/OperationQuery.h>
+
+namespace {
+    const int64_t HORIZON_LATENCY_MS = 150;
+
+    // Hands the response body of a real Horizon request to a callback before completing it
+    class RecordingHttpRequest : public api::HttpRequest {
+      public:
+        RecordingHttpRequest(const std::shared_ptr<api::HttpRequest> &request,
+                             std::function<void(const std::string &)> record) : _request(request), _record(record) {}
+
+        api::HttpMethod getMethod() override {
+            return _request->getMethod();
+        }
+
+        std::unordered_map<std::string, std::string> getHeaders() override {
+            return _request->getHeaders();
+        }
+
+        std::vector<uint8_t> getBody() override {
+            return _request->getBody();
+        }
+
+        std::string getUrl() override {
+            return _request->getUrl();
+        }
+
+        void complete(const std::shared_ptr<api::HttpUrlConnection> &response,
+                      const std::experimental::optional<api::Error> &error) override {
+            if (error || !response) {
+                _request->complete(response, error);
+                return;
+            }
+            std::string body;
+            while (true) {
+                auto chunk = response->readBody();
+                if (chunk.error || !chunk.data || chunk.data->empty()) {
+                    break;
+                }
+                body.append(chunk.data->begin(), chunk.data->end());
+            }
+            _record(body);
+            _request->complete(FakeUrlConnection::fromString(body), error);
+        }
+
+      private:
+        std::shared_ptr<api::HttpRequest> _request;
+        std::function<void(const std::string &)> _record;
+    };
+
+    // Local Horizon stand-in: records the pages served by Horizon once, then replays them after a fixed delay
+    class RecordedHorizonHttpClient : public api::HttpClient {
+      public:
+        RecordedHorizonHttpClient(const std::shared_ptr<api::HttpClient> &horizon,
+                                  const std::shared_ptr<api::ExecutionContext> &context,
+                                  int64_t latency) : _horizon(horizon), _context(context), _latency(latency) {}
+
+        void execute(const std::shared_ptr<api::HttpRequest> &request) override {
+            auto url = request->getUrl();
+            std::shared_ptr<FakeUrlConnection> page;
+            {
+                std::lock_guard<std::mutex> lock(_lock);
+                auto it = _pages.find(url);
+                if (it != _pages.end()) {
+                    page = it->second;
+                }
+            }
+            if (!page) {
+                _horizon->execute(std::make_shared<RecordingHttpRequest>(request, [this, url](const std::string &body) {
+                    std::lock_guard<std::mutex> lock(_lock);
+                    _pages[url] = FakeUrlConnection::fromString(body);
+                }));
+                return;
+            }
+            _context->delay(make_runnable([request, page]() {
+                                request->complete(page, std::experimental::nullopt);
+                            }),
+                            _latency);
+        }
+
+      private:
+        std::shared_ptr<api::HttpClient> _horizon;
+        std::shared_ptr<api::ExecutionContext> _context;
+        int64_t _latency;
+        std::mutex _lock;
+        std::unordered_map<std::string, std::shared_ptr<FakeUrlConnection>> _pages;
+    };
+} // namespace
+
+class StellarSynchronizationBenchmark : public StellarFixture {
+  public:
+    void SetUp() override {
+        StellarFixture::SetUp();
+        horizon = std::make_shared<RecordedHorizonHttpClient>(http, dispatcher->getSerialExecutionContext("horizon_latency"), HORIZON_LATENCY_MS);
+    }
+
+    std::shared_ptr<WalletPool> newPool(std::string poolName) override {
+        auto configuration = api::DynamicObject::newInstance();
+        configuration->putString(api::PoolConfiguration::DATABASE_NAME, getPostgresUrl());
+        return WalletPool::newInstance(poolName,
+                                       "",
+                                       horizon,
+                                       ws,
+                                       resolver,
+                                       printer,
+                                       dispatcher,
+                                       rng,
+                                       backend,
+                                       configuration,
+                                       std::make_shared<ledger::core::test::MemPreferencesBackend>(),
+                                       std::make_shared<ledger::core::test::MemPreferencesBackend>(),
+                                       std::make_shared<ledger::core::test::ProxyCoreTracer>());
+    }
+
+    // Synchronize the same account twice: once to record Horizon pages, once against the recording
+    void benchmark(int32_t pageSize) {
+        std::chrono::duration<double> elapsed{};
+        size_t operations = 0;
+        for (auto pass = 0; pass < 2; pass++) {
+            auto pool          = newPool(fmt::format("stellar_benchmark_{}_{}", pageSize, pass));
+            auto configuration = api::DynamicObject::newInstance();
+            configuration->putInt(api::Configuration::BLOCKCHAIN_EXPLORER_PAGE_SIZE, pageSize);
+            auto wallet  = newWallet(pool, "stellar_benchmark", "stellar", configuration);
+            auto account = newAccount(wallet, 0, accountInfoFromAddress("GDDU4HHNCSZ2BI6ELSSFKPSOBL2TEB4A3ZJWOCT2DILQKVJTZBNSOZA2"));
+
+            auto start = std::chrono::steady_clock::now();
+            ASSERT_TRUE(synchronizeAccount(account).isSuccess());
+            elapsed    = std::chrono::steady_clock::now() - start;
+            operations = uv::wait(std::dynamic_pointer_cast<OperationQuery>(account->queryOperations()->partial())->execute()).size();
+            uv::wait(pool->freshResetAll());
+        }
+        std::cout << "Page size " << pageSize << ": synchronized " << operations << " operations in " << elapsed.count()
+                  << " s (Horizon latency " << HORIZON_LATENCY_MS << " ms)" << std::endl;
+    }
+
+    std::shared_ptr<RecordedHorizonHttpClient> horizon;
+};
+
+TEST_F(StellarSynchronizationBenchmark, DISABLED_PageSize10) {
+    benchmark(10);
+}
+
+TEST_F(StellarSynchronizationBenchmark, DISABLED_PageSize50) {
+    benchmark(50);
+}
+
+TEST_F(StellarSynchronizationBenchmark, DISABLED_PageSize200) {
+    benchmark(200);
+}
@@ -45,6 +45,7 @@
 #include <gtest/gtest.h>
 #include <src/api/DynamicObject.hpp>
 #include <src/database/DatabaseSessionPool.hpp>
+#include <src/database/StatementCache.hpp>
 #include <src/wallet/pool/WalletPool.hpp>
 #include <unordered_set>
 
@@ -94,6 +95,57 @@ TEST(DatabaseSessionPool, OpenAndMigrateForTheFirstTime) {
     resolver->clean();
 }
 
+namespace {
+    struct CountPoolsBinding {
+        int count;
+    };
+
+    const auto COUNT_POOLS = db::stmt<CountPoolsBinding>("SELECT COUNT(*) FROM pools", [](auto &s, auto &b) {
+        s, soci::into(b.count);
+    });
+
+    int countPools(soci::session &sql) {
+        return db::withStatement(sql, COUNT_POOLS, [](PreparedStatement<CountPoolsBinding> &stmt) {
+            stmt.execute();
+            return stmt.bindings.count;
+        });
+    }
+} // namespace
+
+TEST(DatabaseSessionPool, CachePreparedStatementsPerConnection) {
+    auto dispatcher = std::make_shared<uv::UvThreadDispatcher>();
+    auto resolver   = std::make_shared<NativePathResolver>();
+    auto backend    = std::static_pointer_cast<DatabaseBackend>(DatabaseBackend::getPostgreSQLBackend(api::ConfigurationDefaults::DEFAULT_PG_CONNECTION_POOL_SIZE, api::ConfigurationDefaults::DEFAULT_PG_CONNECTION_POOL_SIZE));
+
+    DatabaseSessionPool::getSessionPool(dispatcher->getSerialExecutionContext("worker"), backend, resolver, std::make_shared<ledger::core::test::ProxyCoreTracer>(), nullptr, getPostgresUrl())
+        .onComplete(dispatcher->getMainExecutionContext(), [&](const TryPtr<DatabaseSessionPool> &result) {
+            EXPECT_TRUE(result.isSuccess());
+            if (result.isFailure()) {
+                std::cerr << result.getFailure().getMessage() << std::endl;
+            } else {
+                soci::session sql(result.getValue()->getPool());
+                auto cache = StatementCache::of(sql);
+                EXPECT_NE(cache, nullptr);
+                if (cache) {
+                    for (auto i = 0; i < 3; i++) {
+                        EXPECT_EQ(countPools(sql), 0);
+                    }
+                    EXPECT_EQ(cache->size(), 1);
+                    EXPECT_EQ(cache->getStats().misses, 1);
+                    EXPECT_EQ(cache->getStats().hits, 2);
+
+                    // Migrations drop the cached statements
+                    result.getValue()->invalidateStatementCaches();
+                    EXPECT_EQ(countPools(sql), 0);
+                    EXPECT_EQ(cache->getStats().misses, 2);
+                }
+            }
+            dispatcher->stop();
+        });
+    dispatcher->waitUntilStopped();
+    resolver->clean();
+}
+
 TEST(DatabaseSessionPool, InitializeCurrencies) {
     auto dispatcher                                   = std::make_shared<uv::UvThreadDispatcher>();
     auto resolver                                     = std::make_shared<NativePathResolver>();
@@ -33,11 +33,54 @@
 #include "../fixtures/testnet_xpub_fixtures.h"
 #include "BaseFixture.h"
 
+#include <algorithm>
 #include <api/KeychainEngines.hpp>
+#include <chrono>
+#include <fmt/format.h>
 #include <iostream>
+#include <unordered_set>
 #include <utils/DateUtils.hpp>
 #include <wallet/common/OperationQuery.h>
+#include <wallet/common/api_impl/OperationApi.h>
+#include <wallet/bitcoin/database/BitcoinLikeUTXODatabaseHelper.h>
+#include <wallet/common/database/BalanceCheckpointDatabaseHelper.h>
 using namespace std;
+
+namespace {
+    // Unspent outputs computed from scratch, as they were before bitcoin_utxos existed
+    int64_t countUnspentOutputsFromInputs(soci::session &sql, const std::string &accountUid) {
+        int64_t count = 0;
+        sql << "SELECT COUNT(*) FROM bitcoin_outputs AS o "
+               "LEFT OUTER JOIN bitcoin_inputs AS i ON i.previous_tx_uid = o.transaction_uid "
+               "AND i.previous_output_idx = o.idx "
+               "WHERE i.previous_tx_uid IS NULL AND o.account_uid = :uid",
+            soci::use(accountUid), soci::into(count);
+        return count;
+    }
+
+    int64_t countMaterializedUnspentOutputs(soci::session &sql, const std::string &accountUid) {
+        int64_t count = 0;
+        sql << "SELECT COUNT(*) FROM bitcoin_utxos WHERE account_uid = :uid", soci::use(accountUid), soci::into(count);
+        return count;
+    }
+    // Compares the balance history served from the checkpoints with the one folding every operation
+    void expectHistoryMatchesFullRecompute(const std::shared_ptr<WalletPool> &pool, const std::shared_ptr<BitcoinLikeAccount> &account) {
+        auto fromDate = "2015-01-01T00:00:00Z";
+        auto toDate   = DateUtils::toJSON(DateUtils::now());
+        auto history  = uv::wait(account->getBalanceHistory(fromDate, toDate, api::TimePeriod::WEEK));
+        {
+            soci::session sql(pool->getDatabaseSessionPool()->getPool());
+            BalanceCheckpointDatabaseHelper::removeCheckpoints(sql, account->getAccountUid());
+        }
+        auto expected = uv::wait(account->getBalanceHistory(fromDate, toDate, api::TimePeriod::WEEK));
+        ASSERT_EQ(history.size(), expected.size());
+        for (size_t i = 0; i < history.size(); i++) {
+            EXPECT_EQ(history[i]->toLong(), expected[i]->toLong());
+        }
+        // Checkpoints are saved again by the next insertion
+        account->bulkInsert({});
+    }
+} // namespace
 class AccountsPublicInterfaceTest : public BaseFixture {
   public:
     void SetUp() override {
@@ -86,6 +129,61 @@ TEST_F(AccountsPublicInterfaceTest, GetBalanceOnAccountWithSomeTxs) {
     EXPECT_EQ(uxtoCount, 8);
 }
 
+TEST_F(AccountsPublicInterfaceTest, UtxoSetFollowsInsertionsAndErasure) {
+    auto account = ledger::testing::medium_xpub::inflate(pool, wallet);
+    soci::session sql(pool->getDatabaseSessionPool()->getPool());
+    const auto accountUid = account->getAccountUid();
+    EXPECT_GT(countMaterializedUnspentOutputs(sql, accountUid), 0);
+    EXPECT_EQ(countMaterializedUnspentOutputs(sql, accountUid), countUnspentOutputsFromInputs(sql, accountUid));
+
+    // Erasing the most recent operations makes the outputs they spent unspent again
+    auto operations = uv::wait(std::dynamic_pointer_cast<OperationQuery>(account->queryOperations()->partial())->execute());
+    ASSERT_GT(operations.size(), 2);
+    std::vector<std::chrono::system_clock::time_point> dates;
+    for (const auto &operation : operations) {
+        dates.push_back(operation->getDate());
+    }
+    std::sort(dates.begin(), dates.end());
+    auto code = uv::wait(account->eraseDataSince(dates[dates.size() / 2]));
+    EXPECT_EQ(code, api::ErrorCode::FUTURE_WAS_SUCCESSFULL);
+    EXPECT_EQ(countMaterializedUnspentOutputs(sql, accountUid), countUnspentOutputsFromInputs(sql, accountUid));
+    EXPECT_EQ(BitcoinLikeUTXODatabaseHelper::UTXOcount(sql, accountUid, 0),
+              BitcoinLikeUTXODatabaseHelper::queryAllUtxos(sql, accountUid, wallet->getCurrency(), 0).size());
+}
+
+TEST_F(AccountsPublicInterfaceTest, DISABLED_UtxoSetBenchmark) {
+    static const int OUTPUTS_COUNT = 500000;
+
+    auto account = std::dynamic_pointer_cast<BitcoinLikeAccount>(uv::wait(wallet->newAccountWithExtendedKeyInfo(ledger::testing::medium_xpub::XPUB_INFO)));
+    auto model   = *JSONUtils::parse<TransactionParser>(ledger::testing::medium_xpub::TX_1);
+    const auto accountUid = account->getAccountUid();
+    soci::session sql(pool->getDatabaseSessionPool()->getPool());
+    for (auto index = 0; countMaterializedUnspentOutputs(sql, accountUid) < OUTPUTS_COUNT; index++) {
+        std::vector<Operation> operations;
+        for (auto batch = 0; batch < 1000; batch++) {
+            auto tx       = model;
+            tx.hash       = fmt::format("{:064x}", index * 1000 + batch);
+            tx.receivedAt = model.receivedAt + std::chrono::seconds(index * 1000 + batch);
+            // Fresh outputs only, nothing of the account is spent
+            tx.inputs.clear();
+            account->interpretTransaction(tx, operations, true);
+        }
+        ASSERT_FALSE(operations.empty());
+        account->bulkInsert(operations);
+    }
+
+    auto measure = [](const std::string &name, const std::function<void()> &f) {
+        auto start = std::chrono::steady_clock::now();
+        f();
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        std::cout << name << ": " << elapsed.count() << "ms" << std::endl;
+    };
+    measure("count from inputs (previous query)", [&]() { countUnspentOutputsFromInputs(sql, accountUid); });
+    measure("UTXOcount", [&]() { BitcoinLikeUTXODatabaseHelper::UTXOcount(sql, accountUid, 0); });
+    measure("queryAllUtxos", [&]() { BitcoinLikeUTXODatabaseHelper::queryAllUtxos(sql, accountUid, wallet->getCurrency(), 0); });
+    measure("updateBalance", [&]() { BitcoinLikeUTXODatabaseHelper::updateBalance(sql, accountUid); });
+}
+
 TEST_F(AccountsPublicInterfaceTest, GetBalanceHistoryOnAccountWithSomeTxs) {
     auto account        = ledger::testing::medium_xpub::inflate(pool, wallet);
     auto fromDate       = "2017-10-12T13:38:23Z";
@@ -95,6 +193,82 @@ TEST_F(AccountsPublicInterfaceTest, GetBalanceHistoryOnAccountWithSomeTxs) {
     EXPECT_EQ(balanceHistory[balanceHistory.size() - 1]->toLong(), balance->toLong());
 }
 
+TEST_F(AccountsPublicInterfaceTest, GetBalanceHistoryResumesFromCheckpoint) {
+    auto account  = ledger::testing::medium_xpub::inflate(pool, wallet);
+    auto fromDate = "2017-10-12T13:38:23Z";
+    auto toDate   = DateUtils::toJSON(DateUtils::now());
+    auto expected = uv::wait(account->getBalanceHistory(fromDate, toDate, api::TimePeriod::MONTH));
+
+    // A checkpoint older than every operation only offsets the history by its balance
+    {
+        soci::session sql(pool->getDatabaseSessionPool()->getPool());
+        BalanceCheckpointDatabaseHelper::putCheckpoint(sql, account->getAccountUid(), BalanceCheckpoint{DateUtils::fromJSON("2000-01-01T00:00:00Z"), BigInt(1000)});
+    }
+    auto balanceHistory = uv::wait(account->getBalanceHistory(fromDate, toDate, api::TimePeriod::MONTH));
+    ASSERT_EQ(balanceHistory.size(), expected.size());
+    for (size_t i = 0; i < balanceHistory.size(); i++) {
+        EXPECT_EQ(balanceHistory[i]->toLong(), expected[i]->toLong() + 1000);
+    }
+
+    // Erasing operations invalidates the checkpoints settled after the erased ones
+    auto code = uv::wait(account->eraseDataSince(DateUtils::fromJSON("1999-01-01T00:00:00Z")));
+    EXPECT_EQ(code, api::ErrorCode::FUTURE_WAS_SUCCESSFULL);
+    soci::session sql(pool->getDatabaseSessionPool()->getPool());
+    EXPECT_TRUE(BalanceCheckpointDatabaseHelper::getLatestCheckpoint(sql, account->getAccountUid(), DateUtils::now()).isEmpty());
+}
+
+TEST_F(AccountsPublicInterfaceTest, BalanceCheckpointsAreSavedBySynchronization) {
+    auto account = ledger::testing::medium_xpub::inflate(pool, wallet);
+    {
+        soci::session sql(pool->getDatabaseSessionPool()->getPool());
+        EXPECT_TRUE(BalanceCheckpointDatabaseHelper::getLatestCheckpoint(sql, account->getAccountUid()).nonEmpty());
+    }
+    expectHistoryMatchesFullRecompute(pool, account);
+}
+
+TEST_F(AccountsPublicInterfaceTest, BalanceCheckpointsFollowReorganizations) {
+    auto account    = ledger::testing::medium_xpub::inflate(pool, wallet);
+    auto operations = uv::wait(std::dynamic_pointer_cast<OperationQuery>(account->queryOperations()->partial())->execute());
+    ASSERT_GT(operations.size(), 2);
+    std::vector<std::chrono::system_clock::time_point> dates;
+    for (const auto &operation : operations) {
+        dates.push_back(operation->getDate());
+    }
+    std::sort(dates.begin(), dates.end());
+    auto code = uv::wait(account->eraseDataSince(dates[dates.size() / 2]));
+    EXPECT_EQ(code, api::ErrorCode::FUTURE_WAS_SUCCESSFULL);
+    {
+        soci::session sql(pool->getDatabaseSessionPool()->getPool());
+        auto latest = BalanceCheckpointDatabaseHelper::getLatestCheckpoint(sql, account->getAccountUid());
+        EXPECT_TRUE(latest.isEmpty() || latest.getValue().date < dates[dates.size() / 2]);
+    }
+    expectHistoryMatchesFullRecompute(pool, account);
+}
+
+TEST_F(AccountsPublicInterfaceTest, BalanceCheckpointsFollowMempoolDrops) {
+    auto account = ledger::testing::medium_xpub::inflate(pool, wallet);
+    auto tx      = *JSONUtils::parse<TransactionParser>(ledger::testing::medium_xpub::TX_1);
+    tx.hash      = fmt::format("{:064x}", 1);
+    tx.block     = Option<BitcoinLikeBlockchainExplorer::Block>();
+    std::vector<Operation> operations;
+    account->interpretTransaction(tx, operations, true);
+    ASSERT_FALSE(operations.empty());
+    account->bulkInsert(operations);
+
+    soci::session sql(pool->getDatabaseSessionPool()->getPool());
+    // Checkpoints never cover an operation not yet in a block
+    auto latest = BalanceCheckpointDatabaseHelper::getLatestCheckpoint(sql, account->getAccountUid());
+    EXPECT_TRUE(latest.isEmpty() || latest.getValue().date < tx.receivedAt);
+    expectHistoryMatchesFullRecompute(pool, account);
+
+    // Dropped from the mempool, the same way as the synchronizers do
+    for (const auto &operation : operations) {
+        BalanceCheckpointDatabaseHelper::invalidateOperationCheckpoints(sql, operation.uid);
+        sql << "DELETE FROM operations WHERE uid = :uid", soci::use(operation.uid);
+    }
+    expectHistoryMatchesFullRecompute(pool, account);
+}
+
 TEST_F(AccountsPublicInterfaceTest, QueryOperations) {
     auto account    = ledger::testing::medium_xpub::inflate(pool, wallet);
     auto query      = std::dynamic_pointer_cast<ledger::core::OperationQuery>(account->queryOperations()->limit(100)->partial());
@@ -102,6 +276,169 @@ TEST_F(AccountsPublicInterfaceTest, QueryOperations) {
     EXPECT_EQ(operations.size(), 100);
 }
 
+TEST_F(AccountsPublicInterfaceTest, QueryCompleteOperationsMatchesSingleInflation) {
+    auto account    = ledger::testing::medium_xpub::inflate(pool, wallet);
+    auto query      = std::dynamic_pointer_cast<ledger::core::OperationQuery>(account->queryOperations()->complete());
+    auto operations = uv::wait(query->execute());
+    ASSERT_GT(operations.size(), 0);
+
+    soci::session sql(pool->getDatabaseSessionPool()->getPool());
+    for (const auto &operation : operations) {
+        const auto &backend = std::dynamic_pointer_cast<OperationApi>(operation)->getBackend();
+        ASSERT_TRUE(backend.bitcoinTransaction.nonEmpty());
+        const auto &batched = backend.bitcoinTransaction.getValue();
+
+        BitcoinLikeBlockchainExplorerTransaction expected;
+        ASSERT_TRUE(BitcoinLikeTransactionDatabaseHelper::getTransactionByHash(sql, batched.hash, account->getAccountUid(), expected));
+        EXPECT_EQ(batched.receivedAt, expected.receivedAt);
+        EXPECT_EQ(batched.block.nonEmpty(), expected.block.nonEmpty());
+        ASSERT_EQ(batched.inputs.size(), expected.inputs.size());
+        for (size_t i = 0; i < expected.inputs.size(); i++) {
+            EXPECT_EQ(batched.inputs[i].index, expected.inputs[i].index);
+            EXPECT_EQ(batched.inputs[i].previousTxHash, expected.inputs[i].previousTxHash);
+            EXPECT_EQ(batched.inputs[i].address, expected.inputs[i].address);
+        }
+        ASSERT_EQ(batched.outputs.size(), expected.outputs.size());
+        for (size_t i = 0; i < expected.outputs.size(); i++) {
+            EXPECT_EQ(batched.outputs[i].index, expected.outputs[i].index);
+            EXPECT_EQ(batched.outputs[i].value.toString(), expected.outputs[i].value.toString());
+            EXPECT_EQ(batched.outputs[i].address, expected.outputs[i].address);
+        }
+    }
+}
+
+TEST_F(AccountsPublicInterfaceTest, DISABLED_QueryCompleteOperationsBenchmark) {
+    static const int TRANSACTIONS_COUNT = 50000;
+    static const int PAGE_SIZE          = 500;
+
+    auto account = std::dynamic_pointer_cast<BitcoinLikeAccount>(uv::wait(wallet->newAccountWithExtendedKeyInfo(ledger::testing::medium_xpub::XPUB_INFO)));
+    auto model   = *JSONUtils::parse<TransactionParser>(ledger::testing::medium_xpub::TX_1);
+    std::vector<Operation> operations;
+    for (auto index = 0; index < TRANSACTIONS_COUNT; index++) {
+        auto tx       = model;
+        tx.hash       = fmt::format("{:064x}", index);
+        tx.receivedAt = model.receivedAt + std::chrono::seconds(index);
+        account->interpretTransaction(tx, operations, true);
+    }
+    account->bulkInsert(operations);
+
+    auto pageThrough = [&](bool complete) {
+        auto start   = std::chrono::steady_clock::now();
+        size_t count = 0;
+        for (auto offset = 0;; offset += PAGE_SIZE) {
+            auto query = account->queryOperations()->offset(offset)->limit(PAGE_SIZE);
+            query      = complete ? query->complete() : query->partial();
+            auto page  = uv::wait(std::dynamic_pointer_cast<OperationQuery>(query)->execute());
+            count += page.size();
+            if (page.size() < static_cast<size_t>(PAGE_SIZE)) {
+                break;
+            }
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        std::cout << (complete ? "complete" : "partial") << ": " << count << " operations in " << elapsed.count() << "ms" << std::endl;
+    };
+    pageThrough(false);
+    pageThrough(true);
+}
+
+TEST_F(AccountsPublicInterfaceTest, QueryOperationsWithCursor) {
+    auto account  = ledger::testing::medium_xpub::inflate(pool, wallet);
+    auto expected = uv::wait(std::dynamic_pointer_cast<OperationQuery>(account->queryOperations()->partial())->execute());
+    ASSERT_GT(expected.size(), 7);
+
+    auto walk = [&](OperationCursor::Key key, bool descending, const OperationProjection &projection) {
+        auto query  = std::dynamic_pointer_cast<OperationQuery>(account->queryOperations()->partial());
+        auto cursor = query->cursor(key, descending, 7, projection);
+        std::vector<std::shared_ptr<api::Operation>> operations;
+        while (cursor->hasNext()) {
+            auto chunk = uv::wait(cursor->next());
+            EXPECT_LE(chunk.size(), 7);
+            operations.insert(operations.end(), chunk.begin(), chunk.end());
+        }
+        EXPECT_TRUE(uv::wait(cursor->next()).empty());
+        return operations;
+    };
+
+    auto byDate = walk(OperationCursor::Key::DATE, false, OperationProjection());
+    ASSERT_EQ(byDate.size(), expected.size());
+    std::unordered_set<std::string> uids;
+    for (size_t i = 0; i < byDate.size(); i++) {
+        uids.insert(byDate[i]->getUid());
+        EXPECT_FALSE(byDate[i]->getRecipients().empty());
+        if (i > 0) {
+            EXPECT_LE(byDate[i - 1]->getDate(), byDate[i]->getDate());
+        }
+    }
+    EXPECT_EQ(uids.size(), expected.size());
+
+    OperationProjection projection;
+    projection.senders    = false;
+    projection.recipients = false;
+    auto byHeight         = walk(OperationCursor::Key::BLOCK_HEIGHT, true, projection);
+    ASSERT_EQ(byHeight.size(), expected.size());
+    for (size_t i = 0; i < byHeight.size(); i++) {
+        EXPECT_TRUE(byHeight[i]->getSenders().empty());
+        EXPECT_TRUE(byHeight[i]->getRecipients().empty());
+        // Pending operations have the highest height, so they come first in descending order
+        auto height = byHeight[i]->getBlockHeight();
+        if (i > 0 && !height) {
+            EXPECT_FALSE(byHeight[i - 1]->getBlockHeight());
+        }
+        if (i > 0 && height) {
+            auto previous = byHeight[i - 1]->getBlockHeight();
+            if (previous) {
+                EXPECT_GE(previous.value(), height.value());
+            }
+        }
+    }
+
+    EXPECT_TRUE(account->queryOperations()->cursor(api::OperationOrderKey::DATE, false, 7)->hasNext());
+    EXPECT_THROW(account->queryOperations()->cursor(api::OperationOrderKey::AMOUNT, false, 7), Exception);
+}
+
+TEST_F(AccountsPublicInterfaceTest, DISABLED_QueryOperationsDeepPageBenchmark) {
+    static const int TRANSACTIONS_COUNT = 200000;
+    static const int PAGE_SIZE          = 500;
+
+    auto account = std::dynamic_pointer_cast<BitcoinLikeAccount>(uv::wait(wallet->newAccountWithExtendedKeyInfo(ledger::testing::medium_xpub::XPUB_INFO)));
+    auto model   = *JSONUtils::parse<TransactionParser>(ledger::testing::medium_xpub::TX_1);
+    std::vector<Operation> operations;
+    for (auto index = 0; index < TRANSACTIONS_COUNT; index++) {
+        auto tx       = model;
+        tx.hash       = fmt::format("{:064x}", index);
+        tx.receivedAt = model.receivedAt + std::chrono::seconds(index);
+        account->interpretTransaction(tx, operations, true);
+    }
+    account->bulkInsert(operations);
+
+    // Latency of each page as the walk goes deeper, OFFSET scans all the rows before the page
+    auto report = [](const std::string &name, const std::vector<std::chrono::microseconds> &latencies) {
+        std::cout << name << ": first page " << latencies.front().count() << "us, last page " << latencies.back().count()
+                  << "us, " << latencies.size() << " pages" << std::endl;
+    };
+
+    std::vector<std::chrono::microseconds> offsetLatencies;
+    for (auto offset = 0;; offset += PAGE_SIZE) {
+        auto query = account->queryOperations()->addOrder(api::OperationOrderKey::DATE, false)->offset(offset)->limit(PAGE_SIZE)->partial();
+        auto start = std::chrono::steady_clock::now();
+        auto page  = uv::wait(std::dynamic_pointer_cast<OperationQuery>(query)->execute());
+        offsetLatencies.push_back(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start));
+        if (page.size() < static_cast<size_t>(PAGE_SIZE)) {
+            break;
+        }
+    }
+    report("offset", offsetLatencies);
+
+    std::vector<std::chrono::microseconds> cursorLatencies;
+    auto cursor = std::dynamic_pointer_cast<OperationQuery>(account->queryOperations()->partial())->cursor(OperationCursor::Key::DATE, false, PAGE_SIZE);
+    while (cursor->hasNext()) {
+        auto start = std::chrono::steady_clock::now();
+        uv::wait(cursor->next());
+        cursorLatencies.push_back(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start));
+    }
+    report("cursor", cursorLatencies);
+}
+
 TEST_F(AccountsPublicInterfaceTest, QueryOperationsOnEmptyAccount) {
     auto account    = createBitcoinLikeAccount(wallet, 0, P2PKH_MEDIUM_XPUB_INFO);
     auto query      = std::dynamic_pointer_cast<ledger::core::OperationQuery>(account->queryOperations()->limit(100)->partial());
@@ -0,0 +1,178 @@
+/*
+ *
+ * bulk_insert_benchmarks.cpp
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#include "../common/test_config.h"
+#include "../fixtures/medium_xpub_fixtures.h"
+#include "BaseFixture.h"
+
+#include <api/PoolConfiguration.hpp>
+#include <chrono>
+#include <fmt/format.h>
+#include <iostream>
+#include <wallet/bitcoin/database/BitcoinLikeOperationDatabaseHelper.hpp>
+
+namespace {
+    const size_t OPERATION_COUNT = 20000;
+    const size_t BATCH_SIZE      = 1000;
+
+    const std::vector<std::string> TABLES = {
+        "blocks", "operations", "bitcoin_operations", "bitcoin_transactions",
+        "bitcoin_inputs", "bitcoin_transaction_inputs", "bitcoin_outputs"};
+
+    int64_t countRows(soci::session &sql) {
+        int64_t total = 0;
+        for (const auto &table : TABLES) {
+            int64_t count = 0;
+            sql << "SELECT COUNT(*) FROM " << table, soci::into(count);
+            total += count;
+        }
+        return total;
+    }
+
+    std::vector<std::string> dumpRows(soci::session &sql) {
+        std::vector<std::string> dump;
+        for (const auto &table : TABLES) {
+            soci::rowset<std::string> rows = (sql.prepare << "SELECT CAST(t AS TEXT) FROM " << table << " t ORDER BY 1");
+            for (const auto &row : rows) {
+                dump.push_back(table + " " + row);
+            }
+        }
+        return dump;
+    }
+} // namespace
+
+class BitcoinLikeBulkInsertBenchmark : public BaseFixture {
+  public:
+    std::shared_ptr<WalletPool> newPostgresPool() {
+        auto poolConfiguration = DynamicObject::newInstance();
+        poolConfiguration->putString(api::PoolConfiguration::DATABASE_NAME, getPostgresUrl());
+        return newDefaultPool("postgres", "", poolConfiguration);
+    }
+
+    std::vector<Operation> interpretTemplates(const std::shared_ptr<WalletPool> &pool) {
+        auto wallet  = uv::wait(pool->createWallet(randomWalletName(), "bitcoin", DynamicObject::newInstance()));
+        auto account = std::dynamic_pointer_cast<BitcoinLikeAccount>(uv::wait(wallet->newAccountWithExtendedKeyInfo(ledger::testing::medium_xpub::XPUB_INFO)));
+
+        std::vector<Operation> templates;
+        for (const auto &tx : {ledger::testing::medium_xpub::TX_1, ledger::testing::medium_xpub::TX_2,
+                               ledger::testing::medium_xpub::TX_3, ledger::testing::medium_xpub::TX_4}) {
+            account->interpretTransaction(*JSONUtils::parse<TransactionParser>(tx), templates, true);
+        }
+        return templates;
+    }
+
+    void benchmark(bool useCopy, size_t batchSize = BATCH_SIZE) {
+        auto pool      = newPostgresPool();
+        auto templates = interpretTemplates(pool);
+
+        // Every operation gets its own transaction and inputs so that each batch only inserts new rows
+        std::vector<Operation> operations;
+        operations.reserve(OPERATION_COUNT);
+        for (size_t i = 0; i < OPERATION_COUNT; i++) {
+            auto operation = templates[i % templates.size()];
+            auto &tx       = operation.bitcoinTransaction.getValue();
+            tx.hash        = fmt::format("{:064x}", i);
+            for (auto &input : tx.inputs) {
+                input.previousTxHash = fmt::format("{:064x}", OPERATION_COUNT + i * 16 + input.index);
+            }
+            operation.refreshUid();
+            operations.push_back(operation);
+        }
+
+        soci::session sql(pool->getDatabaseSessionPool()->getPool());
+        auto rowsBefore = countRows(sql);
+        auto start      = std::chrono::system_clock::now();
+        for (size_t offset = 0; offset < operations.size(); offset += batchSize) {
+            std::vector<Operation> batch(operations.begin() + offset,
+                                         operations.begin() + std::min(operations.size(), offset + batchSize));
+            soci::transaction tr(sql);
+            BitcoinLikeOperationDatabaseHelper::bulkInsert(sql, batch, useCopy);
+            tr.commit();
+        }
+        std::chrono::duration<double> diff = std::chrono::system_clock::now() - start;
+        auto rows                          = countRows(sql) - rowsBefore;
+
+        std::cout << (useCopy ? "COPY" : "Prepared statements") << " : inserted " << rows << " rows ("
+                  << operations.size() << " operations, batches of " << batchSize << ") in " << diff.count() << " s, "
+                  << static_cast<int64_t>(rows / diff.count()) << " rows/s\n";
+
+        uv::wait(pool->freshResetAll());
+    }
+};
+
+TEST_F(BitcoinLikeBulkInsertBenchmark, DISABLED_PreparedStatements) {
+    benchmark(false);
+}
+
+TEST_F(BitcoinLikeBulkInsertBenchmark, DISABLED_Copy) {
+    benchmark(true);
+}
+
+// Compares both paths around BitcoinLikeOperationDatabaseHelper::COPY_MIN_OPERATIONS
+TEST_F(BitcoinLikeBulkInsertBenchmark, DISABLED_CopyThreshold) {
+    for (size_t batchSize : {10, 50, 100, 200, 500}) {
+        benchmark(false, batchSize);
+        benchmark(true, batchSize);
+    }
+}
+
+TEST_F(BitcoinLikeBulkInsertBenchmark, CopyMatchesPreparedStatements) {
+    auto pool      = newPostgresPool();
+    auto templates = interpretTemplates(pool);
+
+    // Stage the same keys several times in one batch, transactions being first seen in the mempool
+    // then in a block, so that the merge has to pick the row the prepared statements keep
+    std::vector<Operation> operations;
+    for (const auto &operation : templates) {
+        auto pending = operation;
+        auto &tx      = pending.bitcoinTransaction.getValue();
+        pending.block = decltype(pending.block)::NONE;
+        tx.block      = decltype(tx.block)::NONE;
+        operations.push_back(pending);
+    }
+    operations.insert(operations.end(), templates.begin(), templates.end());
+    operations.insert(operations.end(), templates.begin(), templates.end());
+
+    soci::session sql(pool->getDatabaseSessionPool()->getPool());
+    auto insert = [&](bool useCopy) {
+        soci::transaction tr(sql);
+        BitcoinLikeOperationDatabaseHelper::bulkInsert(sql, operations, useCopy);
+        auto dump = dumpRows(sql);
+        tr.rollback();
+        return dump;
+    };
+    auto prepared = insert(false);
+    auto copied   = insert(true);
+
+    EXPECT_FALSE(prepared.empty());
+    EXPECT_EQ(copied, prepared);
+
+    uv::wait(pool->freshResetAll());
+}
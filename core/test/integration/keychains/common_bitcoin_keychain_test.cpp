@@ -33,6 +33,8 @@
 #include "api/PreferencesChange.hpp"
 #include "keychain_test_helper.h"
 
+#include <chrono>
+#include <fmt/format.h>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -186,3 +188,109 @@ TEST_F(CommonBitcoinKeychains, StaticAddressGivesSameAddress) {
         },
         configuration);
 }
+
+TEST_F(CommonBitcoinKeychains, BulkDerivationMatchesSingleDerivation) {
+    testKeychain(BTC_DATA, [](ConcreteCommonBitcoinLikeKeychains &keychain) {
+        const auto addresses = keychain.getAllObservableAddressString(0, 49);
+        ASSERT_EQ(addresses.size(), 100);
+        for (auto index = 0; index < 50; index++) {
+            for (auto node = 0; node < 2; node++) {
+                auto expected = BitcoinLikeAddress::fromPublicKey(keychain.getExtendedPublicKey(),
+                                                                  BTC_DATA.currency,
+                                                                  fmt::format("{}/{}", node, index),
+                                                                  keychain.getKeychainEngine());
+                EXPECT_EQ(addresses[index * 2 + node], expected);
+                EXPECT_TRUE(keychain.contains(expected));
+            }
+        }
+        // Served from the address index this time
+        EXPECT_EQ(keychain.getAllObservableAddressString(0, 49), addresses);
+    });
+}
+
+TEST_F(CommonBitcoinKeychains, AddressIndexIsPersisted) {
+    auto configuration = std::make_shared<DynamicObject>();
+    configuration->putString(api::Configuration::KEYCHAIN_ENGINE, api::KeychainEngines::BIP49_P2SH);
+    auto backend     = std::make_shared<ledger::core::test::MemPreferencesBackend>();
+    auto preferences = std::make_shared<ledger::core::Preferences>(*backend, "keychain");
+    auto newKeychain = [&]() {
+        return std::make_shared<ConcreteCommonBitcoinLikeKeychains>(
+            configuration,
+            BTC_DATA.currency,
+            0,
+            ledger::core::BitcoinLikeExtendedPublicKey::fromBase58(BTC_DATA.currency, BTC_DATA.xpub, optional<std::string>(BTC_DATA.derivationPath), configuration),
+            preferences);
+    };
+
+    const auto addresses = newKeychain()->getAllObservableAddressString(0, 9);
+    auto keychain        = newKeychain();
+    for (const auto &address : addresses) {
+        EXPECT_TRUE(keychain->contains(address));
+        EXPECT_TRUE(keychain->getAddressDerivationPath(address).nonEmpty());
+    }
+    EXPECT_FALSE(keychain->contains("3FgusxCLY23j7xcWsqAwC4DthKjrVhxbwy"));
+    EXPECT_EQ(keychain->getAddressPurpose(addresses[0]).getValue(), BitcoinLikeKeychain::RECEIVE);
+    EXPECT_EQ(keychain->getAddressPurpose(addresses[1]).getValue(), BitcoinLikeKeychain::CHANGE);
+}
+
+TEST_F(CommonBitcoinKeychains, AddressIndexOnlyRewritesTouchedChunks) {
+    auto configuration = std::make_shared<DynamicObject>();
+    configuration->putString(api::Configuration::KEYCHAIN_ENGINE, api::KeychainEngines::BIP49_P2SH);
+    auto backend     = std::make_shared<ledger::core::test::MemPreferencesBackend>();
+    auto preferences = std::make_shared<ledger::core::Preferences>(*backend, "keychain");
+    auto newKeychain = [&]() {
+        return std::make_shared<ConcreteCommonBitcoinLikeKeychains>(
+            configuration,
+            BTC_DATA.currency,
+            0,
+            ledger::core::BitcoinLikeExtendedPublicKey::fromBase58(BTC_DATA.currency, BTC_DATA.xpub, optional<std::string>(BTC_DATA.derivationPath), configuration),
+            preferences);
+    };
+
+    // Spans the first two chunks of each node
+    const auto firstAddresses = newKeychain()->getAllObservableAddressString(0, DerivedAddressIndex::CHUNK_SIZE + 9);
+    auto keychain             = newKeychain();
+    EXPECT_TRUE(keychain->contains(firstAddresses.back()));
+
+    // Deriving in the second chunk leaves the first one untouched
+    const std::vector<uint8_t> sentinel{1, 2, 3};
+    preferences->edit()->putData("addressIndex:0:0", sentinel)->commit();
+    const auto nextAddresses = keychain->getAllObservableAddressString(DerivedAddressIndex::CHUNK_SIZE + 10, DerivedAddressIndex::CHUNK_SIZE + 19);
+    EXPECT_EQ(preferences->getData("addressIndex:0:0", {}), sentinel);
+    preferences->edit()->remove("addressIndex:0:0")->commit();
+
+    auto reloaded = newKeychain();
+    for (const auto &address : nextAddresses) {
+        EXPECT_TRUE(reloaded->contains(address));
+    }
+    EXPECT_TRUE(reloaded->contains(firstAddresses[2 * DerivedAddressIndex::CHUNK_SIZE + 1]));
+}
+
+TEST_F(CommonBitcoinKeychains, AddressIndexImportsLegacyCache) {
+    constexpr auto receiveAddr0 = "3HMhvAEtfDyQSZAmM6qvLGuZYUCyZrgNr3";
+    testKeychain(BTC_DATA, [receiveAddr0](ConcreteCommonBitcoinLikeKeychains &keychain) {
+        // Address cached with the per address keys used before the index existed
+        keychain.getPreferences()->edit()->putString("path:0/0", receiveAddr0)->commit();
+        EXPECT_TRUE(keychain.contains(receiveAddr0));
+        EXPECT_EQ(keychain.getAddressDerivationPath(receiveAddr0).getValue(), "44'/0'/0'/0/0");
+    });
+}
+
+TEST_F(CommonBitcoinKeychains, DISABLED_BulkDerivationBenchmark) {
+    constexpr auto ADDRESS_COUNT = 1000;
+    testKeychain(BTC_DATA, [](ConcreteCommonBitcoinLikeKeychains &keychain) {
+        auto start = std::chrono::system_clock::now();
+        for (auto index = 0; index < ADDRESS_COUNT; index++) {
+            BitcoinLikeAddress::fromPublicKey(keychain.getExtendedPublicKey(), BTC_DATA.currency, fmt::format("0/{}", index), keychain.getKeychainEngine());
+        }
+        auto end                           = std::chrono::system_clock::now();
+        std::chrono::duration<double> diff = end - start;
+        std::cout << "Single derivation: " << ADDRESS_COUNT / diff.count() << " addresses/s\n";
+
+        start = std::chrono::system_clock::now();
+        keychain.getFreshAddresses(BitcoinLikeKeychain::RECEIVE, ADDRESS_COUNT);
+        end  = std::chrono::system_clock::now();
+        diff = end - start;
+        std::cout << "Bulk derivation: " << ADDRESS_COUNT / diff.count() << " addresses/s\n";
+    });
+}
@@ -243,4 +243,32 @@ TEST_F(LedgerApiTezosLikeBlockchainExplorerTests, GetHugeBalance) {
     auto result  = uv::wait(explorer->getBalance(std::vector<TezosLikeKeychain::Address>{address}));
     EXPECT_TRUE(result->isPositive());
     EXPECT_GT(result->toUint64(), std::numeric_limits<int>::max());
-}
\ No newline at end of file
+}
+TEST_F(LedgerApiTezosLikeBlockchainExplorerTests, GetTransactionsOfSeveralAddresses) {
+    const std::vector<std::string> addresses{"tz1YkqJKPWXjREzs9L32AZqe3yiEdfhSYx3x", "tz1boBHAVpwcvKkNFAQHYr7mjxAz1PpVgKq7"};
+    auto firstPage = uv::wait(explorer->getTransactions(addresses, Option<std::string>(), Option<void *>()));
+    ASSERT_FALSE(firstPage->transactions.empty());
+    EXPECT_TRUE(firstPage->hasNext);
+
+    uint64_t lastId = 0;
+    for (const auto &tx : firstPage->transactions) {
+        const auto id = std::stoull(tx.explorerId.getValue());
+        EXPECT_GT(id, lastId);
+        lastId = id;
+    }
+    auto secondPage = uv::wait(explorer->getTransactions(addresses, std::to_string(lastId), Option<void *>()));
+    ASSERT_FALSE(secondPage->transactions.empty());
+    EXPECT_GT(std::stoull(secondPage->transactions.front().explorerId.getValue()), lastId);
+}
+
+TEST_F(LedgerApiTezosLikeBlockchainExplorerTests, GetBalancesOfSeveralAddressesAtOnce) {
+    const auto currency = Currency("tezos").forkOfTezos(params);
+    const std::vector<TezosLikeKeychain::Address> addresses{
+        std::dynamic_pointer_cast<TezosLikeAddress>(TezosLikeAddress::parse("tz1YkqJKPWXjREzs9L32AZqe3yiEdfhSYx3x", currency)),
+        std::dynamic_pointer_cast<TezosLikeAddress>(TezosLikeAddress::parse("tz1boBHAVpwcvKkNFAQHYr7mjxAz1PpVgKq7", currency))};
+    // Issued together, the three lookups are answered by the same request
+    auto first  = explorer->getBalance({addresses[0]});
+    auto second = explorer->getBalance({addresses[1]});
+    auto total  = explorer->getBalance(addresses);
+    EXPECT_EQ(uv::wait(total)->toString(), (*uv::wait(first) + *uv::wait(second)).toString());
+}
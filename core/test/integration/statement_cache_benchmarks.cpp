@@ -0,0 +1,105 @@
+/*
+ *
+ * statement_cache_benchmarks
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#include "../common/test_config.h"
+#include "../fixtures/medium_xpub_fixtures.h"
+#include "BaseFixture.h"
+
+#include <api/PoolConfiguration.hpp>
+#include <chrono>
+#include <database/StatementCache.hpp>
+#include <iostream>
+#include <wallet/bitcoin/database/BitcoinLikeUTXODatabaseHelper.h>
+#include <wallet/common/database/BlockDatabaseHelper.h>
+
+namespace {
+    const size_t ITERATIONS = 10000;
+} // namespace
+
+class StatementCacheBenchmark : public BaseFixture {
+  public:
+    std::shared_ptr<WalletPool> newPostgresPool() {
+        auto poolConfiguration = DynamicObject::newInstance();
+        poolConfiguration->putString(api::PoolConfiguration::DATABASE_NAME, getPostgresUrl());
+        return newDefaultPool("postgres", "", poolConfiguration);
+    }
+
+    // Runs the query without and with the statement cache of the session
+    void benchmark(soci::session &sql, const std::string &name, const std::function<void(soci::session &)> &query) {
+        auto cache = StatementCache::of(sql);
+        ASSERT_NE(cache, nullptr);
+
+        StatementCache::detach(sql);
+        auto uncached = measure(sql, query);
+        StatementCache::attach(sql, cache);
+        auto cached = measure(sql, query);
+
+        std::cout << name << " : " << uncached << " us/call without cache, "
+                  << cached << " us/call with cache\n";
+    }
+
+  private:
+    static double measure(soci::session &sql, const std::function<void(soci::session &)> &query) {
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < ITERATIONS; i++) {
+            query(sql);
+        }
+        std::chrono::duration<double, std::micro> diff = std::chrono::steady_clock::now() - start;
+        return diff.count() / ITERATIONS;
+    }
+};
+
+TEST_F(StatementCacheBenchmark, DISABLED_BlockExists) {
+    auto pool = newPostgresPool();
+    soci::session sql(pool->getDatabaseSessionPool()->getPool());
+    Block block;
+    block.hash         = "0000000000000000000a4f2d9d2c7e0f7d7e0e1a9c2e3b4d5f6a7b8c9d0e1f2a";
+    block.height       = 650000;
+    block.time         = std::chrono::system_clock::now();
+    block.currencyName = "bitcoin";
+    BlockDatabaseHelper::putBlock(sql, block);
+
+    benchmark(sql, "blockExists", [&](soci::session &session) {
+        EXPECT_TRUE(BlockDatabaseHelper::blockExists(session, block.hash, block.currencyName));
+    });
+    uv::wait(pool->freshResetAll());
+}
+
+TEST_F(StatementCacheBenchmark, DISABLED_GetBalance) {
+    auto pool    = newPostgresPool();
+    auto wallet  = uv::wait(pool->createWallet(randomWalletName(), "bitcoin", DynamicObject::newInstance()));
+    auto account = std::dynamic_pointer_cast<BitcoinLikeAccount>(uv::wait(wallet->newAccountWithExtendedKeyInfo(ledger::testing::medium_xpub::XPUB_INFO)));
+    soci::session sql(pool->getDatabaseSessionPool()->getPool());
+
+    benchmark(sql, "getBalance", [&](soci::session &session) {
+        BitcoinLikeUTXODatabaseHelper::getBalance(session, account->getAccountUid());
+    });
+    uv::wait(pool->freshResetAll());
+}
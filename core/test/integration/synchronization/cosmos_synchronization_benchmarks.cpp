@@ -38,9 +38,11 @@
 #include "../BaseFixture.h"
 
 #include <api/Configuration.hpp>
+#include <api/HttpRequest.hpp>
 #include <api/CosmosConfigurationDefaults.hpp>
 #include <api/KeychainEngines.hpp>
 #include <api/PoolConfiguration.hpp>
+#include <atomic>
 #include <chrono>
 #include <collections/DynamicObject.hpp>
 #include <cosmos/CosmosLikeExtendedPublicKey.hpp>
@@ -82,6 +84,29 @@ namespace {
     const std::string SMALL_PUBKEY =
         "03d672c1b90c84d9d97522e9a73252a432b77d90a78bf81cdbe35270d9d3dc1c34";
     const std::string SMALL_ADDRESS = "cosmos1sd4tl9aljmmezzudugs7zlaya7pg2895tyn79r";
+
+    // Forwards every request to the wrapped client and counts them, so that the
+    // benchmarks can report how many HTTP calls a synchronization needs.
+    class CountingHttpClient : public api::HttpClient {
+      public:
+        explicit CountingHttpClient(const std::shared_ptr<api::HttpClient> &client) : _client(client) {}
+
+        void execute(const std::shared_ptr<api::HttpRequest> &request) override {
+            _requests++;
+            if (request->getUrl().find("/blocks/") != std::string::npos) {
+                _blockRequests++;
+            }
+            _client->execute(request);
+        }
+
+        size_t requests() const { return _requests; }
+        size_t blockRequests() const { return _blockRequests; }
+
+      private:
+        std::shared_ptr<api::HttpClient> _client;
+        std::atomic<size_t> _requests{0};
+        std::atomic<size_t> _blockRequests{0};
+    };
 } // namespace
 
 class CosmosWalletSyncBenchmark : public BaseFixture {
@@ -95,7 +120,8 @@ class CosmosWalletSyncBenchmark : public BaseFixture {
 
         auto poolConfig = DynamicObject::newInstance();
         poolConfig->putString(api::PoolConfiguration::DATABASE_NAME, getPostgresUrl());
-        pool     = newDefaultPool("postgres", "", poolConfig);
+        counter  = std::make_shared<CountingHttpClient>(http);
+        pool     = newDefaultPool("postgres", "", poolConfig, counter);
 
         explorer = std::make_shared<GaiaCosmosLikeBlockchainExplorer>(
             worker, client, PARAMS, std::make_shared<DynamicObject>());
@@ -150,6 +176,7 @@ class CosmosWalletSyncBenchmark : public BaseFixture {
 
     std::shared_ptr<WalletPool> pool;
     std::shared_ptr<GaiaCosmosLikeBlockchainExplorer> explorer;
+    std::shared_ptr<CountingHttpClient> counter;
 };
 
 TEST_F(CosmosWalletSyncBenchmark, DISABLED_Small) {
@@ -163,6 +190,8 @@ TEST_F(CosmosWalletSyncBenchmark, DISABLED_Small) {
     auto end                           = std::chrono::system_clock::now();
     std::chrono::duration<double> diff = end - start;
     std::cout << "Time to synchronize " << SMALL_ADDRESS << " : " << diff.count() << " s\n";
+    std::cout << "HTTP calls to synchronize " << SMALL_ADDRESS << " : " << counter->requests() << " ("
+              << counter->blockRequests() << " block queries)\n";
 
     start = std::chrono::system_clock::now();
     auto ops =
@@ -184,6 +213,8 @@ TEST_F(CosmosWalletSyncBenchmark, DISABLED_Medium) {
     auto end                           = std::chrono::system_clock::now();
     std::chrono::duration<double> diff = end - start;
     std::cout << "Time to synchronize " << MEDIUM_ADDRESS << " : " << diff.count() << " s\n";
+    std::cout << "HTTP calls to synchronize " << MEDIUM_ADDRESS << " : " << counter->requests() << " ("
+              << counter->blockRequests() << " block queries)\n";
 
     start = std::chrono::system_clock::now();
     auto ops =
@@ -205,6 +236,8 @@ TEST_F(CosmosWalletSyncBenchmark, DISABLED_Large) {
     auto end                           = std::chrono::system_clock::now();
     std::chrono::duration<double> diff = end - start;
     std::cout << "Time to synchronize " << LARGE_ADDRESS << " : " << diff.count() << " s\n";
+    std::cout << "HTTP calls to synchronize " << LARGE_ADDRESS << " : " << counter->requests() << " ("
+              << counter->blockRequests() << " block queries)\n";
 
     start = std::chrono::system_clock::now();
     auto ops =
@@ -226,6 +259,8 @@ TEST_F(CosmosWalletSyncBenchmark, DISABLED_ExtraLarge) {
     auto end                           = std::chrono::system_clock::now();
     std::chrono::duration<double> diff = end - start;
     std::cout << "Time to synchronize " << EXTRA_LARGE_ADDRESS << " : " << diff.count() << " s\n";
+    std::cout << "HTTP calls to synchronize " << EXTRA_LARGE_ADDRESS << " : " << counter->requests() << " ("
+              << counter->blockRequests() << " block queries)\n";
 
     start = std::chrono::system_clock::now();
     auto ops =
@@ -247,6 +282,8 @@ TEST_F(CosmosWalletSyncBenchmark, DISABLED_Huge) {
     auto end                           = std::chrono::system_clock::now();
     std::chrono::duration<double> diff = end - start;
     std::cout << "Time to synchronize " << HUGE_ADDRESS << " : " << diff.count() << " s\n";
+    std::cout << "HTTP calls to synchronize " << HUGE_ADDRESS << " : " << counter->requests() << " ("
+              << counter->blockRequests() << " block queries)\n";
 
     start = std::chrono::system_clock::now();
     auto ops =
@@ -0,0 +1,133 @@
+/*
+ *
+ * synchronization_pipeline_benchmarks.cpp
+ * Benchmarks for the pipelined batch discovery of Bitcoin-like synchronizations
+ * Usage :
+ * ledger-core-integration-tests --gtest_also_run_disabled_tests --gtest_filter=BitcoinLikeWalletSyncPipelineBenchmark.*
+ * Responses are served from the recorded HTTP cache of BitcoinLikeWalletSynchronization.MediumXpubSynchronization
+ * with an artificial latency, so that the time spent waiting on the explorer dominates like it does in production.
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "../../common/test_config.h"
+#include "../BaseFixture.h"
+
+#include <api/Configuration.hpp>
+#include <api/PoolConfiguration.hpp>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <utils/LambdaRunnable.hpp>
+
+namespace {
+    const std::string MEDIUM_XPUB_HTTP_CACHE = "http_cache/BitcoinLikeWalletSynchronization.MediumXpubSynchronization";
+    const int64_t EXPLORER_LATENCY_MS        = 150;
+
+    // Forwards requests to the underlying client after a fixed delay, without blocking any thread.
+    class LatencyHttpClient : public api::HttpClient {
+      public:
+        LatencyHttpClient(const std::shared_ptr<api::HttpClient> &client,
+                          const std::shared_ptr<api::ExecutionContext> &context,
+                          int64_t latency) : _client(client), _context(context), _latency(latency) {}
+
+        void execute(const std::shared_ptr<api::HttpRequest> &request) override {
+            auto client = _client;
+            _context->delay(make_runnable([client, request]() {
+                                try {
+                                    client->execute(request);
+                                } catch (const std::exception &e) {
+                                    request->complete(nullptr, api::Error(api::ErrorCode::HTTP_ERROR, e.what()));
+                                }
+                            }),
+                            _latency);
+        }
+
+      private:
+        std::shared_ptr<api::HttpClient> _client;
+        std::shared_ptr<api::ExecutionContext> _context;
+        int64_t _latency;
+    };
+} // namespace
+
+class BitcoinLikeWalletSyncPipelineBenchmark : public BaseFixture {
+  public:
+    void SetUp() override {
+        BaseFixture::SetUp();
+        http->loadCache(MEDIUM_XPUB_HTTP_CACHE);
+    }
+
+    void benchmark(int32_t pipelineDepth) {
+        auto poolConfiguration = DynamicObject::newInstance();
+        poolConfiguration->putString(api::PoolConfiguration::DATABASE_NAME, getPostgresUrl());
+        auto client = std::make_shared<LatencyHttpClient>(http, dispatcher->getSerialExecutionContext("explorer_latency"), EXPLORER_LATENCY_MS);
+        auto pool   = newDefaultPool("postgres", "", poolConfiguration, client);
+
+        auto configuration = DynamicObject::newInstance();
+        configuration->putString(api::Configuration::BLOCKCHAIN_EXPLORER_API_ENDPOINT, "https://explorers.api.vault.ledger.com");
+        configuration->putString(api::Configuration::BLOCKCHAIN_EXPLORER_VERSION, "v3");
+        configuration->putBoolean(api::Configuration::DEACTIVATE_SYNC_TOKEN, true);
+        configuration->putInt(api::Configuration::MEMPOOL_GRACE_PERIOD_SECS, 10);
+        configuration->putInt(api::Configuration::SYNCHRONIZATION_PIPELINE_DEPTH, pipelineDepth);
+        auto wallet  = uv::wait(pool->createWallet(randomWalletName(), "bitcoin", configuration));
+        auto account = createBitcoinLikeAccount(wallet, 0, P2PKH_MEDIUM_XPUB_INFO);
+
+        auto start    = std::chrono::system_clock::now();
+        auto receiver = make_receiver([=](const std::shared_ptr<api::Event> &event) {
+            if (event->getCode() == api::EventCode::SYNCHRONIZATION_STARTED) {
+                return;
+            }
+            EXPECT_NE(event->getCode(), api::EventCode::SYNCHRONIZATION_FAILED);
+            dispatcher->stop();
+        });
+        account->synchronize()->subscribe(getTestExecutionContext(), receiver);
+        dispatcher->waitUntilStopped();
+        std::chrono::duration<double> diff = std::chrono::system_clock::now() - start;
+
+        auto ops = uv::wait(std::dynamic_pointer_cast<OperationQuery>(account->queryOperations()->complete())->execute());
+        std::cout << "Pipeline depth " << pipelineDepth << " : synchronized " << ops.size() << " operations in "
+                  << diff.count() << " s (explorer latency " << EXPLORER_LATENCY_MS << " ms)\n";
+
+        uv::wait(pool->freshResetAll());
+    }
+};
+
+TEST_F(BitcoinLikeWalletSyncPipelineBenchmark, DISABLED_Window1) {
+    benchmark(1);
+}
+
+TEST_F(BitcoinLikeWalletSyncPipelineBenchmark, DISABLED_Window2) {
+    benchmark(2);
+}
+
+TEST_F(BitcoinLikeWalletSyncPipelineBenchmark, DISABLED_Window4) {
+    benchmark(4);
+}
+
+TEST_F(BitcoinLikeWalletSyncPipelineBenchmark, DISABLED_Window8) {
+    benchmark(8);
+}
@@ -0,0 +1,233 @@
+/*
+ *
+ * synchronization_scheduler_tests.cpp
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#include <api/Account.hpp>
+#include <api/ExecutionContext.hpp>
+#include <api/Runnable.hpp>
+#include <collections/DynamicObject.hpp>
+#include <deque>
+#include <events/Event.hpp>
+#include <events/EventPublisher.hpp>
+#include <gtest/gtest.h>
+#include <utils/Exception.hpp>
+#include <wallet/pool/SynchronizationScheduler.hpp>
+
+using namespace ledger::core;
+
+namespace {
+    // Single threaded context driven by the test, delayed tasks only run when flushed
+    class ManualExecutionContext : public api::ExecutionContext {
+      public:
+        void execute(const std::shared_ptr<api::Runnable> &runnable) override {
+            pending.push_back(runnable);
+        }
+
+        void delay(const std::shared_ptr<api::Runnable> &runnable, int64_t millis) override {
+            delayed.push_back(runnable);
+        }
+
+        void run() {
+            while (!pending.empty()) {
+                auto runnable = pending.front();
+                pending.pop_front();
+                runnable->run();
+            }
+        }
+
+        void flush() {
+            auto runnables = std::move(delayed);
+            delayed.clear();
+            for (const auto &runnable : runnables) {
+                runnable->run();
+            }
+            run();
+        }
+
+        std::deque<std::shared_ptr<api::Runnable>> pending;
+        std::vector<std::shared_ptr<api::Runnable>> delayed;
+    };
+
+    class SynchronizationSchedulerTest : public ::testing::Test {
+      public:
+        std::shared_ptr<SynchronizationScheduler> newScheduler(int32_t maxConcurrent, int32_t maxConcurrentPerExplorer) {
+            return std::make_shared<SynchronizationScheduler>(context, maxConcurrent, maxConcurrentPerExplorer, [this]() {
+                return saturated;
+            });
+        }
+
+        std::shared_ptr<ProgressNotifier<api::EventCode>> schedule(const std::shared_ptr<SynchronizationScheduler> &scheduler,
+                                                                   const std::string &account,
+                                                                   const std::string &explorer,
+                                                                   SynchronizationScheduler::Priority priority = SynchronizationScheduler::Priority::BACKGROUND) {
+            auto notifier = scheduler->schedule(
+                account, explorer, [=]() {
+                    auto publisher = std::make_shared<EventPublisher>(context);
+                    publisher->postSticky(std::make_shared<Event>(api::EventCode::SYNCHRONIZATION_STARTED, api::DynamicObject::newInstance()), 0);
+                    publishers[account] = publisher;
+                    started.push_back(account);
+                    return publisher->getEventBus();
+                },
+                priority);
+            context->run();
+            return notifier;
+        }
+
+        void complete(const std::string &account, api::EventCode code = api::EventCode::SYNCHRONIZATION_SUCCEED) {
+            auto payload = std::make_shared<DynamicObject>();
+            if (code == api::EventCode::SYNCHRONIZATION_FAILED) {
+                payload->putInt(api::Account::EV_SYNC_ERROR_CODE_INT, static_cast<int32_t>(api::ErrorCode::HTTP_ERROR));
+                payload->putString(api::Account::EV_SYNC_ERROR_MESSAGE, "explorer is down");
+            }
+            publishers[account]->postSticky(std::make_shared<Event>(code, payload), 0);
+            context->run();
+        }
+
+        std::shared_ptr<ManualExecutionContext> context = std::make_shared<ManualExecutionContext>();
+        std::unordered_map<std::string, std::shared_ptr<EventPublisher>> publishers;
+        std::vector<std::string> started;
+        bool saturated = false;
+    };
+} // namespace
+
+TEST_F(SynchronizationSchedulerTest, BoundsConcurrencyPerExplorer) {
+    auto scheduler = newScheduler(2, 1);
+    schedule(scheduler, "a1", "explorer-a");
+    schedule(scheduler, "a2", "explorer-a");
+    schedule(scheduler, "b1", "explorer-b");
+
+    EXPECT_EQ(started, std::vector<std::string>({"a1", "b1"}));
+    EXPECT_EQ(scheduler->getRunningCount(), 2);
+    EXPECT_EQ(scheduler->getQueuedCount(), 1);
+
+    complete("a1");
+    EXPECT_EQ(started, std::vector<std::string>({"a1", "b1", "a2"}));
+    EXPECT_EQ(scheduler->getQueuedCount(), 0);
+}
+
+TEST_F(SynchronizationSchedulerTest, BoundsGlobalConcurrency) {
+    auto scheduler = newScheduler(1, 4);
+    schedule(scheduler, "a1", "explorer-a");
+    schedule(scheduler, "b1", "explorer-b");
+
+    EXPECT_EQ(started, std::vector<std::string>({"a1"}));
+    complete("a1");
+    EXPECT_EQ(started, std::vector<std::string>({"a1", "b1"}));
+    complete("b1");
+    EXPECT_EQ(scheduler->getRunningCount(), 0);
+}
+
+TEST_F(SynchronizationSchedulerTest, DeduplicatesPendingAccounts) {
+    auto scheduler = newScheduler(1, 1);
+    auto running   = schedule(scheduler, "a1", "explorer-a");
+    auto queued    = schedule(scheduler, "a2", "explorer-a");
+
+    EXPECT_EQ(schedule(scheduler, "a1", "explorer-a"), running);
+    EXPECT_EQ(schedule(scheduler, "a2", "explorer-a"), queued);
+    EXPECT_EQ(scheduler->getQueuedCount(), 1);
+
+    complete("a1");
+    complete("a2");
+    EXPECT_EQ(started, std::vector<std::string>({"a1", "a2"}));
+    EXPECT_EQ(running->getFuture().getValue().getValue().getValue(), api::EventCode::SYNCHRONIZATION_SUCCEED);
+
+    // Once done, the account can be synchronized again
+    schedule(scheduler, "a1", "explorer-a");
+    EXPECT_EQ(started.size(), 3);
+}
+
+TEST_F(SynchronizationSchedulerTest, ServesInteractiveRequestsFirst) {
+    auto scheduler = newScheduler(1, 1);
+    schedule(scheduler, "a1", "explorer-a");
+    schedule(scheduler, "a2", "explorer-a");
+    schedule(scheduler, "a3", "explorer-a");
+    schedule(scheduler, "a4", "explorer-a", SynchronizationScheduler::Priority::INTERACTIVE);
+    // Asking again with a higher priority promotes the queued request
+    schedule(scheduler, "a3", "explorer-a", SynchronizationScheduler::Priority::INTERACTIVE);
+
+    complete("a1");
+    complete("a4");
+    complete("a3");
+    EXPECT_EQ(started, std::vector<std::string>({"a1", "a4", "a3", "a2"}));
+}
+
+TEST_F(SynchronizationSchedulerTest, NeverPromotesStartedSynchronizations) {
+    auto scheduler        = newScheduler(1, 1);
+    auto synchronizations = 0;
+    std::shared_ptr<ProgressNotifier<api::EventCode>> promoted;
+    // Asked again with a higher priority while starting, before its event bus is known
+    auto notifier = scheduler->schedule(
+        "a1", "explorer-a", [&]() {
+            synchronizations += 1;
+            promoted = scheduler->schedule(
+                "a1", "explorer-a", []() -> std::shared_ptr<api::EventBus> { return nullptr; }, SynchronizationScheduler::Priority::INTERACTIVE);
+            auto publisher   = std::make_shared<EventPublisher>(context);
+            publishers["a1"] = publisher;
+            return publisher->getEventBus();
+        },
+        SynchronizationScheduler::Priority::BACKGROUND);
+    context->run();
+
+    EXPECT_EQ(promoted, notifier);
+    EXPECT_EQ(scheduler->getQueuedCount(), 0);
+    complete("a1");
+    EXPECT_EQ(synchronizations, 1);
+    EXPECT_EQ(scheduler->getRunningCount(), 0);
+    EXPECT_EQ(scheduler->getQueuedCount(), 0);
+}
+
+TEST_F(SynchronizationSchedulerTest, HoldsBackWhileDatabaseIsSaturated) {
+    auto scheduler = newScheduler(4, 4);
+    saturated      = true;
+    schedule(scheduler, "a1", "explorer-a");
+    schedule(scheduler, "a2", "explorer-a");
+
+    EXPECT_TRUE(started.empty());
+    EXPECT_EQ(context->delayed.size(), 1);
+
+    context->flush();
+    EXPECT_TRUE(started.empty());
+    EXPECT_EQ(context->delayed.size(), 1);
+
+    saturated = false;
+    context->flush();
+    EXPECT_EQ(started, std::vector<std::string>({"a1", "a2"}));
+}
+
+TEST_F(SynchronizationSchedulerTest, ReportsFailures) {
+    auto scheduler = newScheduler(1, 1);
+    auto notifier  = schedule(scheduler, "a1", "explorer-a");
+    schedule(scheduler, "a2", "explorer-a");
+
+    complete("a1", api::EventCode::SYNCHRONIZATION_FAILED);
+    auto result = notifier->getFuture().getValue().getValue();
+    EXPECT_TRUE(result.isFailure());
+    EXPECT_EQ(result.getFailure().getErrorCode(), api::ErrorCode::HTTP_ERROR);
+    EXPECT_EQ(started, std::vector<std::string>({"a1", "a2"}));
+}
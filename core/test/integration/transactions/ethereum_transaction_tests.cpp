@@ -38,6 +38,7 @@
 #include <utils/hex.h>
 #include <wallet/currencies.hpp>
 #include <wallet/ethereum/api_impl/EthereumLikeTransactionApi.h>
+#include <wallet/ethereum/database/ERC20BalanceDatabaseHelper.h>
 #include <wallet/ethereum/database/EthereumLikeAccountDatabaseHelper.h>
 using namespace std;
 
@@ -153,3 +154,100 @@ TEST_F(EthereumMakeTransaction, ParseSignedRawERC20TransactionAndBuildETHBlockch
     EXPECT_EQ(ethLikeBCTx.erc20Transactions[0].contractAddress, contractAddress);
     EXPECT_EQ(ethLikeBCTx.erc20Transactions[0].type, api::OperationType::SEND);
 }
+
+TEST_F(EthereumMakeTransaction, ERC20BalancesAreServedFromCheckpoints) {
+    auto address         = account->getKeychain()->getAddress()->toEIP55();
+    auto sender          = "0x456b8e57F5e096B9Fff45BDbD58B8CE90d830Ff9";
+    auto contractAddress = "0xDFb287530FD4c1e59456DE82a84e4aae7C250Ec1";
+    auto start           = DateUtils::fromJSON("2020-01-01T00:00:00Z");
+
+    // 150 hourly transfers of 10 tokens to the account
+    std::vector<Operation> operations;
+    for (auto i = 0; i < 150; i++) {
+        EthereumLikeBlockchainExplorerTransaction tx;
+        tx.hash       = "erc20_transfer_" + std::to_string(i);
+        tx.receivedAt = start + std::chrono::hours(i);
+        tx.sender     = sender;
+        tx.receiver   = contractAddress;
+        tx.status     = 1;
+        EthereumLikeBlockchainExplorer::Block block;
+        block.hash   = "erc20_block_" + std::to_string(i);
+        block.height = i + 1;
+        block.time   = tx.receivedAt;
+        tx.block     = block;
+        tx.erc20Transactions.push_back(ERC20Transaction{sender, address, contractAddress, BigInt(10), api::OperationType::RECEIVE});
+        account->interpretTransaction(tx, operations);
+    }
+    ASSERT_TRUE(account->bulkInsert(operations).isSuccess());
+
+    auto erc20Accounts = account->getERC20Accounts();
+    ASSERT_EQ(erc20Accounts.size(), 1);
+    auto erc20Account = std::dynamic_pointer_cast<ERC20LikeAccount>(erc20Accounts[0]);
+    EXPECT_EQ(uv::wait(erc20Account->getBalance())->toString(10), "1500");
+    auto balances = uv::wait(account->getAllERC20Balances());
+    ASSERT_EQ(balances.size(), 1);
+    EXPECT_EQ(balances[contractAddress].toString(), "1500");
+
+    // A checkpoint is cut after the first 100 transfers
+    auto erc20AccountUid = AccountDatabaseHelper::createERC20AccountUid(account->getAccountUid(), contractAddress);
+    {
+        soci::session sql(pool->getDatabaseSessionPool()->getPool());
+        auto checkpoint = ERC20BalanceDatabaseHelper::getLatestCheckpoint(sql, erc20AccountUid, DateUtils::now());
+        ASSERT_TRUE(checkpoint.nonEmpty());
+        EXPECT_EQ(checkpoint.getValue().date, start + std::chrono::hours(99));
+        EXPECT_EQ(checkpoint.getValue().balance.toString(), "1000");
+    }
+
+    // Histories resume from the checkpoint
+    auto history = erc20Account->getBalanceHistoryFor(start + std::chrono::hours(120), start + std::chrono::hours(200), api::TimePeriod::DAY);
+    ASSERT_FALSE(history.empty());
+    EXPECT_EQ(history.front()->toString(10), "1450");
+    EXPECT_EQ(history.back()->toString(10), "1500");
+
+    // Erasing operations invalidates the checkpoints settled after the erased ones
+    auto code = uv::wait(account->eraseDataSince(start + std::chrono::hours(50)));
+    EXPECT_EQ(code, api::ErrorCode::FUTURE_WAS_SUCCESSFULL);
+    {
+        soci::session sql(pool->getDatabaseSessionPool()->getPool());
+        EXPECT_TRUE(ERC20BalanceDatabaseHelper::getLatestCheckpoint(sql, erc20AccountUid, DateUtils::now()).isEmpty());
+    }
+    EXPECT_EQ(uv::wait(erc20Account->getBalance())->toString(10), "500");
+}
+
+TEST_F(EthereumMakeTransaction, ERC20BalancesCountPendingTransfers) {
+    auto address         = account->getKeychain()->getAddress()->toEIP55();
+    auto sender          = "0x456b8e57F5e096B9Fff45BDbD58B8CE90d830Ff9";
+    auto contractAddress = "0xDFb287530FD4c1e59456DE82a84e4aae7C250Ec1";
+    auto start           = DateUtils::fromJSON("2020-01-01T00:00:00Z");
+
+    // A successful transfer, a failed one and a pending one, whose status is not known yet
+    std::vector<Operation> operations;
+    auto transfer = [&](int i, int32_t status, bool mined) {
+        EthereumLikeBlockchainExplorerTransaction tx;
+        tx.hash       = "erc20_transfer_" + std::to_string(i);
+        tx.receivedAt = start + std::chrono::hours(i);
+        tx.sender     = sender;
+        tx.receiver   = contractAddress;
+        tx.status     = status;
+        if (mined) {
+            EthereumLikeBlockchainExplorer::Block block;
+            block.hash   = "erc20_block_" + std::to_string(i);
+            block.height = i + 1;
+            block.time   = tx.receivedAt;
+            tx.block     = block;
+        }
+        tx.erc20Transactions.push_back(ERC20Transaction{sender, address, contractAddress, BigInt(10), api::OperationType::RECEIVE});
+        account->interpretTransaction(tx, operations);
+    };
+    transfer(0, 1, true);
+    transfer(1, 0, true);
+    transfer(2, 0, false);
+    ASSERT_TRUE(account->bulkInsert(operations).isSuccess());
+
+    auto erc20Accounts = account->getERC20Accounts();
+    ASSERT_EQ(erc20Accounts.size(), 1);
+    EXPECT_EQ(uv::wait(std::dynamic_pointer_cast<ERC20LikeAccount>(erc20Accounts[0])->getBalance())->toString(10), "20");
+    auto balances = uv::wait(account->getAllERC20Balances());
+    ASSERT_EQ(balances.size(), 1);
+    EXPECT_EQ(balances[contractAddress].toString(), "20");
+}
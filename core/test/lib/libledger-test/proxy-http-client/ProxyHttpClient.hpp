@@ -16,9 +16,9 @@ namespace ledger {
                 ProxyHttpClient(std::shared_ptr<api::HttpClient> httpClient);
                 void execute(const std::shared_ptr<api::HttpRequest>& request) override;
                 void addCache(const std::string& url, const std::string& body);
+                void loadCache(const std::string& file_name);
 
             private:
-                void loadCache(const std::string& file_name);
 
                 std::unordered_map<std::string, std::shared_ptr<FakeUrlConnection>> _cache;
                 std::shared_ptr<api::HttpClient> _httpClient;
@@ -0,0 +1,156 @@
+/*
+ *
+ * int256_tests
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "math/Int256.h"
+
+#include "gtest/gtest.h"
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <utils/Exception.hpp>
+#include <vector>
+
+using namespace ledger::core;
+
+static const std::string MAX_UINT256 = "115792089237316195423570985008687907853269984665640564039457584007913129639935";
+
+TEST(Int256, ConvertToHexString) {
+    auto hex = "0102030405060708090a0b0c0d0f11223344556677889900aabbccddeeff";
+    EXPECT_EQ(UInt256::fromHex(hex).toHexString(), hex);
+    EXPECT_EQ(UInt256::fromHex("00000F").toHexString(), "0f");
+    EXPECT_EQ(UInt256().toHexString(), BigInt::fromHex("00").toHexString());
+}
+
+TEST(Int256, ConvertToDecString) {
+    EXPECT_EQ(UInt256::fromDecimal(MAX_UINT256).toString(), MAX_UINT256);
+    EXPECT_EQ(UInt256::fromDecimal("1000000000000000000").toString(), "1000000000000000000");
+    EXPECT_EQ(UInt256().toString(), "0");
+    EXPECT_EQ(Int256::fromDecimal("-1234567890123456789012345678901234567890").toString(), "-1234567890123456789012345678901234567890");
+}
+
+TEST(Int256, DiscardIllFormed) {
+    EXPECT_THROW(UInt256::fromHex("0x12"), Exception);
+    EXPECT_THROW(UInt256::fromDecimal("1.1"), Exception);
+    EXPECT_THROW(UInt256::fromDecimal(""), Exception);
+    EXPECT_THROW(UInt256::fromHex("1" + std::string(64, '0')), Exception);
+    EXPECT_THROW(UInt256::fromDecimal(MAX_UINT256 + "0"), Exception);
+    EXPECT_NO_THROW(UInt256::fromHex("00" + std::string(64, 'f')));
+}
+
+TEST(Int256, InteroperateWithBigInt) {
+    auto dec   = "1234567890123456789012345678901234567890123467890123457890";
+    auto value = BigInt::fromDecimal(dec);
+    EXPECT_EQ(UInt256::fromBigInt(value).toString(), dec);
+    EXPECT_EQ(UInt256::fromDecimal(dec).toBigInt(), value);
+    EXPECT_EQ(Int256::fromBigInt(value.negative()).toBigInt(), value.negative());
+    EXPECT_THROW(UInt256::fromBigInt(value.negative()), Exception);
+    EXPECT_THROW(UInt256::fromBigInt(BigInt::fromDecimal(MAX_UINT256) + BigInt::ONE), Exception);
+}
+
+TEST(Int256, Arithmetic) {
+    auto a = UInt256::fromHex("ffffffffffffffffffffffffffffffff");
+    EXPECT_EQ((a * a).toBigInt(), a.toBigInt() * a.toBigInt());
+    EXPECT_EQ((a + a).toBigInt(), a.toBigInt() + a.toBigInt());
+    EXPECT_EQ((a - UInt256(1)).toBigInt(), a.toBigInt() - BigInt::ONE);
+    EXPECT_THROW(UInt256::fromDecimal(MAX_UINT256) + UInt256(1), Exception);
+    EXPECT_THROW(UInt256(1) - UInt256(2), Exception);
+    EXPECT_THROW(a * a * a, Exception);
+
+    EXPECT_EQ((Int256(-5) + Int256(3)).toString(), "-2");
+    EXPECT_EQ((Int256(3) - Int256(-5)).toString(), "8");
+    EXPECT_EQ((Int256(-5) - Int256(3)).toString(), "-8");
+    EXPECT_EQ(Int256(5) - Int256(5), Int256());
+    EXPECT_FALSE((Int256(5) - Int256(5)).isNegative());
+    EXPECT_LT(Int256(-5), Int256(-3));
+    EXPECT_GT(Int256(2), Int256(-3));
+}
+
+TEST(Int256, ConstantExpressions) {
+    constexpr auto sum = UInt256(5) + UInt256(6);
+    static_assert(sum == UInt256(11), "UInt256 arithmetic must be usable in constant expressions");
+    constexpr auto difference = Int256(5) - Int256(6);
+    static_assert(difference.isNegative(), "Int256 arithmetic must be usable in constant expressions");
+}
+
+TEST(Int256, DISABLED_CompareWithBigInt) {
+    static const int ITERATIONS = 100000;
+    std::vector<std::string> hexes;
+    for (auto index = 0; index < ITERATIONS; index++) {
+        hexes.push_back(BigInt(static_cast<int64_t>(index) * 1000003 + 1).toHexString());
+    }
+
+    auto measure = [](const std::string &name, const std::function<void()> &f) {
+        auto start = std::chrono::steady_clock::now();
+        f();
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        std::cout << name << ": " << elapsed.count() << "us" << std::endl;
+    };
+
+    std::vector<BigInt> bigInts;
+    std::vector<UInt256> uint256s;
+    measure("BigInt parse", [&]() {
+        for (const auto &hex : hexes) {
+            bigInts.push_back(BigInt::fromHex(hex));
+        }
+    });
+    measure("UInt256 parse", [&]() {
+        for (const auto &hex : hexes) {
+            uint256s.push_back(UInt256::fromHex(hex));
+        }
+    });
+
+    BigInt bigIntSum;
+    UInt256 uint256Sum;
+    measure("BigInt add", [&]() {
+        for (const auto &value : bigInts) {
+            bigIntSum = bigIntSum + value;
+        }
+    });
+    measure("UInt256 add", [&]() {
+        for (const auto &value : uint256s) {
+            uint256Sum += value;
+        }
+    });
+    EXPECT_EQ(uint256Sum.toBigInt(), bigIntSum);
+
+    size_t length = 0;
+    measure("BigInt toString", [&]() {
+        for (const auto &value : bigInts) {
+            length += value.toString().size();
+        }
+    });
+    measure("UInt256 toString", [&]() {
+        for (const auto &value : uint256s) {
+            length -= value.toString().size();
+        }
+    });
+    EXPECT_EQ(length, 0);
+}
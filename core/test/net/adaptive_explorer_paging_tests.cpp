@@ -0,0 +1,158 @@
+/*
+ *
+ * adaptive_explorer_paging_tests
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#include <chrono>
+#include <gtest/gtest.h>
+#include <wallet/bitcoin/explorers/LedgerApiBitcoinLikeBlockchainExplorer.hpp>
+#include <wallet/common/explorers/AdaptiveExplorerPaging.hpp>
+#include <limits>
+
+using namespace ledger::core;
+using namespace std::chrono;
+
+TEST(AdaptiveExplorerPaging, GrowsBatchSizeOnTruncatedPages) {
+    AdaptiveExplorerPaging paging;
+    std::vector<std::string> addresses{"a", "b"};
+    EXPECT_EQ(paging.getBatchSize(addresses), AdaptiveExplorerPaging::DEFAULT_BATCH_SIZE);
+    paging.record(addresses, 1000, 1000, true, milliseconds(100), {});
+    EXPECT_EQ(paging.getBatchSize(addresses), 2000);
+    paging.record(addresses, 2000, 12, false, milliseconds(100), {});
+    EXPECT_EQ(paging.getBatchSize(addresses), 2000);
+    EXPECT_EQ(paging.getTimings().size(), 2);
+}
+
+TEST(AdaptiveExplorerPaging, ShrinksBatchSizeOnSlowCalls) {
+    AdaptiveExplorerPaging paging;
+    std::vector<std::string> addresses{"a"};
+    for (auto i = 0; i < 10; i++) {
+        paging.record(addresses, paging.getBatchSize(addresses), 1000, true, milliseconds(5000), {});
+    }
+    EXPECT_EQ(paging.getBatchSize(addresses), AdaptiveExplorerPaging::MIN_BATCH_SIZE);
+}
+
+TEST(AdaptiveExplorerPaging, GrowsGeometrically) {
+    EXPECT_EQ(AdaptiveExplorerPaging::grow(1000), 2000);
+    EXPECT_EQ(AdaptiveExplorerPaging::grow(40000), std::numeric_limits<uint16_t>::max());
+}
+
+TEST(AdaptiveExplorerPaging, SplitsHotAddresses) {
+    AdaptiveExplorerPaging paging;
+    std::vector<std::string> addresses{"a", "b", "c"};
+    EXPECT_EQ(paging.split(addresses).size(), 1);
+
+    paging.record(addresses, 1000, 1000, true, milliseconds(100), {{"a", 10}, {"b", 900}, {"c", 90}});
+    auto groups = paging.split(addresses);
+    ASSERT_EQ(groups.size(), 2);
+    EXPECT_EQ(groups[0], std::vector<std::string>({"b"}));
+    EXPECT_EQ(groups[1], std::vector<std::string>({"a", "c"}));
+    EXPECT_EQ(paging.getBatchSize({"b"}), 2000);
+
+    // The address goes back to its group once it is fully synchronized
+    paging.record({"b"}, 2000, 15, false, milliseconds(100), {});
+    EXPECT_EQ(paging.split(addresses).size(), 1);
+}
+
+TEST(AdaptiveExplorerPaging, CapsTheNumberOfStreams) {
+    AdaptiveExplorerPaging paging;
+    paging.setMaxStreams(1);
+    std::vector<std::string> addresses{"a", "b"};
+    paging.record(addresses, 1000, 1000, true, milliseconds(100), {{"a", 1000}});
+    EXPECT_EQ(paging.split(addresses).size(), 1);
+    paging.setMaxStreams(4);
+    EXPECT_EQ(paging.split(addresses).size(), 2);
+}
+
+namespace {
+    using Bulk = BitcoinLikeBlockchainExplorer::TransactionsBulk;
+
+    BitcoinLikeBlockchainExplorerTransaction makeTransaction(const std::string &hash, Option<uint64_t> height) {
+        BitcoinLikeBlockchainExplorerTransaction tx;
+        tx.hash = hash;
+        if (height.hasValue()) {
+            Block block;
+            block.height = height.getValue();
+            block.hash   = "block_" + std::to_string(block.height);
+            tx.block     = block;
+        }
+        return tx;
+    }
+
+    std::shared_ptr<Bulk> makeBulk(bool hasNext, const std::vector<BitcoinLikeBlockchainExplorerTransaction> &transactions) {
+        auto bulk          = std::make_shared<Bulk>();
+        bulk->hasNext      = hasNext;
+        bulk->transactions = transactions;
+        return bulk;
+    }
+
+    std::vector<std::string> getHashes(const std::shared_ptr<Bulk> &bulk) {
+        std::vector<std::string> hashes;
+        for (const auto &tx : bulk->transactions) {
+            hashes.push_back(tx.hash);
+        }
+        return hashes;
+    }
+} // namespace
+
+TEST(MergeTransactionsBulks, CutsCompleteStreamsAtTheTruncatedOne) {
+    auto truncated = makeBulk(true, {makeTransaction("a1", 10), makeTransaction("a2", 20), makeTransaction("a3", 30)});
+    auto complete  = makeBulk(false, {makeTransaction("b1", 15), makeTransaction("b2", 30), makeTransaction("b3", 35)});
+    auto merged    = LedgerApiBlockchainExplorer::mergeTransactionsBulks({truncated, complete});
+    EXPECT_TRUE(merged->hasNext);
+    // The next page starts from block 30, the transactions above are returned with it
+    EXPECT_EQ(getHashes(merged), std::vector<std::string>({"a1", "b1", "a2", "a3", "b2"}));
+}
+
+TEST(MergeTransactionsBulks, CutsAtTheLowestTruncatedHeight) {
+    auto first  = makeBulk(true, {makeTransaction("a1", 10), makeTransaction("a2", 30)});
+    auto second = makeBulk(true, {makeTransaction("b1", 5), makeTransaction("b2", 20)});
+    auto merged = LedgerApiBlockchainExplorer::mergeTransactionsBulks({first, second});
+    EXPECT_TRUE(merged->hasNext);
+    EXPECT_EQ(getHashes(merged), std::vector<std::string>({"b1", "a1", "b2"}));
+}
+
+TEST(MergeTransactionsBulks, KeepsSharedTransactionsOnce) {
+    auto first  = makeBulk(false, {makeTransaction("shared", 10), makeTransaction("a1", 12)});
+    auto second = makeBulk(false, {makeTransaction("b1", 8), makeTransaction("shared", 10)});
+    auto merged = LedgerApiBlockchainExplorer::mergeTransactionsBulks({first, second});
+    EXPECT_FALSE(merged->hasNext);
+    EXPECT_EQ(getHashes(merged), std::vector<std::string>({"b1", "shared", "a1"}));
+}
+
+TEST(MergeTransactionsBulks, ReturnsUnconfirmedTransactionsWithTheLastPage) {
+    auto truncated = makeBulk(true, {makeTransaction("a1", 10)});
+    auto complete  = makeBulk(false, {makeTransaction("b1", 5), makeTransaction("pending", Option<uint64_t>())});
+    auto page      = LedgerApiBlockchainExplorer::mergeTransactionsBulks({truncated, complete});
+    EXPECT_TRUE(page->hasNext);
+    EXPECT_EQ(getHashes(page), std::vector<std::string>({"b1", "a1"}));
+
+    auto last = LedgerApiBlockchainExplorer::mergeTransactionsBulks({makeBulk(false, {makeTransaction("a2", 20)}), complete});
+    EXPECT_FALSE(last->hasNext);
+    EXPECT_EQ(getHashes(last), std::vector<std::string>({"b1", "a2", "pending"}));
+}
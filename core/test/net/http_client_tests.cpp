@@ -35,11 +35,17 @@
 #include <NativePathResolver.hpp>
 #include <NativeThreadDispatcher.hpp>
 #include <boost/lexical_cast.hpp>
+#include <chrono>
+#include <fmt/format.h>
 #include <fstream>
 #include <gtest/gtest.h>
 #include <ledger/core/net/HttpClient.hpp>
 #include <ledger/core/net/HttpJsonHandler.hpp>
+#include <ledger/core/utils/ImmediateExecutionContext.hpp>
 #include <mongoose.h>
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
 
 static std::string BIG_TEXT =
     "Hi guys, I own a Nano S and I am a big fan, however there is a big slice of information that is missing from your website, that is how reliable the Nano S is, how much testing it's been through (and it goes through any time a new software release is distributed) etc. \n"
@@ -353,3 +359,89 @@ TEST(HttpClient, GETWithSaxError) {
         WAIT_AND_TIMEOUT(dispatcher, 10000);
     }
 }
+
+namespace {
+    struct BenchmarkTransaction {
+        std::string hash;
+        std::string value;
+        int64_t height;
+        std::vector<std::string> inputs;
+    };
+
+    struct BenchmarkPage {
+        std::vector<BenchmarkTransaction> txs;
+    };
+
+    void from_json(const nlohmann::json &json, BenchmarkTransaction &tx) {
+        tx.hash   = json.at("hash").get<std::string>();
+        tx.value  = json.at("value").get<std::string>();
+        tx.height = json.at("height").get<int64_t>();
+        tx.inputs = json.at("inputs").get<std::vector<std::string>>();
+    }
+
+    void from_json(const nlohmann::json &json, BenchmarkPage &page) {
+        page.txs = json.at("txs").get<std::vector<BenchmarkTransaction>>();
+    }
+
+    class InMemoryUrlConnection : public api::HttpUrlConnection {
+      public:
+        explicit InMemoryUrlConnection(const std::vector<uint8_t> &body) : _body(body) {}
+        int32_t getStatusCode() override { return 200; }
+        std::string getStatusText() override { return "OK"; }
+        std::unordered_map<std::string, std::string> getHeaders() override { return {}; }
+        api::HttpReadBodyResult readBody() override {
+            return api::HttpReadBodyResult(std::experimental::nullopt, _body);
+        }
+
+      private:
+        std::vector<uint8_t> _body;
+    };
+
+    class InMemoryHttpClient : public api::HttpClient {
+      public:
+        explicit InMemoryHttpClient(const std::string &body) : _body(body.begin(), body.end()) {}
+        void execute(const std::shared_ptr<api::HttpRequest> &request) override {
+            request->complete(std::make_shared<InMemoryUrlConnection>(_body), std::experimental::nullopt);
+        }
+
+      private:
+        std::vector<uint8_t> _body;
+    };
+
+    long maxResidentSetSizeKb() {
+#ifndef _WIN32
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        return usage.ru_maxrss;
+#else
+        return 0;
+#endif
+    }
+} // namespace
+
+TEST(HttpClient, DISABLED_JsonParsingBenchmark) {
+    constexpr auto TRANSACTIONS = 50000;
+    constexpr auto ITERATIONS   = 10;
+    std::string body            = "{\"txs\":[";
+    for (auto i = 0; i < TRANSACTIONS; i++) {
+        body += fmt::format("{}{{\"hash\":\"{:064x}\",\"value\":\"{}\",\"height\":{},\"inputs\":[\"{:064x}\",\"{:064x}\"]}}",
+                            i == 0 ? "" : ",", i, i * 1000, i, i + 1, i + 2);
+    }
+    body += "]}";
+    std::cout << "Payload size: " << body.size() / 1024 << " KiB" << std::endl;
+
+    auto context = ImmediateExecutionContext::INSTANCE;
+    ledger::core::HttpClient http("http://127.0.0.1:8000", std::make_shared<InMemoryHttpClient>(body), context, context);
+
+    auto rssBefore = maxResidentSetSizeKb();
+    auto start     = std::chrono::system_clock::now();
+    for (auto i = 0; i < ITERATIONS; i++) {
+        auto result = http.GET("/txs").json<BenchmarkPage, Exception>().getValue();
+        ASSERT_TRUE(result.hasValue() && result.getValue().isSuccess());
+        ASSERT_TRUE(result.getValue().getValue().isRight());
+        EXPECT_EQ(result.getValue().getValue().getRight()->txs.size(), TRANSACTIONS);
+    }
+    std::chrono::duration<double> diff = std::chrono::system_clock::now() - start;
+    std::cout << "Time to parse a page : " << diff.count() / ITERATIONS << " s" << std::endl;
+    std::cout << "Peak resident set growth : " << maxResidentSetSizeKb() - rssBefore << " KiB" << std::endl;
+}
@@ -0,0 +1,190 @@
+/*
+ *
+ * http_response_cache_tests
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#include "MemPreferencesBackend.hpp"
+
+#include <gtest/gtest.h>
+#include <ledger/core/net/HttpResponseCache.hpp>
+
+using namespace ledger::core;
+
+namespace {
+    class FakeConnection : public api::HttpUrlConnection {
+      public:
+        FakeConnection(const std::string &body, const std::unordered_map<std::string, std::string> &headers = {}) : _body(body.begin(), body.end()), _headers(headers), _read(false) {}
+
+        int32_t getStatusCode() override {
+            return 200;
+        }
+
+        std::string getStatusText() override {
+            return "OK";
+        }
+
+        std::unordered_map<std::string, std::string> getHeaders() override {
+            return _headers;
+        }
+
+        api::HttpReadBodyResult readBody() override {
+            auto data = _read ? std::vector<uint8_t>() : _body;
+            _read     = true;
+            return api::HttpReadBodyResult(std::experimental::optional<api::Error>(), data);
+        }
+
+      private:
+        std::vector<uint8_t> _body;
+        std::unordered_map<std::string, std::string> _headers;
+        bool _read;
+    };
+
+    // Records the number of value bytes written by each commit
+    class RecordingPreferencesBackend : public test::MemPreferencesBackend {
+      public:
+        bool commit(const std::vector<api::PreferencesChange> &changes) override {
+            std::size_t written = 0;
+            for (const auto &change : changes) {
+                written += change.value.size();
+            }
+            commits.push_back(written);
+            return MemPreferencesBackend::commit(changes);
+        }
+
+        std::vector<std::size_t> commits;
+    };
+
+    const std::string RAW_TRANSACTION_URL = "https://explorers.api.live.ledger.com/blockchain/v3/btc/transactions/0e3e2357e806b6cdb1f70b54c3a3a17b6714ee1f0e68bebb44a74b1efd512098/hex";
+    const std::string TRANSACTION_URL     = "https://explorers.api.live.ledger.com/blockchain/v3/btc/transactions/0e3e2357e806b6cdb1f70b54c3a3a17b6714ee1f0e68bebb44a74b1efd512098";
+} // namespace
+
+TEST(HttpResponseCache, OnlyCachesMatchingUrls) {
+    HttpResponseCache cache(1024);
+    cache.addExplorerRules(std::chrono::seconds(60));
+    EXPECT_TRUE(cache.isCacheable(RAW_TRANSACTION_URL));
+    EXPECT_TRUE(cache.isCacheable(TRANSACTION_URL));
+    EXPECT_FALSE(cache.isCacheable("https://explorers.api.live.ledger.com/blockchain/v3/btc/blocks/current"));
+    EXPECT_FALSE(cache.isCacheable("https://explorers.api.live.ledger.com/blockchain/v3/btc/addresses/1A1zP1eP5QGefi2DMPTfTL5SLmv7DivfNa/transactions"));
+}
+
+TEST(HttpResponseCache, ReplaysStoredResponses) {
+    HttpResponseCache cache(1024);
+    cache.addImmutableRule("/hex$");
+    EXPECT_TRUE(cache.lookup(RAW_TRANSACTION_URL).isEmpty());
+
+    auto entry = cache.store(RAW_TRANSACTION_URL, std::make_shared<FakeConnection>("0100000001", std::unordered_map<std::string, std::string>{{"etag", "\"abc\""}}));
+    EXPECT_EQ(entry->etag, "\"abc\"");
+
+    auto lookup = cache.lookup(RAW_TRANSACTION_URL);
+    ASSERT_TRUE(lookup.nonEmpty());
+    EXPECT_TRUE(lookup->fresh);
+    CachedHttpUrlConnection connection(lookup->entry);
+    EXPECT_EQ(connection.getStatusCode(), 200);
+    auto body = connection.readBody().data.value();
+    EXPECT_EQ(std::string(body.begin(), body.end()), "0100000001");
+    EXPECT_TRUE(connection.readBody().data.value().empty());
+    EXPECT_EQ(cache.getStats().hits, 1);
+    EXPECT_EQ(cache.getStats().misses, 1);
+}
+
+TEST(HttpResponseCache, RevalidatesExpiredResponses) {
+    HttpResponseCache cache(1024);
+    cache.addRule("/transactions/", std::chrono::seconds(0));
+    cache.store(TRANSACTION_URL, std::make_shared<FakeConnection>("{}", std::unordered_map<std::string, std::string>{{"ETag", "\"abc\""}}));
+
+    auto lookup = cache.lookup(TRANSACTION_URL);
+    ASSERT_TRUE(lookup.nonEmpty());
+    EXPECT_FALSE(lookup->fresh);
+    EXPECT_EQ(lookup->entry->etag, "\"abc\"");
+    auto refreshed = cache.refresh(TRANSACTION_URL, lookup->entry);
+    EXPECT_EQ(refreshed->body, lookup->entry->body);
+    EXPECT_EQ(cache.getStats().revalidations, 1);
+}
+
+TEST(HttpResponseCache, EvictsLeastRecentlyUsedResponses) {
+    HttpResponseCache cache(100);
+    cache.addImmutableRule("^/");
+    cache.store("/a", std::make_shared<FakeConnection>(std::string(40, 'a')));
+    cache.store("/b", std::make_shared<FakeConnection>(std::string(40, 'b')));
+    EXPECT_TRUE(cache.lookup("/a").nonEmpty());
+    cache.store("/c", std::make_shared<FakeConnection>(std::string(40, 'c')));
+    EXPECT_TRUE(cache.lookup("/a").nonEmpty());
+    EXPECT_TRUE(cache.lookup("/b").isEmpty());
+    EXPECT_TRUE(cache.lookup("/c").nonEmpty());
+    EXPECT_LE(cache.getMemorySize(), 100);
+}
+
+TEST(HttpResponseCache, DoesNotStoreNoStoreResponses) {
+    HttpResponseCache cache(1024);
+    cache.addImmutableRule("^/");
+    auto entry = cache.store("/a", std::make_shared<FakeConnection>("a", std::unordered_map<std::string, std::string>{{"Cache-Control", "no-store"}}));
+    EXPECT_EQ(entry->body.size(), 1);
+    EXPECT_TRUE(cache.lookup("/a").isEmpty());
+}
+
+TEST(HttpResponseCache, OnlyStoresConfirmedTransactions) {
+    HttpResponseCache cache(1024);
+    cache.addExplorerRules(std::chrono::seconds(60));
+    cache.store(TRANSACTION_URL, std::make_shared<FakeConnection>("[{\"hash\":\"0e3e\",\"block\":null}]"));
+    EXPECT_TRUE(cache.lookup(TRANSACTION_URL).isEmpty());
+
+    cache.store(TRANSACTION_URL, std::make_shared<FakeConnection>("[{\"hash\":\"0e3e\",\"block\":{\"hash\":\"0000\",\"height\":123}}]"));
+    EXPECT_TRUE(cache.lookup(TRANSACTION_URL).nonEmpty());
+
+    const auto cosmosUrl = "https://cosmos.coin.ledger.com/txs/0E3E2357E806B6CDB1F70B54C3A3A17B6714EE1F0E68BEBB44A74B1EFD512098";
+    cache.store(cosmosUrl, std::make_shared<FakeConnection>("{\"txhash\":\"0E3E\",\"height\":\"123\"}"));
+    EXPECT_TRUE(cache.lookup(cosmosUrl).nonEmpty());
+}
+
+TEST(HttpResponseCache, PersistsResponsesOnDisk) {
+    RecordingPreferencesBackend backend;
+    auto disk = std::make_shared<Preferences>(backend, "http_cache");
+    {
+        // Responses only fit on disk, 23 of them at most
+        HttpResponseCache cache(0, disk, 1000);
+        cache.addImmutableRule("^/");
+        for (auto i = 10; i < 60; i++) {
+            cache.store("/" + std::to_string(i), std::make_shared<FakeConnection>(std::string(40, 'a')));
+        }
+        // Each store writes its entry and a fixed size index record, whatever the number of entries on disk
+        EXPECT_EQ(backend.commits.front(), backend.commits.back());
+    }
+
+    HttpResponseCache cache(0, disk, 1000);
+    cache.addImmutableRule("^/");
+    EXPECT_TRUE(cache.lookup("/36").isEmpty());
+    EXPECT_TRUE(cache.lookup("/37").nonEmpty());
+    EXPECT_TRUE(cache.lookup("/59").nonEmpty());
+
+    // Storing a response again makes it the newest one
+    cache.store("/37", std::make_shared<FakeConnection>(std::string(40, 'b')));
+    cache.store("/60", std::make_shared<FakeConnection>(std::string(40, 'c')));
+    EXPECT_TRUE(cache.lookup("/37").nonEmpty());
+    EXPECT_TRUE(cache.lookup("/38").isEmpty());
+    EXPECT_TRUE(cache.lookup("/60").nonEmpty());
+}
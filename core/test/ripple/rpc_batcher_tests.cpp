@@ -0,0 +1,155 @@
+/*
+ *
+ * rpc_batcher_tests.cpp
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <MongooseHttpClient.hpp>
+#include <MongooseSimpleRestServer.hpp>
+#include <UvThreadDispatcher.hpp>
+#include <atomic>
+#include <chrono>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <thread>
+#include <wallet/ripple/explorers/NodeRippleLikeBlockchainExplorer.h>
+#include <wallet/ripple/explorers/RippleLikeRpcBatcher.h>
+
+using namespace ledger::core;
+
+namespace {
+    const short PORT          = 8010;
+    const auto NODE_ENDPOINT = "http://127.0.0.1:8010";
+
+    std::string accountInfo(const rapidjson::Value &call) {
+        return fmt::format("{{\"result\":{{\"account_data\":{{\"Balance\":\"{}\"}},\"status\":\"success\"}}}}",
+                           call["params"][0]["account"].GetString());
+    }
+
+    std::string accountInfoCall(const std::string &account) {
+        NodeRippleLikeBodyRequest request;
+        request.setMethod("account_info");
+        request.pushParameter("account", account);
+        request.pushParameter("ledger_index", std::string("validated"));
+        return request.getString();
+    }
+} // namespace
+
+// Runs a mock rippled answering account_info calls, alone or in a batch, with the account as balance
+class RippleLikeRpcBatcherTest : public ::testing::Test {
+  public:
+    void SetUp() override {
+        dispatcher = std::make_shared<uv::UvThreadDispatcher>();
+        server     = std::make_shared<MongooseSimpleRestServer>(dispatcher->getSerialExecutionContext("server"));
+        server->POST("/", [this](const RestRequest &request) -> RestResponse {
+            requests++;
+            std::this_thread::sleep_for(std::chrono::milliseconds(latency));
+            rapidjson::Document body;
+            body.Parse(request.message->body.p, request.message->body.len);
+            if (body["method"] != "batch") {
+                return {200, "OK", accountInfo(body)};
+            }
+            std::string results = "[";
+            for (rapidjson::SizeType index = 0; index < body["params"].Size(); index++) {
+                results += (index > 0 ? "," : "") + accountInfo(body["params"][index]);
+            }
+            return {200, "OK", results + "]"};
+        });
+        server->start(PORT);
+        server->wait_for_started();
+        http = std::make_shared<HttpClient>(NODE_ENDPOINT,
+                                            std::make_shared<MongooseHttpClient>(dispatcher->getSerialExecutionContext("client")),
+                                            dispatcher->getSerialExecutionContext("worker"),
+                                            nullptr);
+    }
+
+    void TearDown() override {
+        server->stop();
+        dispatcher->stop();
+    }
+
+    std::shared_ptr<RippleLikeRpcBatcher> newBatcher(int64_t window, size_t maxBatchSize) {
+        return std::make_shared<RippleLikeRpcBatcher>(http, dispatcher->getSerialExecutionContext("batcher"), std::chrono::milliseconds(window), maxBatchSize);
+    }
+
+    std::vector<std::string> callAll(const std::shared_ptr<RippleLikeRpcBatcher> &batcher, size_t count) {
+        std::vector<Future<std::shared_ptr<rapidjson::Document>>> calls;
+        for (size_t index = 0; index < count; index++) {
+            calls.push_back(batcher->call(accountInfoCall(fmt::format("r{}", index))));
+        }
+        std::vector<std::string> balances;
+        for (auto &call : calls) {
+            auto document = uv::wait(call);
+            balances.push_back((*document)["result"]["account_data"]["Balance"].GetString());
+        }
+        return balances;
+    }
+
+    std::shared_ptr<uv::UvThreadDispatcher> dispatcher;
+    std::shared_ptr<MongooseSimpleRestServer> server;
+    std::shared_ptr<HttpClient> http;
+    std::atomic<int> requests{0};
+    int64_t latency = 0;
+};
+
+TEST_F(RippleLikeRpcBatcherTest, CoalescesConcurrentCalls) {
+    auto batcher  = newBatcher(50, 32);
+    auto balances = callAll(batcher, 3);
+    EXPECT_EQ(balances, std::vector<std::string>({"r0", "r1", "r2"}));
+    EXPECT_EQ(requests, 1);
+    EXPECT_EQ(batcher->getStats().calls, 3);
+    EXPECT_EQ(batcher->getStats().requests, 1);
+}
+
+TEST_F(RippleLikeRpcBatcherTest, SplitsBatchesAtMaxSize) {
+    auto batcher  = newBatcher(50, 2);
+    auto balances = callAll(batcher, 5);
+    EXPECT_EQ(balances, std::vector<std::string>({"r0", "r1", "r2", "r3", "r4"}));
+    EXPECT_EQ(requests, 3);
+}
+
+TEST_F(RippleLikeRpcBatcherTest, ZeroWindowDisablesBatching) {
+    auto batcher  = newBatcher(0, 32);
+    auto balances = callAll(batcher, 3);
+    EXPECT_EQ(balances, std::vector<std::string>({"r0", "r1", "r2"}));
+    EXPECT_EQ(requests, 3);
+}
+
+TEST_F(RippleLikeRpcBatcherTest, DISABLED_Benchmark) {
+    static const size_t ACCOUNTS = 500;
+    latency                      = 20;
+    for (auto window : {0, 10}) {
+        requests   = 0;
+        auto start = std::chrono::steady_clock::now();
+        callAll(newBatcher(window, 32), ACCOUNTS);
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        std::cout << "Window " << window << " ms: " << ACCOUNTS << " account_info calls in " << requests << " requests, "
+                  << elapsed.count() << " ms (node latency " << latency << " ms)" << std::endl;
+    }
+}
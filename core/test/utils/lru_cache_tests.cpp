@@ -0,0 +1,73 @@
+/*
+ *
+ * lru_cache_tests
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#include <gtest/gtest.h>
+#include <ledger/core/utils/LRUCache.h>
+#include <string>
+
+using namespace ledger::core;
+
+TEST(LRUCache, ReturnsStoredValues) {
+    LRUCache<int, std::string> cache(2);
+    EXPECT_TRUE(cache.get(1).isEmpty());
+    cache.put(1, "one");
+    cache.put(2, "two");
+    EXPECT_EQ(cache.get(1).getValue(), "one");
+    EXPECT_EQ(cache.get(2).getValue(), "two");
+    cache.put(2, "deux");
+    EXPECT_EQ(cache.get(2).getValue(), "deux");
+    EXPECT_EQ(cache.size(), 2);
+}
+
+TEST(LRUCache, EvictsLeastRecentlyUsed) {
+    LRUCache<int, std::string> cache(2);
+    cache.put(1, "one");
+    cache.put(2, "two");
+    // Touching 1 makes 2 the least recently used entry
+    EXPECT_TRUE(cache.get(1).nonEmpty());
+    cache.put(3, "three");
+    EXPECT_TRUE(cache.get(2).isEmpty());
+    EXPECT_EQ(cache.get(1).getValue(), "one");
+    EXPECT_EQ(cache.get(3).getValue(), "three");
+    EXPECT_EQ(cache.size(), 2);
+}
+
+TEST(LRUCache, EraseAndZeroCapacity) {
+    LRUCache<int, int> cache(4);
+    cache.put(1, 1);
+    cache.erase(1);
+    cache.erase(42);
+    EXPECT_TRUE(cache.get(1).isEmpty());
+    EXPECT_EQ(cache.size(), 0);
+
+    LRUCache<int, int> disabled(0);
+    disabled.put(1, 1);
+    EXPECT_TRUE(disabled.get(1).isEmpty());
+}
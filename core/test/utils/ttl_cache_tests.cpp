@@ -0,0 +1,115 @@
+/*
+ *
+ * ttl_cache_tests
+ * ledger-core
+ *
+ * Created by Ledger on 18/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <ledger/core/utils/TTLCache.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ledger::core;
+
+TEST(TTLCache, OverwritesExistingKeys) {
+    TTLCache<std::string, int> cache(std::chrono::seconds(60));
+    cache.put("a", 1);
+    cache.put("a", 2);
+    EXPECT_EQ(cache.get("a").getValue(), 2);
+    EXPECT_EQ(cache.size(), 1);
+    cache.erase("a");
+    EXPECT_TRUE(cache.get("a").isEmpty());
+}
+
+TEST(TTLCache, ExpiresEntries) {
+    TTLCache<std::string, int, std::chrono::milliseconds> cache(std::chrono::milliseconds(20));
+    cache.put("a", 1);
+    cache.put("b", 2);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_TRUE(cache.get("a").isEmpty());
+    // Writing sweeps the expired entries even if they are never read again
+    cache.put("c", 3);
+    EXPECT_LE(cache.size(), 2);
+    EXPECT_EQ(cache.get("c").getValue(), 3);
+}
+
+TEST(TTLCache, IsBoundedInSize) {
+    TTLCache<int, int> cache(std::chrono::seconds(60), 8, 1);
+    for (auto i = 0; i < 100; i++) {
+        cache.put(i, i);
+        // Keep the first key hot
+        EXPECT_TRUE(cache.get(0).nonEmpty());
+    }
+    EXPECT_EQ(cache.size(), 8);
+    EXPECT_EQ(cache.get(0).getValue(), 0);
+    EXPECT_EQ(cache.get(99).getValue(), 99);
+    EXPECT_TRUE(cache.get(50).isEmpty());
+
+    auto stats = cache.getStats();
+    EXPECT_EQ(stats.evictions, 92);
+    EXPECT_EQ(stats.misses, 1);
+    EXPECT_EQ(stats.hits, 102);
+}
+
+TEST(TTLCache, DISABLED_BenchmarkContention) {
+    const auto THREADS = 8;
+    const auto OPERATIONS = 1000000;
+    const auto KEYS = 64;
+    TTLCache<std::string, int> cache(std::chrono::seconds(60));
+    std::vector<std::string> keys;
+    for (auto i = 0; i < KEYS; i++) {
+        keys.push_back(std::to_string(i));
+        cache.put(keys.back(), i);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (auto t = 0; t < THREADS; t++) {
+        threads.emplace_back([&cache, &keys, t]() {
+            for (auto i = 0; i < OPERATIONS; i++) {
+                const auto &key = keys[(i * 7 + t) % KEYS];
+                // One write for 15 reads
+                if (i % 16 == 0) {
+                    cache.put(key, i);
+                } else {
+                    cache.get(key);
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    auto stats = cache.getStats();
+    std::cout << THREADS << " threads x " << OPERATIONS << " operations : " << elapsed.count() << " s ("
+              << stats.hits << " hits, " << stats.misses << " misses)\n";
+}